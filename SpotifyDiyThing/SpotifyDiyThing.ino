@@ -66,10 +66,32 @@ WiFiClientSecure client;
 // ----------------------------
 #include "refreshToken.h"
 
+#include "tlsSessionClient.h"
+
+#include "connectionManager.h"
+
+#include "tokenManager.h"
+
+#include "currentlyPlayingParser.h"
+
+#include "spotifyApi.h"
+
+#include "albumArtCache.h"
+
+#include "albumArt.h"
+
+#include "scheduler.h"
+
+#include "networkTask.h"
+
+#include "pollPolicy.h"
+
 #include "spotifyDisplay.h"
 
 #include "rotaryEncoder.h"
 
+#include "trackState.h"
+
 #include "spotifyLogic.h"
 
 #include "configFile.h"
@@ -92,6 +114,42 @@ void drawWifiManagerMessage(WiFiManager *myWiFiManager)
   spotifyDisplay->drawWifiManagerMessage(myWiFiManager);
 }
 
+// Scheduler tasks, registered at the end of setup()
+void checkDoubleReset()
+{
+  drd->loop();
+}
+
+void checkInput()
+{
+  spotifyDisplay->checkForInput();
+
+  // Check rotary encoder for volume control and button presses
+  checkRotaryEncoderInput();
+}
+
+void handleNetworkResults()
+{
+  // Handle anything the network task has finished
+  processNetworkResults();
+
+  // Draws a track change once the backlight fade out has finished
+  finishRedraw();
+}
+
+void animateDisplay()
+{
+  spotifyDisplay->animate();
+}
+
+void printLoopStats()
+{
+  scheduler.printStats();
+  pollPolicy.printStats();
+  spotifyConnections.printStats();
+  spotifyDisplay->printStats();
+}
+
 void setup()
 {
   Serial.begin(115200);
@@ -105,8 +163,6 @@ void setup()
     forceConfig = true;
   }
 
-  spotifyDisplay->displaySetup(&spotify);
-
   // Initialise SPIFFS, if this fails try .begin(true)
   // NOTE: I believe this formats it though it will erase everything on
   // spiffs already! In this example that is not a problem.
@@ -119,6 +175,10 @@ void setup()
     while (1)
       yield(); // Stay here twiddling thumbs waiting
   }
+
+  // After SPIFFS, the display loads its fonts from there
+  spotifyDisplay->displaySetup(&spotify);
+
   Serial.println("\r\nInitialisation done.");
 
   refreshToken[0] = '\0';
@@ -168,20 +228,32 @@ void setup()
 
   // Setup rotary encoder for volume control and liking songs
   setupRotaryEncoder();
+
+  // Grab the album art buffer while the heap is still in one piece
+  albumArtBegin();
+  artCache.begin();
+
+  // From here on all Spotify requests go through the network task on core 0
+  startNetworkTask();
+
+  // Everything loop() does, each at its own rate (see scheduler.h)
+  scheduler.begin();
+  scheduler.add("drd", checkDoubleReset, 100);
+  scheduler.add("input", checkInput, 50, true);
+  scheduler.add("results", handleNetworkResults, 250, true);
+  pollPolicy.begin(scheduler.add("poll", pollCurrentlyPlaying, 0));
+  scheduler.add("progress", updateProgressBar, delayBetweenProgressUpdates);
+  if (MARQUEE_ENABLED)
+  {
+    // Its line in the loop stats is the cost of a marquee frame
+    scheduler.add("marquee", animateDisplay, MARQUEE_FRAME_MS);
+  }
+  int statsTask = scheduler.add("stats", printLoopStats, 60000);
+  scheduler.runIn(statsTask, 60000);
 }
 
 void loop()
 {
-  drd->loop();
-
-  spotifyDisplay->checkForInput();
-
-  // Check rotary encoder for volume control and button presses
-  checkRotaryEncoderInput();
-
-  bool forceUpdate = false;
-
-  updateCurrentlyPlaying(forceUpdate);
-
-  updateProgressBar();
+  // Runs whatever is due, then sleeps until the next task or an input
+  scheduler.run();
 }
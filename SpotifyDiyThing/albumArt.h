@@ -0,0 +1,269 @@
+// Album art download
+// The network task downloads the art and the display decodes it, so the
+// display never has to wait on the image server.
+//
+// The art normally goes into a RAM buffer that is allocated once at boot and
+// decoded straight from there with jpeg.openRAM, which saves a flash erase,
+// write and read on every album change. Only when the heap is too fragmented
+// for the buffer does it go through ALBUM_ART on SPIFFS like it used to.
+// Either way the image ends up in artCache (albumArtCache.h), and an album
+// that is already there is shown without any download.
+//
+// What was downloaded goes to the display as an AlbumArt in the
+// NET_FETCH_IMAGE result. An ART_IN_RAM one lends it albumArtBuffer, which
+// the network task doesn't write again until albumArtRelease() gives it back.
+// A cached file is pinned in artCache until then, so prefetching can't evict it.
+
+const char *ALBUM_ART = "/album.jpg";
+const char *ALBUM_ART_PREFETCH = "/prefetch.jpg";
+
+#define ALBUM_ART_BUFFER_SIZE (48 * 1024)  // The 300px art is usually around 30KB
+#define ALBUM_ART_HEAP_RESERVE (40 * 1024) // Leave this much for TLS and JSON after the buffer
+
+enum AlbumArtSource
+{
+  ART_NONE,
+  ART_IN_RAM,
+  ART_IN_FILE,
+  ART_FROM_CACHE
+};
+
+struct AlbumArt
+{
+  AlbumArtSource source;
+  uint8_t *data; // ART_IN_RAM
+  size_t length;
+  char path[32]; // File to decode for ART_IN_FILE and ART_FROM_CACHE
+  unsigned long downloadStarted;
+  unsigned long downloadMs;
+};
+
+uint8_t *albumArtBuffer = NULL;
+volatile bool albumArtBufferLent = false; // The display has albumArtBuffer, see albumArtRelease()
+
+// Download plus decode timing, per path. The wait for the fade out in
+// between is left out, it is the same whatever the path.
+struct AlbumArtTiming
+{
+  unsigned long count;
+  unsigned long totalMs;
+};
+AlbumArtTiming albumArtTiming[4];
+
+// Collects the download in albumArtBuffer, refuses anything that doesn't fit
+class AlbumArtBufferWriter : public Print
+{
+public:
+  size_t write(uint8_t b) override
+  {
+    return write(&b, 1);
+  }
+
+  size_t write(const uint8_t *data, size_t size) override
+  {
+    if (length + size > ALBUM_ART_BUFFER_SIZE)
+    {
+      overflowed = true;
+      return 0;
+    }
+    memcpy(albumArtBuffer + length, data, size);
+    length += size;
+    return size;
+  }
+
+  size_t length = 0;
+  bool overflowed = false;
+};
+
+// Allocates the RAM buffer if the heap can spare it, the file path is used otherwise
+bool albumArtAllocate()
+{
+  if (albumArtBuffer != NULL)
+  {
+    return true;
+  }
+  if (ESP.getMaxAllocHeap() < ALBUM_ART_BUFFER_SIZE + ALBUM_ART_HEAP_RESERVE)
+  {
+    return false;
+  }
+  albumArtBuffer = (uint8_t *)malloc(ALBUM_ART_BUFFER_SIZE);
+  return albumArtBuffer != NULL;
+}
+
+// Call once in setup, before the heap gets fragmented
+void albumArtBegin()
+{
+  if (albumArtAllocate())
+  {
+    Serial.println("Album art will be downloaded to RAM");
+  }
+  else
+  {
+    Serial.print("Not enough heap for the album art buffer, using SPIFFS. Largest block: ");
+    Serial.println(ESP.getMaxAllocHeap());
+  }
+}
+
+// Downloads into filePath and moves it into the cache when there is room.
+// cachedPath gets where the image ended up.
+bool albumArtDownloadToFile(const char *albumArtUrl, const char *filePath, char *cachedPath)
+{
+  if (SPIFFS.exists(filePath) == true)
+  {
+    Serial.println("Removing existing image");
+    SPIFFS.remove(filePath);
+  }
+
+  fs::File f = SPIFFS.open(filePath, "w+");
+  if (!f)
+  {
+    Serial.println("file open failed");
+    return false;
+  }
+
+  // The image server has its own kept-alive connection (and cert)
+  bool gotImage = downloadImage(albumArtUrl, &f);
+
+  size_t size = f.size();
+  // Make sure to close the file!
+  f.close();
+
+  strcpy(cachedPath, filePath);
+  if (gotImage && artCache.adopt(albumArtUrl, filePath, size))
+  {
+    AlbumArtCache::filePath(AlbumArtCache::urlHash(albumArtUrl), cachedPath);
+  }
+
+  return gotImage;
+}
+
+// Downloads albumArtUrl to RAM, or to ALBUM_ART when that isn't possible
+// (blocking, network task only). art says where it ended up.
+bool albumArtDownload(const char *albumArtUrl, AlbumArt &art)
+{
+  art.downloadStarted = millis();
+  art.downloadMs = 0;
+  art.source = ART_NONE;
+  art.data = NULL;
+  art.length = 0;
+  bool gotImage = false;
+  bool useFile = true;
+
+  if (artCache.lookup(albumArtUrl, art.path))
+  {
+    Serial.println("Album art cache hit");
+    art.source = ART_FROM_CACHE;
+    artCache.pin(albumArtUrl);
+    return true;
+  }
+
+  // Retried here in case the boot allocation failed but the heap has recovered.
+  // The display only holds on to the buffer between a result and its redraw,
+  // and doesn't ask for more art meanwhile, so it being lent is only a fallback.
+  if (!albumArtBufferLent && albumArtAllocate())
+  {
+    AlbumArtBufferWriter writer;
+    gotImage = downloadImage(albumArtUrl, &writer);
+    if (gotImage)
+    {
+      art.source = ART_IN_RAM;
+      art.data = albumArtBuffer;
+      art.length = writer.length;
+      albumArtBufferLent = true;
+    }
+    else if (writer.overflowed)
+    {
+      Serial.println("Album art didn't fit in the RAM buffer, trying SPIFFS");
+    }
+    useFile = writer.overflowed;
+  }
+
+  if (useFile)
+  {
+    gotImage = albumArtDownloadToFile(albumArtUrl, ALBUM_ART, art.path);
+    if (gotImage)
+    {
+      art.source = ART_IN_FILE;
+      if (strcmp(art.path, ALBUM_ART) != 0)
+      {
+        // It was moved into the cache
+        artCache.pin(albumArtUrl);
+      }
+    }
+  }
+
+  art.downloadMs = millis() - art.downloadStarted;
+  return gotImage;
+}
+
+// Puts the art of an upcoming track into the cache, so it is there by the
+// time the track starts. Goes through its own file, the RAM buffer may be
+// in use by the display. Returns true if something was downloaded.
+bool albumArtPrefetch(const char *albumArtUrl)
+{
+  if (!artCache.enabled() || artCache.contains(albumArtUrl))
+  {
+    return false;
+  }
+
+  Serial.print("Prefetching album art: ");
+  Serial.println(albumArtUrl);
+  char cachedPath[32];
+  bool gotImage = albumArtDownloadToFile(albumArtUrl, ALBUM_ART_PREFETCH, cachedPath);
+  if (gotImage && strcmp(cachedPath, ALBUM_ART_PREFETCH) == 0)
+  {
+    // Didn't make it into the cache, so it is of no use
+    SPIFFS.remove(ALBUM_ART_PREFETCH);
+  }
+  return gotImage;
+}
+
+// Call after the result has been posted, so the flash write doesn't hold up the
+// display. The display only reads the buffer, so both can use it at once, and
+// it isn't written again before the next command.
+void albumArtStoreInCache(const char *albumArtUrl, const AlbumArt &art)
+{
+  if (art.source == ART_IN_RAM)
+  {
+    artCache.store(albumArtUrl, art.data, art.length);
+  }
+}
+
+// The display is done with art (drawn or not), the network task may reuse
+// what it points at
+void albumArtRelease(AlbumArt &art)
+{
+  if (art.source == ART_IN_RAM)
+  {
+    albumArtBufferLent = false;
+  }
+  else if (art.source != ART_NONE)
+  {
+    artCache.unpin();
+  }
+  art.source = ART_NONE;
+}
+
+// Call once the art is on screen, decodeStarted is millis() before the decode
+void albumArtRecordDisplayed(const AlbumArt &art, unsigned long decodeStarted)
+{
+  unsigned long decodeMs = millis() - decodeStarted;
+  unsigned long waitMs = decodeStarted - art.downloadStarted - art.downloadMs;
+  unsigned long totalMs = art.downloadMs + decodeMs;
+  AlbumArtTiming &timing = albumArtTiming[art.source];
+  timing.count++;
+  timing.totalMs += totalMs;
+
+  const char *sourceNames[] = {"", "Album art from RAM", "Album art from SPIFFS", "Album art from cache"};
+  Serial.print(sourceNames[art.source]);
+  Serial.print(", download (ms): ");
+  Serial.print(art.downloadMs);
+  Serial.print(", decode (ms): ");
+  Serial.print(decodeMs);
+  Serial.print(", download + decode (ms): ");
+  Serial.print(totalMs);
+  Serial.print(", average (ms): ");
+  Serial.print(timing.totalMs / timing.count);
+  Serial.print(", waited for the fade (ms): ");
+  Serial.println(waitMs);
+}
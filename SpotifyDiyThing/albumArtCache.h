@@ -0,0 +1,322 @@
+// Album art cache on SPIFFS
+// Every downloaded image is kept as /art/<hash of its URL>.jpg, so an album
+// that comes back (a replay, going back to a playlist) is shown without
+// touching the network. The least recently shown images are removed once
+// the cache goes over ART_CACHE_BUDGET bytes.
+//
+// The index (/art/index) is a small binary table of hash, size and last use,
+// rewritten when an entry is added or removed. A hit only updates the last use
+// in RAM, so showing cached art doesn't write to flash; the new order goes out
+// with the next rewrite. Only the network task calls the cache, but the
+// display decodes cached files later on core 1, so the one handed to it is
+// pinned: eviction skips it until the display unpins it.
+
+#define ART_CACHE_BUDGET (512 * 1024) // Bytes of SPIFFS the cached art may use, 0 disables the cache
+#define ART_CACHE_MAX_ENTRIES 32
+#define ART_CACHE_DIR "/art"
+#define ART_CACHE_INDEX "/art/index"
+
+struct ArtCacheEntry
+{
+  uint32_t hash;
+  uint32_t size;
+  uint32_t lastUsed;
+};
+
+class AlbumArtCache
+{
+public:
+  // Loads the index and drops entries whose file went missing
+  void begin()
+  {
+    _count = 0;
+    _useCounter = 0;
+
+    if (ART_CACHE_BUDGET == 0)
+    {
+      return;
+    }
+
+    int indexed = 0;
+    fs::File f = SPIFFS.open(ART_CACHE_INDEX, "r");
+    if (f)
+    {
+      ArtCacheEntry entry;
+      while (_count < ART_CACHE_MAX_ENTRIES && f.read((uint8_t *)&entry, sizeof(entry)) == sizeof(entry))
+      {
+        indexed++;
+        char path[32];
+        filePath(entry.hash, path);
+        if (SPIFFS.exists(path))
+        {
+          _entries[_count++] = entry;
+          if (entry.lastUsed >= _useCounter)
+          {
+            _useCounter = entry.lastUsed + 1;
+          }
+        }
+      }
+      f.close();
+    }
+
+    removeOrphans();
+    if (_count != indexed)
+    {
+      // Some files went missing
+      saveIndex();
+    }
+
+    Serial.print("Album art cache entries: ");
+    Serial.print(_count);
+    Serial.print(", bytes: ");
+    Serial.println(totalSize());
+  }
+
+  bool enabled()
+  {
+    return ART_CACHE_BUDGET > 0;
+  }
+
+  static uint32_t urlHash(const char *url)
+  {
+    uint32_t hash = 2166136261UL; // FNV-1a
+    while (*url)
+    {
+      hash = (hash ^ (uint8_t)*url++) * 16777619UL;
+    }
+    return hash;
+  }
+
+  static void filePath(uint32_t hash, char *path)
+  {
+    sprintf(path, ART_CACHE_DIR "/%08x.jpg", (unsigned int)hash);
+  }
+
+  bool contains(const char *url)
+  {
+    return find(urlHash(url)) >= 0;
+  }
+
+  // Keeps url's image from being evicted, until unpin(). Only one at a time.
+  void pin(const char *url)
+  {
+    _pinnedHash = urlHash(url);
+    _pinned = true;
+  }
+
+  // Safe to call from the UI
+  void unpin()
+  {
+    _pinned = false;
+  }
+
+  // On a hit, fills path and marks the entry as most recently used
+  bool lookup(const char *url, char *path)
+  {
+    int i = find(urlHash(url));
+    if (i < 0)
+    {
+      return false;
+    }
+
+    filePath(_entries[i].hash, path);
+    if (!SPIFFS.exists(path))
+    {
+      removeEntry(i);
+      saveIndex();
+      return false;
+    }
+
+    _entries[i].lastUsed = _useCounter++;
+    hits++;
+    return true;
+  }
+
+  // Stores an image that is in RAM
+  bool store(const char *url, const uint8_t *data, size_t length)
+  {
+    uint32_t hash = urlHash(url);
+    if (!makeRoom(length))
+    {
+      return false;
+    }
+
+    char path[32];
+    filePath(hash, path);
+    fs::File f = SPIFFS.open(path, "w");
+    if (!f)
+    {
+      return false;
+    }
+    size_t written = f.write(data, length);
+    f.close();
+
+    if (written != length)
+    {
+      Serial.println("Album art cache write failed, is SPIFFS full?");
+      SPIFFS.remove(path);
+      return false;
+    }
+
+    addEntry(hash, length);
+    return true;
+  }
+
+  // Moves an image that was downloaded to a file into the cache
+  bool adopt(const char *url, const char *tempPath, size_t length)
+  {
+    uint32_t hash = urlHash(url);
+    if (!makeRoom(length))
+    {
+      return false;
+    }
+
+    char path[32];
+    filePath(hash, path);
+    SPIFFS.remove(path);
+    if (!SPIFFS.rename(tempPath, path))
+    {
+      return false;
+    }
+
+    addEntry(hash, length);
+    return true;
+  }
+
+  size_t totalSize()
+  {
+    size_t total = 0;
+    for (int i = 0; i < _count; i++)
+    {
+      total += _entries[i].size;
+    }
+    return total;
+  }
+
+  unsigned long hits = 0;
+  unsigned long evictions = 0;
+
+private:
+  int find(uint32_t hash)
+  {
+    for (int i = 0; i < _count; i++)
+    {
+      if (_entries[i].hash == hash)
+      {
+        return i;
+      }
+    }
+    return -1;
+  }
+
+  void addEntry(uint32_t hash, size_t length)
+  {
+    int i = find(hash);
+    if (i < 0)
+    {
+      i = _count++;
+    }
+    _entries[i].hash = hash;
+    _entries[i].size = length;
+    _entries[i].lastUsed = _useCounter++;
+    saveIndex();
+  }
+
+  void removeEntry(int i)
+  {
+    _entries[i] = _entries[--_count];
+  }
+
+  // Evicts least recently used images until length more bytes fit in the budget
+  bool makeRoom(size_t length)
+  {
+    if (!enabled() || length > ART_CACHE_BUDGET)
+    {
+      return false;
+    }
+
+    bool evicted = false;
+    while (_count > 0 && (_count >= ART_CACHE_MAX_ENTRIES || totalSize() + length > ART_CACHE_BUDGET))
+    {
+      int oldest = -1;
+      for (int i = 0; i < _count; i++)
+      {
+        if (_pinned && _entries[i].hash == _pinnedHash)
+        {
+          continue;
+        }
+        if (oldest < 0 || _entries[i].lastUsed < _entries[oldest].lastUsed)
+        {
+          oldest = i;
+        }
+      }
+      if (oldest < 0)
+      {
+        // Only the pinned image is left, and this doesn't fit next to it
+        break;
+      }
+
+      char path[32];
+      filePath(_entries[oldest].hash, path);
+      SPIFFS.remove(path);
+      removeEntry(oldest);
+      evictions++;
+      evicted = true;
+    }
+    if (evicted)
+    {
+      saveIndex();
+    }
+    return _count < ART_CACHE_MAX_ENTRIES && totalSize() + length <= ART_CACHE_BUDGET;
+  }
+
+  // Images left behind by a reset between writing a file and saving the index
+  void removeOrphans()
+  {
+    fs::File dir = SPIFFS.open(ART_CACHE_DIR);
+    if (!dir || !dir.isDirectory())
+    {
+      return;
+    }
+
+    // Removed after the listing is done, at most a few per boot
+    char orphans[4][32];
+    int orphanCount = 0;
+    fs::File file = dir.openNextFile();
+    while (file && orphanCount < 4)
+    {
+      const char *name = strrchr(file.name(), '/');
+      name = name == NULL ? file.name() : name + 1;
+      if (strcmp(name, "index") != 0 && find(strtoul(name, NULL, 16)) < 0)
+      {
+        sprintf(orphans[orphanCount++], ART_CACHE_DIR "/%.20s", name);
+      }
+      file = dir.openNextFile();
+    }
+    dir.close();
+
+    for (int i = 0; i < orphanCount; i++)
+    {
+      SPIFFS.remove(orphans[i]);
+    }
+  }
+
+  void saveIndex()
+  {
+    fs::File f = SPIFFS.open(ART_CACHE_INDEX, "w");
+    if (!f)
+    {
+      return;
+    }
+    f.write((const uint8_t *)_entries, _count * sizeof(ArtCacheEntry));
+    f.close();
+  }
+
+  ArtCacheEntry _entries[ART_CACHE_MAX_ENTRIES];
+  int _count = 0;
+  uint32_t _useCounter = 0;
+  volatile uint32_t _pinnedHash = 0;
+  volatile bool _pinned = false;
+};
+
+AlbumArtCache artCache;
@@ -2,14 +2,39 @@
 
 #include "touchScreen.h"
 
+// Draws are recorded and sent to the panel in one transaction per update
+#include "displayList.h"
+
+#include "progressBar.h"
+
+#include "timeLabel.h"
+
 #include <TFT_eSPI.h>
 #include <SPIFFS.h>
 #include <cmath>
+#include <driver/ledc.h>
 
 // Include Free Fonts header to access FreeSans bitmap fonts
-// FreeSans fonts are rendered smoothly with anti-aliasing via SMOOTH_FONT flag
+// FreeSans draws whatever NotoSans (below) doesn't: the setup screens, and the
+// track text when the NotoSans fonts didn't load
 // Available fonts: FreeSans and FreeSansBold in 9pt, 12pt, 18pt, 24pt sizes
 #include "Free_Fonts.h"
+
+// Line breaking for the track info, reads glyph widths from the fonts above
+#include "textLayout.h"
+
+// ASCII stand-ins for accented, Greek and Cyrillic letters the fonts lack
+#include "transliterate.h"
+
+// NotoSans anti-aliased fonts, loaded from SPIFFS
+#include "smoothFont.h"
+
+// Optional scrolling title, for titles longer than one line
+#include "marquee.h"
+
+// Areas to clear are collected and cleared once at the end of each redraw
+#include "damageTracker.h"
+
 // A library for checking if the reset button has been pressed twice
 // Can be used to enable config mode
 // Can be installed from the library manager (Search for "ESP_DoubleResetDetector")
@@ -30,53 +55,135 @@
 TFT_eSPI tft = TFT_eSPI();
 JPEGDEC jpeg;
 
-const char *ALBUM_ART = "/album.jpg";
 
-// Image positioning constants for rounded corners
-static int imageMarginLeft = 20;
-static int imageMarginTop = 20;
-static int cornerRadius = 22; // Radius for rounded corners
+// Where the album art sits, the text starts textMarginLeft to its right
+static const int imageMarginLeft = 20;
+static const int imageMarginTop = 20;
+static const int textMarginLeft = 10;
+static const int cornerRadius = 22; // Radius for rounded corners
 static int currentImageWidth = 150;
 static int currentImageHeight = 150;
+static uint16_t cornerBackground = TFT_BLACK; // What the corners blend into
 
-// Saturation boost amount (1.00 = no change, higher = more saturation)
-// Adjust between 1.00-1.02 for best results
-static float saturationBoost = 1.0108; // Please dont change this i took a lot of time to find the best thing 
+// How much of each pixel in the top left corner is inside the rounded edge,
+// 0 (outside) to 255 (inside). The other corners are mirror images of it.
+uint8_t cornerCoverage[cornerRadius][cornerRadius];
 
-// Function to boost saturation of an RGB565 pixel
-uint16_t boostSaturation(uint16_t pixel, float boost)
+// Built once at boot, 4x4 samples per pixel give the edge its anti-aliasing
+void buildCornerCoverage()
 {
-  // Extract RGB components from RGB565
-  uint8_t r5 = (pixel >> 11) & 0x1F;  // 5 bits
-  uint8_t g6 = (pixel >> 5) & 0x3F;   // 6 bits
-  uint8_t b5 = pixel & 0x1F;          // 5 bits
-  
-  // Expand to 8-bit for processing (proper conversion)
-  float r = (r5 * 255.0) / 31.0;
-  float g = (g6 * 255.0) / 63.0;
-  float b = (b5 * 255.0) / 31.0;
-  
-  // Calculate luminance (weighted average, more accurate than simple average)
-  float gray = 0.299 * r + 0.587 * g + 0.114 * b;
-  
-  // Push each component away from gray to increase saturation
-  r = gray + (r - gray) * boost;
-  g = gray + (g - gray) * boost;
-  b = gray + (b - gray) * boost;
-  
-  // Clamp to valid range
-  r = constrain(r, 0.0, 255.0);
-  g = constrain(g, 0.0, 255.0);
-  b = constrain(b, 0.0, 255.0);
-  
-  // Convert back to RGB565 (proper rounding)
-  r5 = (uint8_t)((r * 31.0 / 255.0) + 0.5);
-  g6 = (uint8_t)((g * 63.0 / 255.0) + 0.5);
-  b5 = (uint8_t)((b * 31.0 / 255.0) + 0.5);
-  
-  return (r5 << 11) | (g6 << 5) | b5;
+  const int samples = 4;
+  float radiusSq = (float)cornerRadius * cornerRadius;
+  for (int y = 0; y < cornerRadius; y++)
+  {
+    for (int x = 0; x < cornerRadius; x++)
+    {
+      int inside = 0;
+      for (int sy = 0; sy < samples; sy++)
+      {
+        for (int sx = 0; sx < samples; sx++)
+        {
+          float dx = cornerRadius - (x + (sx + 0.5f) / samples);
+          float dy = cornerRadius - (y + (sy + 0.5f) / samples);
+          if (dx * dx + dy * dy <= radiusSq)
+          {
+            inside++;
+          }
+        }
+      }
+      cornerCoverage[y][x] = inside * 255 / (samples * samples);
+    }
+  }
+}
+
+// Mixes two big-endian RGB565 pixels, coverage 255 gives all of pixel
+uint16_t blendPixel(uint16_t pixel, uint16_t background, uint8_t coverage)
+{
+  uint16_t fg = (pixel >> 8) | (pixel << 8);
+  uint16_t bg = (background >> 8) | (background << 8);
+  int r = ((fg >> 11) * coverage + (bg >> 11) * (255 - coverage)) / 255;
+  int g = (((fg >> 5) & 0x3F) * coverage + ((bg >> 5) & 0x3F) * (255 - coverage)) / 255;
+  int b = ((fg & 0x1F) * coverage + (bg & 0x1F) * (255 - coverage)) / 255;
+  uint16_t blended = (r << 11) | (g << 5) | b;
+  return (blended >> 8) | (blended << 8);
+}
+
+// Rounds the corners of a decoded block before it is pushed, so no corner
+// pixel goes to the display twice. pixels is big-endian RGB565.
+void applyCornerMask(uint16_t *pixels, int x, int y, int width, int height)
+{
+  int top = y - imageMarginTop;
+  int bottomStart = currentImageHeight - cornerRadius;
+  // Most blocks are nowhere near a corner
+  if (top >= cornerRadius && top + height <= bottomStart)
+  {
+    return;
+  }
+
+  uint16_t background = (cornerBackground >> 8) | (cornerBackground << 8);
+  for (int row = 0; row < height; row++)
+  {
+    int iy = top + row;
+    if (iy < 0 || iy >= currentImageHeight || (iy >= cornerRadius && iy < bottomStart))
+    {
+      continue;
+    }
+    uint8_t *coverageRow = cornerCoverage[iy < cornerRadius ? iy : currentImageHeight - 1 - iy];
+    uint16_t *line = pixels + row * width;
+
+    for (int col = 0; col < width; col++)
+    {
+      int ix = x - imageMarginLeft + col;
+      int cx;
+      if (ix >= 0 && ix < cornerRadius)
+      {
+        cx = ix;
+      }
+      else if (ix >= currentImageWidth - cornerRadius && ix < currentImageWidth)
+      {
+        cx = currentImageWidth - 1 - ix;
+      }
+      else
+      {
+        continue;
+      }
+
+      uint8_t coverage = coverageRow[cx];
+      if (coverage == 0)
+      {
+        line[col] = background;
+      }
+      else if (coverage < 255)
+      {
+        line[col] = blendPixel(line[col], background, coverage);
+      }
+    }
+  }
 }
 
+// Saturation boost (and the optional per-panel stages) come from colorPipeline.h,
+// colorLut.h holds the result for every possible pixel
+#include "colorPipeline.h"
+#include "colorLut.h"
+
+// A table generated with other settings than colorPipeline.h is ignored
+// until it is regenerated, the pixels are then worked out one by one
+static const bool colorLutUpToDate = colorLutConfig.saturation == colorPipeline.saturation &&
+                                     colorLutConfig.gamma == colorPipeline.gamma &&
+                                     colorLutConfig.brightness == colorPipeline.brightness;
+
+// Two buffers for the decoded MCU blocks: the decoder fills one while DMA
+// sends the other to the display, so decoding and SPI run at the same time
+uint16_t jpegDmaBuffers[2][MAX_BUFFERED_PIXELS];
+int jpegDmaBufferIndex = 0;
+bool jpegDmaEnabled = false;
+
+// Per image, reported by drawOpenedImage()
+unsigned long jpegTransferUs = 0;    // SPI time for everything pushed, estimated from SPI_FREQUENCY
+unsigned long jpegDmaWaitUs = 0;     // Measured: time the decoder sat waiting for the previous block
+unsigned long jpegDmaBlocks = 0;     // Blocks pushed with DMA
+unsigned long jpegDmaBusyBlocks = 0; // Measured: blocks ready while the previous one was still going out
+
 // This next function will be called during decoding of the jpeg file to
 // render each block to the TFT display.
 int JPEGDraw(JPEGDRAW *pDraw)
@@ -85,18 +192,75 @@ int JPEGDraw(JPEGDRAW *pDraw)
   if (pDraw->y >= tft.height())
     return 0;
 
-  // Apply saturation boost to pixels if enabled
-  if (saturationBoost > 1.0)
+  int totalPixels = pDraw->iWidth * pDraw->iHeight;
+  uint16_t *pixels = pDraw->pPixels;
+  uint16_t *out = pixels;
+  if (jpegDmaEnabled)
+  {
+    // The other buffer may still be on its way to the display, this one is free
+    out = jpegDmaBuffers[jpegDmaBufferIndex];
+  }
+
+  // Apply saturation boost (and panel colour stages) with one lookup per pixel,
+  // copying into the DMA buffer at the same time
+  if (colorLutUpToDate)
   {
-    int totalPixels = pDraw->iWidth * pDraw->iHeight;
     for (int i = 0; i < totalPixels; i++)
     {
-      pDraw->pPixels[i] = boostSaturation(pDraw->pPixels[i], saturationBoost);
+      out[i] = colorLut[pixels[i]];
     }
   }
-  
-  // Draw the image with enhanced saturation
-  tft.pushImage(pDraw->x, pDraw->y, pDraw->iWidth, pDraw->iHeight, pDraw->pPixels);
+  else
+  {
+    for (int i = 0; i < totalPixels; i++)
+    {
+      out[i] = colorPipelinePixel(pixels[i], colorPipeline);
+    }
+  }
+
+  // Corners are blended into the background here rather than drawn over afterwards
+  applyCornerMask(out, pDraw->x, pDraw->y, pDraw->iWidth, pDraw->iHeight);
+
+  // The last blocks of a row or column can run past the edge of the art,
+  // those pixels are dropped here so nothing outside it needs clearing after
+  int width = min(pDraw->iWidth, imageMarginLeft + currentImageWidth - pDraw->x);
+  int height = min(pDraw->iHeight, imageMarginTop + currentImageHeight - pDraw->y);
+  if (width <= 0 || height <= 0)
+  {
+    return 1;
+  }
+  if (width < pDraw->iWidth)
+  {
+    for (int row = 1; row < height; row++)
+    {
+      memmove(out + row * width, out + row * pDraw->iWidth, width * sizeof(uint16_t));
+    }
+  }
+  totalPixels = width * height;
+
+  jpegTransferUs += (unsigned long)totalPixels * 16 * 1000 / (SPI_FREQUENCY / 1000);
+
+  if (jpegDmaEnabled)
+  {
+    // The DMA engine takes one transfer at a time, this is where the decoder
+    // would stall if SPI is slower than decoding
+    unsigned long waitStart = micros();
+    if (tft.dmaBusy())
+    {
+      jpegDmaBusyBlocks++;
+    }
+    tft.dmaWait();
+    jpegDmaWaitUs += micros() - waitStart;
+
+    tft.pushImageDMA(pDraw->x, pDraw->y, width, height, out);
+    jpegDmaBufferIndex ^= 1;
+    jpegDmaBlocks++;
+  }
+  else
+  {
+    // Draw the image with enhanced saturation
+    tft.pushImage(pDraw->x, pDraw->y, width, height, out);
+  }
   return 1;
 }
 
@@ -126,16 +290,79 @@ int32_t mySeek(JPEGFILE *handle, int32_t position)
   return myfile.seek(position);
 }
 
-class CheapYellowDisplay : public SpotifyDisplay
+// Set while the LEDC hardware is fading the backlight, cleared from its interrupt
+static volatile bool backlightFading = false;
+static volatile uint32_t backlightFadeTarget = 0; // Duty the current fade ends at
+
+static bool IRAM_ATTR onBacklightFadeEnd(const ledc_cb_param_t *param, void *userArg)
+{
+  // A fade that was replaced can still end just as the next one starts,
+  // only the end of the current one counts
+  if (param->event == LEDC_FADE_END_EVT && param->duty == backlightFadeTarget)
+  {
+    backlightFading = false;
+    scheduler.wakeFromISR(); // finishRedraw() can go ahead
+  }
+  return false; // wakeFromISR() already yielded if it had to
+}
+
+class CheapYellowDisplay : public SpotifyDisplay, public TextPainter
 {
 public:
   // Backlight control constants
   static const int BACKLIGHT_PWM_CHANNEL = 0;
   static const int BACKLIGHT_DEFAULT_BRIGHTNESS = 153; // 60% brightness
   int currentBrightness = BACKLIGHT_DEFAULT_BRIGHTNESS;
+  bool ledcFadeReady = false; // Hardware fades available, otherwise brightness changes are instant
   
-  // Progress bar reset flag
-  bool progressBarNeedsReset = false;
+  // Progress bar geometry, the time labels sit below it
+  static const int PROGRESS_BAR_HEIGHT = 8; // Thicker bar for better visibility
+  static const int PROGRESS_BAR_PADDING = 25;
+  static const int PROGRESS_BAR_MARGIN_FROM_BOTTOM = 45; // More space for time labels
+  // Everything below draws through this, declared first so it is built first
+  DisplayList displayList{&tft, this};
+
+  ProgressBar progressBar{&tft, &displayList};
+
+  // Elapsed and total time below the bar, drawn from one digit atlas
+  DigitAtlas timeDigits{&tft, &displayList};
+  TimeLabel elapsedLabel{&displayList, &timeDigits};
+  TimeLabel durationLabel{&displayList, &timeDigits};
+  long shownDuration = -1; // The total is only drawn once per track
+
+  // Track text laid out for the panel, kept for the track it belongs to
+  TextBlock trackTitle;
+  TextBlock trackArtists;
+  TextBlock trackAlbum;
+  char trackTextUri[64];
+  bool trackTextValid = false;
+  unsigned long trackTextHits = 0;     // Redraws that reused the layout
+  unsigned long trackTextLayoutUs = 0; // Time the last layout took
+  unsigned long trackTitleRenderUs = 0; // Time the last title took to draw
+
+  // NotoSans from data/, held in RAM, FreeSans is used for anything not loaded
+  SmoothFont titleSmoothFont;
+  SmoothFont detailSmoothFont;
+  GfxGlyphMetrics titleGfxMetrics{FSB12};
+  GfxGlyphMetrics detailGfxMetrics{FS9};
+
+  // Long titles scroll on one line when MARQUEE_ENABLED (needs the smooth title font)
+  Marquee titleMarquee{&tft, &displayList};
+
+  // Everything that needs clearing to black, cleared once at the end of a redraw
+  DamageTracker damage;
+
+  // Screen areas, worked out from the art size by updateLayout()
+  DamageRect imageArea = {};
+  DamageRect gapArea = {}; // Between the art and the text, always black
+  DamageRect textArea = {};
+  int textStartX = 0;
+  int textStartY = 0; // Baseline of the first title line
+  int textWidth = 0;
+
+  // Volume label shown between the time labels while the knob is turned
+  static const unsigned long VOLUME_LABEL_DURATION = 2000;
+  unsigned long volumeShownAt = 0; // 0 when the label is not on screen
 
   void displaySetup(SpotifyArduino *spotifyObj)
   {
@@ -155,6 +382,20 @@ public:
     tft.init();
     tft.setRotation(3);
     tft.fillScreen(TFT_BLACK);
+    damage.begin(&tft, &displayList, TFT_BLACK);
+    updateLayout();
+
+    buildCornerCoverage();
+
+    // Modern white gradient over a dark track with a subtle border
+    progressBar.begin(PROGRESS_BAR_PADDING, screenHeight - PROGRESS_BAR_HEIGHT - PROGRESS_BAR_MARGIN_FROM_BOTTOM,
+                      screenWidth - PROGRESS_BAR_PADDING * 2, PROGRESS_BAR_HEIGHT,
+                      tft.color565(255, 255, 255), tft.color565(220, 220, 220),
+                      tft.color565(40, 40, 40), tft.color565(60, 60, 60), TFT_BLACK);
+    setupTimeLabels();
+
+    // Album art blocks are pushed with DMA while the next one decodes
+    jpegDmaEnabled = tft.initDMA();
 
     // Configure backlight brightness using PWM (60% brightness)
     // ESP32 uses LEDC (LED Control) for PWM
@@ -163,43 +404,65 @@ public:
     ledcAttachPin(TFT_BL, BACKLIGHT_PWM_CHANNEL);  // Attach TFT_BL pin to channel 0
     ledcWrite(BACKLIGHT_PWM_CHANNEL, BACKLIGHT_DEFAULT_BRIGHTNESS);  // Set brightness to 60% (153 out of 255)
     currentBrightness = BACKLIGHT_DEFAULT_BRIGHTNESS;
+
+    // Fades run on the LEDC hardware, the callback says when one has finished
+    ledcFadeReady = ledc_fade_func_install(0) == ESP_OK;
+    if (ledcFadeReady)
+    {
+      ledc_cbs_t callbacks = {};
+      callbacks.fade_cb = onBacklightFadeEnd;
+      ledc_cb_register(LEDC_HIGH_SPEED_MODE, (ledc_channel_t)BACKLIGHT_PWM_CHANNEL, &callbacks, NULL);
+    }
     
     // Load custom smooth fonts from SPIFFS
     loadCustomFonts();
   }
 
-  // Smoothly fade backlight from one brightness level to another
-  void fadeBacklight(int fromBrightness, int toBrightness, int durationMs)
+  // Smoothly fade the backlight to a brightness level. The LEDC hardware does
+  // the fade, this returns straight away, backlightFadeDone() says when it ends.
+  void fadeBacklight(int toBrightness, int durationMs)
   {
-    int steps = 50; // Number of fade steps for smooth animation
-    int delayPerStep = durationMs / steps;
-    
-    // Ensure minimum delay of 1ms per step
-    if (delayPerStep < 1)
+    if (!ledcFadeReady || durationMs <= 0)
     {
-      delayPerStep = 1;
-      steps = durationMs;
+      setBacklightBrightness(toBrightness);
+      return;
     }
-    
-    for (int i = 0; i <= steps; i++)
+
+    backlightFadeTarget = toBrightness;
+    esp_err_t err = ledc_set_fade_with_time(LEDC_HIGH_SPEED_MODE, (ledc_channel_t)BACKLIGHT_PWM_CHANNEL, toBrightness, durationMs);
+    if (err == ESP_OK)
     {
-      int brightness = fromBrightness + ((toBrightness - fromBrightness) * i) / steps;
-      ledcWrite(BACKLIGHT_PWM_CHANNEL, brightness);
-      currentBrightness = brightness;
-      delay(delayPerStep);
+      // Set just before the start, so the end of this fade can't come first
+      backlightFading = true;
+      err = ledc_fade_start(LEDC_HIGH_SPEED_MODE, (ledc_channel_t)BACKLIGHT_PWM_CHANNEL, LEDC_FADE_NO_WAIT);
     }
+    if (err != ESP_OK)
+    {
+      // Nothing is fading, so nothing would ever clear the flag
+      backlightFading = false;
+      Serial.print("Backlight fade failed: ");
+      Serial.println(err);
+      setBacklightBrightness(toBrightness);
+      return;
+    }
+    currentBrightness = toBrightness; // Where it ends up
   }
 
   // Fade backlight out (to dim or off)
   void fadeBacklightOut(int durationMs = 300, int targetBrightness = 0)
   {
-    fadeBacklight(currentBrightness, targetBrightness, durationMs);
+    fadeBacklight(targetBrightness, durationMs);
   }
 
   // Fade backlight in (to default or specified brightness)
   void fadeBacklightIn(int durationMs = 300, int targetBrightness = BACKLIGHT_DEFAULT_BRIGHTNESS)
   {
-    fadeBacklight(currentBrightness, targetBrightness, durationMs);
+    fadeBacklight(targetBrightness, durationMs);
+  }
+
+  bool backlightFadeDone()
+  {
+    return !backlightFading;
   }
 
   // Set backlight to specific brightness instantly
@@ -213,654 +476,422 @@ public:
 
   void resetProgressBar()
   {
-    // Reset static variables in displayTrackProgress
-    // This will be called via a flag check in displayTrackProgress
-    progressBarNeedsReset = true;
+    // Redrawn in full on the next displayTrackProgress
+    progressBar.reset();
+    elapsedLabel.reset();
+    durationLabel.reset();
+    shownDuration = -1;
+  }
+
+  void setupTimeLabels()
+  {
+    setFont(1); // Small font for time
+    int fontHeight = tft.fontHeight();
+    int barBottom = screenHeight - PROGRESS_BAR_MARGIN_FROM_BOTTOM;
+
+    // Ensure enough spacing so the labels don't touch the progress bar
+    int minGap = 4; // Minimum gap between progress bar and time labels
+    int timeY = barBottom + fontHeight + minGap; // Baseline, below the bar
+
+    // Cells start above the text baseline, but never overlap the bar
+    int labelTop = timeY - fontHeight + 2;
+    if (labelTop < barBottom)
+    {
+      labelTop = barBottom;
+    }
+
+    timeDigits.begin(FS9, tft.color565(180, 180, 180), TFT_BLACK, timeY - labelTop, fontHeight + 4); // Light gray text
+    elapsedLabel.begin(PROGRESS_BAR_PADDING, labelTop, false, TFT_BLACK);
+    durationLabel.begin(screenWidth - PROGRESS_BAR_PADDING, labelTop, true, TFT_BLACK);
   }
   
   void showDefaultScreen()
   {
+    titleMarquee.stop();
     tft.fillScreen(TFT_BLACK);
+    damage.reset();
     resetProgressBar();
   }
 
-  // Helper function to format milliseconds to MM:SS format
-  String formatTime(long milliseconds)
+  // Places the art, the gap after it and the text for the current art size.
+  // If they move, whatever the old layout covered is cleared on the next flush.
+  void updateLayout()
   {
-    long totalSeconds = milliseconds / 1000;
-    int minutes = totalSeconds / 60;
-    int seconds = totalSeconds % 60;
-    
-    String result = "";
-    if (minutes < 10) result += "0";
-    result += String(minutes);
-    result += ":";
-    if (seconds < 10) result += "0";
-    result += String(seconds);
-    
-    return result;
-  }
+    if (imageArea.w == imageWidth && imageArea.h == imageHeight)
+    {
+      return;
+    }
+    if (!imageArea.empty())
+    {
+      damage.markDirty(imageArea.x, imageArea.y, screenWidth - imageArea.x, imageArea.h);
+    }
 
-  // Create a smooth gradient color between two colors
-  uint16_t interpolateColor(uint16_t color1, uint16_t color2, float ratio)
-  {
-    // Extract RGB components from 565 format
-    uint8_t r1 = (color1 >> 11) & 0x1F;
-    uint8_t g1 = (color1 >> 5) & 0x3F;
-    uint8_t b1 = color1 & 0x1F;
-    
-    uint8_t r2 = (color2 >> 11) & 0x1F;
-    uint8_t g2 = (color2 >> 5) & 0x3F;
-    uint8_t b2 = color2 & 0x1F;
-    
-    // Interpolate
-    uint8_t r = r1 + (r2 - r1) * ratio;
-    uint8_t g = g1 + (g2 - g1) * ratio;
-    uint8_t b = b1 + (b2 - b1) * ratio;
-    
-    // Recombine into 565 format
-    return (r << 11) | (g << 5) | b;
+    imageArea = {imageMarginLeft, imageMarginTop, imageWidth, imageHeight};
+    gapArea = {imageArea.x + imageArea.w, imageMarginTop, textMarginLeft, imageHeight};
+    textArea = {gapArea.x + gapArea.w, imageMarginTop, screenWidth - (gapArea.x + gapArea.w), imageHeight};
+
+    // Text starts slightly above the middle of the image, 10px from the right edge
+    textStartX = textArea.x;
+    textStartY = imageMarginTop + imageHeight / 2 - 25;
+    textWidth = textArea.w - 10;
+    trackTextValid = false; // Laid out for the old width
   }
 
-  void displayTrackProgress(long progress, long duration)
+  // Clears what the redraw left dirty and sends the lot
+  void endFrame()
   {
-    float percentage = ((float)progress / (float)duration) * 100;
-    int clampedPercentage = (int)percentage;
-    
-    // Enhanced progress bar dimensions and positioning
-    int barHeight = 8; // Thicker bar for better visibility
-    int barPadding = 25;
-    int barMarginFromBottom = 45; // More space for time labels
-    int progressStartY = screenHeight - barHeight - barMarginFromBottom;
-    int barWidth = screenWidth - (barPadding * 2);
-    int barRadius = 4; // Smooth rounded corners (scaled with height)
-    
-    // Calculate the actual drawable area (accounting for border)
-    int maxDrawableWidth = barWidth - 2;
-    
-    // Map percentage to the drawable area so 100% reaches the edge
-    int filledWidth = map(clampedPercentage, 0, 100, 0, maxDrawableWidth);
-    
-    // Ensure minimum width for visibility when progress > 0
-    if (filledWidth > 0 && filledWidth < barRadius * 2)
-    {
-      filledWidth = barRadius * 2;
-    }
+    damage.endFrame();
+    displayList.run(true);
 
-    // Define modern gradient colors (white gradient)
-    uint16_t gradientStart = tft.color565(255, 255, 255); // Pure white
-    uint16_t gradientEnd = tft.color565(220, 220, 220);   // Light gray
-    uint16_t trackBgColor = tft.color565(40, 40, 40);     // Dark gray for unfilled portion
-    uint16_t trackBorderColor = tft.color565(60, 60, 60); // Subtle border
-    
-    // Track last filled width to avoid redrawing the entire bar
-    static int lastFilledWidth = -1;
-    static bool barInitialized = false;
-    
-    // Reset bar if needed (e.g., new song or screen clear)
-    if (progressBarNeedsReset)
+    if (trackTitleRenderUs > 0)
     {
-      barInitialized = false;
-      lastFilledWidth = -1;
-      progressBarNeedsReset = false;
+      Serial.print(smoothFontFor(2) != NULL ? "Title drawn with NotoSans in " : "Title drawn with FreeSans in ");
+      Serial.print(trackTitleRenderUs);
+      Serial.println("us");
+      trackTitleRenderUs = 0;
     }
-    
-    // Only draw the bar structure once or when explicitly needed
-    if (!barInitialized)
+  }
+
+  void printStats()
+  {
+    displayList.printStats();
+  }
+
+  // Baseline of the time labels below the progress bar (uses the small font)
+  int timeLabelBaseline()
+  {
+    int minGap = 4; // Minimum gap between progress bar and time labels
+    setFont(1);
+    return screenHeight - PROGRESS_BAR_MARGIN_FROM_BOTTOM + tft.fontHeight() + minGap;
+  }
+
+  // Area the volume label is drawn in, centred between the time labels
+  void volumeLabelArea(int &x, int &y, int &w, int &h)
+  {
+    int labelY = timeLabelBaseline();
+    GlyphMetrics &metrics = fontMetrics(1);
+    int fontHeight = metrics.lineHeight();
+    w = measureText(metrics, "Vol 100%", strlen("Vol 100%")) + 8;
+    h = fontHeight + 4;
+    x = screenCenterX - w / 2;
+    y = labelY - fontHeight + 2;
+  }
+
+  void showVolume(int volume)
+  {
+    int x, y, w, h;
+    volumeLabelArea(x, y, w, h);
+    damage.markDirty(x, y, w, h);
+
+    char label[12];
+    int length = sprintf(label, "Vol %d%%", volume);
+    int labelWidth = measureText(fontMetrics(1), label, length);
+    drawText(1, screenCenterX - labelWidth / 2, timeLabelBaseline(), label, length, TFT_WHITE);
+    damage.endFrame(false);
+    displayList.run();
+
+    volumeShownAt = millis() | 1; // Never 0 while shown
+  }
+
+  void hideVolumeIfExpired()
+  {
+    if (volumeShownAt != 0 && millis() - volumeShownAt > VOLUME_LABEL_DURATION)
     {
-      // Draw subtle border/shadow effect
-      tft.fillRoundRect(barPadding, progressStartY, barWidth, barHeight, barRadius, trackBorderColor);
-      
-      // Draw background track (unfilled portion)
-      tft.fillRoundRect(barPadding + 1, progressStartY + 1, maxDrawableWidth, barHeight - 2, barRadius - 1, trackBgColor);
-      
-      barInitialized = true;
-      lastFilledWidth = -1; // Force redraw of filled portion
+      int x, y, w, h;
+      volumeLabelArea(x, y, w, h);
+      damage.markDirty(x, y, w, h);
+      damage.endFrame(false);
+      displayList.run();
+      volumeShownAt = 0;
     }
-    
-    // Only update filled portion if width has changed significantly (reduce micro-updates)
-    if (abs(filledWidth - lastFilledWidth) >= 1)
-    {
-      // If the bar got smaller, clear the old filled area first
-      if (filledWidth < lastFilledWidth)
-      {
-        int clearWidth = lastFilledWidth - filledWidth;
-        int clearStartX = barPadding + 1 + filledWidth;
-        tft.fillRect(clearStartX, progressStartY + 1, clearWidth, barHeight - 2, trackBgColor);
-      }
-      
-      // Draw filled portion with gradient effect
-      if (filledWidth > 0)
-      {
-        // Draw gradient-filled progress bar
-        // Create vertical gradient effect
-        for (int y = 0; y < barHeight - 2; y++)
-        {
-          float gradientRatio = (float)y / (barHeight - 2);
-          uint16_t lineColor = interpolateColor(gradientStart, gradientEnd, gradientRatio);
-          
-          // Draw horizontal line with proper rounded corner masking
-          int lineY = progressStartY + 1 + y;
-          
-          // Calculate the width for this line considering rounded corners
-          int lineStartX = barPadding + 1;
-          int lineWidth = filledWidth;
-          
-          // Simple rounded corner approximation
-          if (y < barRadius - 1)
-          {
-            int cornerOffset = barRadius - 1 - y;
-            lineStartX += cornerOffset;
-            lineWidth -= cornerOffset * 2;
-            if (lineWidth < 0) lineWidth = 0;
-          }
-          else if (y >= barHeight - 2 - (barRadius - 1))
-          {
-            int cornerOffset = y - (barHeight - 2 - barRadius + 1);
-            lineStartX += cornerOffset;
-            lineWidth -= cornerOffset * 2;
-            if (lineWidth < 0) lineWidth = 0;
-          }
-          
-          if (lineWidth > 0)
-          {
-            tft.drawFastHLine(lineStartX, lineY, lineWidth, lineColor);
-          }
-        }
-        
-        // Add subtle highlight on top edge for glossy effect
-        uint16_t highlightColor = tft.color565(255, 255, 255); // Bright white highlight
-        if (filledWidth > barRadius * 2)
-        {
-          tft.drawFastHLine(barPadding + barRadius, progressStartY + 1, filledWidth - barRadius * 2, highlightColor);
-        }
-      }
-      
-      lastFilledWidth = filledWidth;
-    }
-    
-    // Display time labels below progress bar - only update when time changes
-    static String lastCurrentTime = "";
-    static String lastTotalTime = "";
-    
-    String currentTime = formatTime(progress);
-    String totalTime = formatTime(duration);
-    
-    // Only redraw time if it has changed (reduces flashing)
-    if (currentTime != lastCurrentTime || totalTime != lastTotalTime)
+  }
+
+  void displayTrackProgress(long progress, long duration)
+  {
+    // Only the columns around the end of the fill are redrawn
+    progressBar.update(progress, duration);
+
+    // Only the digits that changed are pushed
+    elapsedLabel.show(progress);
+    if (duration != shownDuration)
     {
-      setFont(1); // Small font for time
-      int fontHeight = tft.fontHeight();
-      
-      // Ensure enough spacing so clear area doesn't touch progress bar
-      int minGap = 4; // Minimum gap between progress bar and time labels
-      int timeY = progressStartY + barHeight + fontHeight + minGap; // Position below the bar
-      
-      // Calculate proper clear area based on actual font metrics
-      // Clear area starts above the text baseline
-      int clearStartY = timeY - fontHeight + 2; // Start above baseline
-      int clearHeight = fontHeight + 4; // Ensure full height coverage
-      
-      // Verify clear area doesn't overlap with progress bar
-      if (clearStartY < progressStartY + barHeight)
-      {
-        clearStartY = progressStartY + barHeight; // Adjust to not overlap
-      }
-      
-      // Left side - current time area (clear wider area to handle all digits)
-      int currentTimeWidth = tft.textWidth("88:88") + 8; // Use widest digits for clearing
-      tft.fillRect(barPadding, clearStartY, currentTimeWidth, clearHeight, TFT_BLACK);
-      
-      // Right side - total time area
-      int totalTimeWidth = tft.textWidth("88:88") + 8;
-      tft.fillRect(screenWidth - barPadding - totalTimeWidth, clearStartY, totalTimeWidth, clearHeight, TFT_BLACK);
-      
-      tft.setTextColor(tft.color565(180, 180, 180), TFT_BLACK); // Light gray text
-      
-      // Display current time (left aligned)
-      tft.setCursor(barPadding, timeY);
-      tft.print(currentTime);
-      
-      // Display total duration (right aligned)
-      int actualTotalWidth = tft.textWidth(totalTime.c_str());
-      tft.setCursor(screenWidth - barPadding - actualTotalWidth, timeY);
-      tft.print(totalTime);
-      
-      // Update last displayed values
-      lastCurrentTime = currentTime;
-      lastTotalTime = totalTime;
+      durationLabel.show(duration);
+      shownDuration = duration;
     }
+    displayList.run();
   }
 
   // ============================================================================================
   // FONT CONFIGURATION
   // ============================================================================================
-  // Using FreeSans bitmap fonts with smooth anti-aliased rendering
-  // SMOOTH_FONT flag in platformio.ini enables anti-aliasing for smoother appearance
-  // FreeSans fonts are clean sans-serif fonts without sharp edges
-  // Available sizes: 9pt, 12pt, 18pt, 24pt (regular and bold)
+  // Track text is drawn with the NotoSans smooth fonts from data/ (NotoSans-20
+  // for the title, NotoSans-16 for the details), anti-aliased and held in RAM,
+  // see loadCustomFonts(). SMOOTH_FONT in platformio.ini has to be set for them.
+  // They are drawn by drawText() through the display list, setFont() still
+  // picks FreeSans. FreeSans bitmap fonts lay out and draw the track text when
+  // a VLW file is missing or over SMOOTH_FONT_RAM_BUDGET, and draw the setup
+  // screens. NotoSans-28 is shipped but not loaded: nothing is drawn at that
+  // size (font 6 is unused), so it would only take RAM.
+  // FreeSans sizes: 9pt, 12pt, 18pt, 24pt (regular and bold)
   // 
   // ENABLE_CHAR_REPLACEMENT: Fallback for special characters not in ASCII
   // ============================================================================================
   const bool ENABLE_CHAR_REPLACEMENT = true; // Fallback replacement for missing glyphs
   
   // Helper function to replace unsupported Unicode characters with ASCII equivalents
-  String replaceUnsupportedChars(const char* text)
+  // Writes into out (size bytes) in one pass, returns the length written
+  size_t replaceUnsupportedChars(const char* text, char* out, size_t size)
   {
-    if (!ENABLE_CHAR_REPLACEMENT) return String(text);
-    
-    String result = String(text);
-    
-    // Polish characters
-    result.replace("ł", "l"); // U+0142
-    result.replace("Ł", "L"); // U+0141
-    result.replace("ą", "a"); // U+0105
-    result.replace("Ą", "A"); // U+0104
-    result.replace("ć", "c"); // U+0107
-    result.replace("Ć", "C"); // U+0106
-    result.replace("ę", "e"); // U+0119
-    result.replace("Ę", "E"); // U+0118
-    result.replace("ń", "n"); // U+0144
-    result.replace("Ń", "N"); // U+0143
-    result.replace("ó", "o"); // U+00F3 (actually in Latin-1, should work)
-    result.replace("Ó", "O"); // U+00D3
-    result.replace("ś", "s"); // U+015B
-    result.replace("Ś", "S"); // U+015A
-    result.replace("ź", "z"); // U+017A
-    result.replace("Ź", "Z"); // U+0179
-    result.replace("ż", "z"); // U+017C
-    result.replace("Ż", "Z"); // U+017B
-    
-    // Czech characters
-    result.replace("ř", "r");
-    result.replace("Ř", "R");
-    result.replace("č", "c");
-    result.replace("Č", "C");
-    result.replace("š", "s");
-    result.replace("Š", "S");
-    result.replace("ž", "z");
-    result.replace("Ž", "Z");
-    result.replace("ů", "u");
-    result.replace("Ů", "U");
-    result.replace("ě", "e");
-    result.replace("Ě", "E");
-    
-    // Other common characters
-    result.replace("ğ", "g"); // Turkish
-    result.replace("Ğ", "G");
-    result.replace("ş", "s");
-    result.replace("Ş", "S");
-    result.replace("İ", "I");
-    result.replace("ı", "i");
-    
-    return result;
+    if (text == NULL) text = "";
+    if (ENABLE_CHAR_REPLACEMENT)
+    {
+      return transliterate(text, out, size);
+    }
+
+    // Copy as is, without cutting a character in half
+    size_t length = strlen(text);
+    if (length >= size)
+    {
+      length = size - 1;
+      while (length > 0 && (text[length] & 0xC0) == 0x80)
+      {
+        length--;
+      }
+    }
+    memcpy(out, text, length);
+    out[length] = '\0';
+    return length;
   }
 
-  // Initialize font system (now using built-in FreeSans fonts)
+  // Load the NotoSans smooth fonts from SPIFFS into RAM, whatever doesn't load
+  // (missing file, over budget) keeps using its FreeSans font
   void loadCustomFonts()
   {
-    Serial.println("Using FreeSans smooth bitmap fonts with anti-aliasing");
-    // No need to load fonts from SPIFFS - FreeSans fonts are built into TFT_eSPI library
+    size_t budget = SMOOTH_FONT_RAM_BUDGET;
+    if (budget > 0 && titleSmoothFont.load("/NotoSans-20.vlw", budget))
+    {
+      budget -= titleSmoothFont.memoryUsed();
+    }
+    if (budget > 0 && detailSmoothFont.load("/NotoSans-16.vlw", budget))
+    {
+      budget -= detailSmoothFont.memoryUsed();
+    }
+
+    Serial.print("Smooth fonts loaded, bytes used: ");
+    Serial.println(SMOOTH_FONT_RAM_BUDGET - budget);
+    trackTextValid = false; // Widths changed
+  }
+
+  // The loaded smooth font for a font number, or NULL to use FreeSans
+  SmoothFont *smoothFontFor(int font)
+  {
+    SmoothFont *smooth = font == 2 ? &titleSmoothFont : font == 1 ? &detailSmoothFont : NULL;
+    return smooth != NULL && smooth->loaded() ? smooth : NULL;
   }
 
-  // Helper function to set FreeSans fonts with smooth rendering
-  void setFont(int font)
+  // Glyph widths for laying out text in a font number
+  GlyphMetrics &fontMetrics(int font)
   {
-    // Map font sizes to FreeSans fonts
-    // TFT_eSPI's SMOOTH_FONT flag provides anti-aliasing for smoother appearance
-    switch(font)
+    SmoothFont *smooth = smoothFontFor(font);
+    if (smooth != NULL)
     {
-      case 1: // Regular text (artist/album)
-        tft.setFreeFont(FS9); // FreeSans 9pt regular - clean and readable
-        break;
-      case 2: // Bold text (song title)
-        tft.setFreeFont(FSB12); // FreeSansBold 12pt - larger and bold
-        break;
-      case 4: // Config messages
-        tft.setFreeFont(FSB9); // FreeSansBold 9pt
-        break;
-      case 6: // Large text (if needed)
-        tft.setFreeFont(FSB18); // FreeSansBold 18pt - smooth and bold
-        break;
-      default:
-        tft.setFreeFont(FSB9); // Default to 9pt bold
-        break;
+      return *smooth;
     }
+    return font == 2 ? titleGfxMetrics : detailGfxMetrics;
   }
 
-  // Helper function to count lines needed for text (UTF-8 aware)
-  int countTextLines(const char* text, int maxWidth, int font)
+  // Prints length bytes of text in a font number with the baseline at y,
+  // on the black background. Returns the x after the text. The text is
+  // recorded in the display list, it appears when the list runs.
+  int drawText(int font, int x, int y, const char *text, int length, uint16_t color)
   {
-    setFont(font);
-    String textStr = String(text);
-    int textLen = strlen(text); // Use strlen for byte count, not character count
-    
-    // If text fits in one line, return 1
-    if (tft.textWidth(text) <= maxWidth)
+    SmoothFont *smooth = smoothFontFor(font);
+    int width = measureText(fontMetrics(font), text, length);
+    if (smooth != NULL)
     {
-      return 1;
+      // The text box is drawn with its background, a pixel wider each side
+      damage.painted(x - 1, y - smooth->ascent(), width + 2, smooth->lineHeight());
     }
-    
-    // Count lines by checking word boundaries
-    int lines = 1;
-    int currentLineWidth = 0;
-    int wordStart = 0;
-    int spaceWidth = tft.textWidth(" ");
-    
-    for (int i = 0; i <= textLen; i++)
+    else
     {
-      if (i == textLen || text[i] == ' ' || text[i] == '\0')
-      {
-        if (i > wordStart)
-        {
-          String word = textStr.substring(wordStart, i);
-          int wordWidth = tft.textWidth(word.c_str());
-          int totalWidth = currentLineWidth;
-          
-          if (currentLineWidth > 0)
-          {
-            totalWidth += spaceWidth + wordWidth;
-          }
-          else
-          {
-            totalWidth = wordWidth;
-          }
-          
-          if (totalWidth > maxWidth && currentLineWidth > 0)
-          {
-            lines++;
-            currentLineWidth = wordWidth;
-          }
-          else
-          {
-            currentLineWidth = totalWidth;
-          }
-        }
-        wordStart = i + 1;
-      }
+      // FreeSans only draws the glyphs, so the background has to be cleared first
+      damage.flush();
     }
-    
-    return lines;
+    displayList.text(font, x, y, text, length, width, color);
+    return x + width;
   }
 
-  // Helper function to truncate text to fit exactly 1 line with "..." if needed
-  String truncateToOneLine(const char* text, int maxWidth, int font)
+  // Draws text for the display list, inside its transaction
+  void paintText(uint8_t font, int x, int y, const char *text, int length, uint16_t color)
   {
-    setFont(font);
-    String textStr = String(text);
-    
-    // If text fits in one line, return as is
-    if (tft.textWidth(text) <= maxWidth)
+    unsigned long start = micros();
+    SmoothFont *smooth = smoothFontFor(font);
+    if (smooth != NULL)
     {
-      return textStr;
+      smooth->drawText(tft, x, y, text, length, color, TFT_BLACK);
     }
-    
-    // Need to truncate and add "..."
-    String ellipsis = "...";
-    int ellipsisWidth = tft.textWidth(ellipsis.c_str());
-    int textLen = textStr.length();
-    
-    // Binary search for the right truncation point
-    int left = 0;
-    int right = textLen;
-    String bestResult = ellipsis;
-    
-    while (left <= right)
+    else
     {
-      int mid = (left + right) / 2;
-      String testStr = textStr.substring(0, mid) + ellipsis;
-      int testWidth = tft.textWidth(testStr.c_str());
-      
-      if (testWidth <= maxWidth)
-      {
-        bestResult = testStr;
-        left = mid + 1; // Try to include more characters
-      }
-      else
-      {
-        right = mid - 1; // Need fewer characters
-      }
+      setFont(font);
+      tft.setTextColor(color, TFT_BLACK);
+      tft.setTextWrap(false);
+      tft.setCursor(x, y);
+      tft.write((const uint8_t *)text, length);
     }
-    
-    // Ensure we don't break words - find the last space before the truncation point
-    int truncatePos = bestResult.length() - ellipsis.length();
-    if (truncatePos > 0)
+    if (font == 2)
     {
-      int lastSpace = textStr.lastIndexOf(' ', truncatePos);
-      if (lastSpace > truncatePos * 0.7) // Only use space if it's not too far back
-      {
-        bestResult = textStr.substring(0, lastSpace) + ellipsis;
-      }
+      trackTitleRenderUs += micros() - start;
     }
-    
-    return bestResult;
   }
 
-  // Helper function to truncate text to fit exactly 2 lines with "..." if needed (UTF-8 aware)
-  String truncateToTwoLines(const char* text, int maxWidth, int font)
+  // FreeSans font used for each font number
+  const GFXfont *fontFor(int font)
   {
-    setFont(font);
-    String textStr = String(text);
-    String ellipsis = "...";
-    
-    // If text fits in 1 line, return as is
-    if (tft.textWidth(text) <= maxWidth)
+    switch(font)
     {
-      return textStr;
+      case 1: // Regular text (artist/album)
+        return FS9; // FreeSans 9pt regular - clean and readable
+      case 2: // Bold text (song title)
+        return FSB12; // FreeSansBold 12pt - larger and bold
+      case 4: // Config messages
+        return FSB9; // FreeSansBold 9pt
+      case 6: // Large text (if needed)
+        return FSB18; // FreeSansBold 18pt - smooth and bold
+      default:
+        return FSB9; // Default to 9pt bold
     }
-    
-    // Text needs multiple lines - use conservative approach
-    // Reduce effective width by 10% to prevent overflow at boundaries
-    int safeMaxWidth = maxWidth * 0.90;
-    int textLen = textStr.length();
-    
-    // Binary search for the right truncation point
-    int left = 0;
-    int right = textLen;
-    String bestResult = ellipsis;
-    
-    while (left <= right)
+  }
+
+  // Selects the FreeSans font for a font number, for text drawn with tft
+  // directly. NotoSans goes through drawText() instead.
+  void setFont(int font)
+  {
+    tft.setFreeFont(fontFor(font));
+  }
+
+  // Lays out the title, artists and album of a track. The result is kept
+  // until the track changes, redraws of the same track reuse it.
+  void layoutTrackText(CurrentlyPlaying &currentlyPlaying, int maxWidth)
+  {
+    const char *trackUri = currentlyPlaying.trackUri != NULL ? currentlyPlaying.trackUri : "";
+    if (trackTextValid && strcmp(trackTextUri, trackUri) == 0)
     {
-      int mid = (left + right) / 2;
-      String testStr = textStr.substring(0, mid) + ellipsis;
-      int testLines = countTextLines(testStr.c_str(), safeMaxWidth, font);
-      
-      if (testLines <= 2)
-      {
-        bestResult = testStr;
-        left = mid + 1; // Try to include more characters
-      }
-      else
-      {
-        right = mid - 1; // Need fewer characters
-      }
+      trackTextHits++;
+      return;
     }
-    
-    // Ensure we don't break words - find the last space before the truncation point
-    int truncatePos = bestResult.length() - ellipsis.length();
-    if (truncatePos > 0)
+
+    unsigned long start = micros();
+    GlyphMetrics &titleMetrics = fontMetrics(2);
+    GlyphMetrics &detailMetrics = fontMetrics(1);
+
+    replaceUnsupportedChars(currentlyPlaying.trackName, trackTitle.text, sizeof(trackTitle.text));
+    layoutText(trackTitle, titleMetrics, maxWidth, 2);
+
+    // All artists, separated by ", " and " & " before the last one
+    size_t used = 0;
+    trackArtists.text[0] = '\0';
+    for (int i = 0; i < currentlyPlaying.numArtists; i++)
     {
-      int lastSpace = textStr.lastIndexOf(' ', truncatePos);
-      if (lastSpace > truncatePos * 0.7) // Only use space if it's not too far back
+      if (i > 0)
       {
-        bestResult = textStr.substring(0, lastSpace) + ellipsis;
+        const char *separator = i == currentlyPlaying.numArtists - 1 ? " & " : ", ";
+        used += replaceUnsupportedChars(separator, trackArtists.text + used, sizeof(trackArtists.text) - used);
       }
+      used += replaceUnsupportedChars(currentlyPlaying.artists[i].artistName, trackArtists.text + used, sizeof(trackArtists.text) - used);
     }
-    
-    return bestResult;
+    layoutText(trackArtists, detailMetrics, maxWidth, 2);
+
+    replaceUnsupportedChars(currentlyPlaying.albumName, trackAlbum.text, sizeof(trackAlbum.text));
+    layoutText(trackAlbum, detailMetrics, maxWidth, 2);
+
+    strncpy(trackTextUri, trackUri, sizeof(trackTextUri) - 1);
+    trackTextUri[sizeof(trackTextUri) - 1] = '\0';
+    trackTextValid = true;
+    trackTextLayoutUs = micros() - start;
   }
 
-  // Helper function to print text with manual wrapping that respects vertical bounds
-  void printTextWithBounds(int x, int y, const char* text, int maxWidth, int maxY, int font)
+  // Prints the lines of a block from baseline y, leaving out any line that
+  // would end below maxY. Returns the y below the last line.
+  int printTextBlock(TextBlock &block, int x, int y, int maxY, int font)
   {
-    setFont(font);
-    tft.setTextColor(TFT_WHITE, TFT_BLACK);
-    tft.setTextWrap(false); // Disable automatic wrapping - we handle it manually
-    
-    String textStr = String(text);
-    int fontHeight = tft.fontHeight();
-    int currentY = y;
-    int currentX = x;
-    
-    // FreeSans fonts handle positioning correctly with their baseline
-    
-    // Split text into words and print line by line
-    int wordStart = 0;
-    int textLen = textStr.length();
-    String currentLine = "";
-    
-    for (int i = 0; i <= textLen; i++)
+    for (int i = 0; i < block.lineCount; i++)
     {
-      if (i == textLen || textStr[i] == ' ' || textStr[i] == '\0')
+      TextLine &line = block.lines[i];
+      if (y + (i + 1) * block.lineHeight > maxY)
       {
-        if (i > wordStart)
-        {
-          String word = textStr.substring(wordStart, i);
-          String testLine = currentLine;
-          if (testLine.length() > 0)
-          {
-            testLine += " ";
-          }
-          testLine += word;
-          
-          int testWidth = tft.textWidth(testLine.c_str());
-          
-          // Check if line fits
-          if (testWidth > maxWidth && currentLine.length() > 0)
-          {
-            // Print current line and move to next
-            tft.setCursor(currentX, currentY);
-            tft.print(currentLine);
-            
-            currentY += fontHeight;
-            
-            // Check if we've exceeded vertical bounds
-            if (currentY + fontHeight > maxY)
-            {
-              return; // Stop printing
-            }
-            
-            currentLine = word; // Start new line with current word
-          }
-          else
-          {
-            currentLine = testLine;
-          }
-        }
-        wordStart = i + 1;
+        break;
+      }
+      int lineY = y + i * block.lineHeight;
+      int endX = drawText(font, x, lineY, block.text + line.start, line.length, TFT_WHITE);
+      if (line.ellipsis)
+      {
+        drawText(font, endX, lineY, TEXT_LAYOUT_ELLIPSIS, strlen(TEXT_LAYOUT_ELLIPSIS), TFT_WHITE);
       }
     }
-    
-    // Print the last line if there's anything left
-    if (currentLine.length() > 0 && currentY + fontHeight <= maxY)
-    {
-      tft.setCursor(currentX, currentY);
-      tft.print(currentLine);
-    }
+    return y + block.lineCount * block.lineHeight;
   }
 
   void printCurrentlyPlayingToScreen(CurrentlyPlaying currentlyPlaying)
   {
-    // Image positioning constants - moved right and down
-    int imageMarginLeft = 20; // Increased from 10 to move right
-    int imageMarginTop = 20;  // Increased from 10 to move down
-    int textMarginLeft = 10;  // Margin between image and text
-    
-    // Calculate text position - to the right of the image, aligned with middle of image
-    int textStartX = imageMarginLeft + imageWidth + textMarginLeft;
-    int imageMiddleY = imageMarginTop + (imageHeight / 2);
-    int textStartY = imageMiddleY - 25; // Start text slightly above middle for better vertical centering
-    
-    // Calculate available width for text (screen width minus text start X and right margin)
-    int textWidth = screenWidth - textStartX - 10; // 10px margin on right
-    
     // Limit text area to not go under the image (max height = image height)
-    int maxTextHeight = imageHeight;
-    int textAreaEndY = imageMarginTop + maxTextHeight;
+    int textAreaEndY = textArea.y + textArea.h;
     
-    // Clear the text area (from right of image to end of screen, but limited to image height)
-    // Also clear a small strip to the right of image to remove any white artifacts
-    tft.fillRect(imageMarginLeft + imageWidth, imageMarginTop, textMarginLeft, maxTextHeight, TFT_BLACK);
-    tft.fillRect(textStartX, imageMarginTop, screenWidth - textStartX, maxTextHeight, TFT_BLACK);
+    // The old title stops scrolling before its area is cleared
+    titleMarquee.stop();
 
-    // Set text color to white for all text
-    tft.setTextColor(TFT_WHITE, TFT_BLACK);
-    
-    // Draw title (song name) - use bold font, limited to 2 lines max with truncation
-    setFont(2);  // Bold 9pt for track title
-    int titleFontHeight = tft.fontHeight();
-    int titleStartY = textStartY;
-    
-    // Replace unsupported characters and truncate title to 2 lines max with "..." if needed
-    String trackName = replaceUnsupportedChars(currentlyPlaying.trackName);
-    String titleText = truncateToTwoLines(trackName.c_str(), textWidth, 2);
-    
-    // Calculate actual number of lines used by title
-    int actualTitleLines = countTextLines(titleText.c_str(), textWidth, 2);
-    if (actualTitleLines > 2) actualTitleLines = 2; // Cap at 2
-    
-    // Print title with bounds checking (max 2 lines)
-    int titleMaxY = textAreaEndY;
-    printTextWithBounds(textStartX, titleStartY, titleText.c_str(), textWidth, titleMaxY, 2);
-    
-    // Calculate Y position for artist (title height + spacing) - use actual lines, not always 2
+    // Whatever the new text doesn't draw over is cleared at the end of the frame
+    damage.markDirty(textArea.x, textArea.y, textArea.w, textArea.h);
+
+    // Title, artists and album are each at most 2 lines, cut with "..."
+    layoutTrackText(currentlyPlaying, textWidth);
+
+    // Draw title (song name) - use bold font, on one scrolling line if it's too long for one
     int titleSpacing = 8; // Reduced spacing
-    int currentY = titleStartY + (actualTitleLines * titleFontHeight) + titleSpacing;
-    
-    // Draw artist - use regular (non-bold) font
-    setFont(1);  // Regular 9pt for artist/album
-    int artistFontHeight = tft.fontHeight();
+    int currentY;
+    SmoothFont *titleFont = smoothFontFor(2);
+    if (MARQUEE_ENABLED && titleFont != NULL && titleMarquee.scrolls(*titleFont, trackTitle.text, textWidth) &&
+        startTitleMarquee(*titleFont))
+    {
+      currentY = textStartY + trackTitle.lineHeight + titleSpacing;
+    }
+    else
+    {
+      currentY = printTextBlock(trackTitle, textStartX, textStartY, textAreaEndY, 2) + titleSpacing;
+    }
+    trackTitleRenderUs = 0; // Added up by paintText() when the list runs
     
-    // Check if we have room for artist (at least one line)
-    if (currentY + artistFontHeight < textAreaEndY)
+    // Draw artist and album - use regular (non-bold) font, if there is room for a line
+    int artistSpacing = 8; // Reduced spacing
+    if (currentY + trackArtists.lineHeight < textAreaEndY)
     {
-      int artistStartY = currentY;
-      
-      // Build artist string with all artists (separated by ", " or " & " for last one)
-      String allArtists = "";
-      for (int i = 0; i < currentlyPlaying.numArtists; i++)
+      currentY = printTextBlock(trackArtists, textStartX, currentY, textAreaEndY, 1) + artistSpacing;
+      if (currentY + trackAlbum.lineHeight < textAreaEndY)
       {
-        if (i > 0)
-        {
-          if (i == currentlyPlaying.numArtists - 1)
-          {
-            allArtists += " & ";
-          }
-          else
-          {
-            allArtists += ", ";
-          }
-        }
-        // Replace unsupported characters in artist name
-        allArtists += replaceUnsupportedChars(currentlyPlaying.artists[i].artistName);
-      }
-      
-      // Truncate artist to 2 lines max with "..." if needed
-      String artistText = truncateToTwoLines(allArtists.c_str(), textWidth, 1);
-      
-      // Calculate actual number of lines used by artist
-      int actualArtistLines = countTextLines(artistText.c_str(), textWidth, 1);
-      if (actualArtistLines > 2) actualArtistLines = 2; // Cap at 2
-      
-      // Print artist with bounds checking (max 2 lines, don't go below image)
-      int artistMaxY = textAreaEndY; // Allow artist to use remaining height
-      printTextWithBounds(textStartX, artistStartY, artistText.c_str(), textWidth, artistMaxY, 1);
-      
-      // Calculate Y position for album (artist height + spacing) - use actual lines, not always 2
-      int artistSpacing = 8; // Reduced spacing
-      currentY = artistStartY + (actualArtistLines * artistFontHeight) + artistSpacing;
-      
-      // Check if we have room for album (at least one line)
-      if (currentY + artistFontHeight < textAreaEndY)
-      {
-        // Draw album - replace unsupported characters and truncate to 2 lines
-        String albumName = replaceUnsupportedChars(currentlyPlaying.albumName);
-        String albumText = truncateToTwoLines(albumName.c_str(), textWidth, 1);
-        printTextWithBounds(textStartX, currentY, albumText.c_str(), textWidth, textAreaEndY, 1);
+        printTextBlock(trackAlbum, textStartX, currentY, textAreaEndY, 1);
       }
     }
   }
 
+  // The marquee window is drawn with its background, like the text boxes
+  bool startTitleMarquee(SmoothFont &titleFont)
+  {
+    int top = textStartY - titleFont.ascent();
+    damage.painted(textStartX - 1, top, textWidth + 1, titleFont.lineHeight());
+    if (titleMarquee.start(titleFont, trackTitle.text, textStartX, textStartY, textWidth, TFT_WHITE, TFT_BLACK))
+    {
+      return true;
+    }
+    // Out of memory, the title is printed the normal way instead
+    damage.markDirty(textStartX - 1, top, textWidth + 1, titleFont.lineHeight());
+    return false;
+  }
+
+  void animate()
+  {
+    titleMarquee.frame();
+    displayList.run();
+  }
+
   void displayFavoriteIndicator()
   {
     // Empty stub for interface compatibility
@@ -869,16 +900,16 @@ public:
   void checkForInput()
   {
     // Not used - touch input is handled via touchScreen.h if needed
+
+    // Called every loop, so this is where the volume label times out
+    hideVolumeIfExpired();
   }
 
   // Image Related
   void clearImage()
   {
-    int imageMarginLeft = 20; // Margin from left edge - moved right
-    int imageMarginTop = 20;  // Margin from top edge - moved down
-    int textMarginLeft = 10;  // Margin between image and text
-    // Clear image area and also clear the gap between image and text to prevent white bar
-    tft.fillRect(imageMarginLeft, imageMarginTop, imageWidth + textMarginLeft, imageHeight, TFT_BLACK);
+    // Only what the new art doesn't cover is actually cleared, at the end of the frame
+    damage.markDirty(imageArea.x, imageArea.y, imageArea.w + gapArea.w, imageArea.h);
   }
 
   boolean processImageInfo(CurrentlyPlaying currentlyPlaying)
@@ -893,6 +924,7 @@ public:
       // Update global image dimensions for rounded corner calculation
       currentImageWidth = imageWidth;
       currentImageHeight = imageHeight;
+      updateLayout();
       setAlbumArtUrl(currentlyPlayingMedImage.url);
       return true;
     }
@@ -900,14 +932,25 @@ public:
     return false;
   }
 
-  int displayImage()
+  int displayImage(const AlbumArt &art)
   {
-    int imageStatus = displayImageUsingFile(_albumArtUrl);
+    // The network task has already downloaded the art, to RAM if it could
+    unsigned long decodeStarted = millis();
+    int imageStatus;
+    if (art.source == ART_IN_RAM)
+    {
+      imageStatus = drawImageFromRam(art.data, art.length);
+    }
+    else
+    {
+      imageStatus = drawImagefromFile(art.path);
+    }
     Serial.print("imageStatus: ");
     Serial.println(imageStatus);
     if (imageStatus == 1)
     {
       albumDisplayed = true;
+      albumArtRecordDisplayed(art, decodeStarted);
       return imageStatus;
     }
 
@@ -917,9 +960,13 @@ public:
   void drawWifiManagerMessage(WiFiManager *myWiFiManager)
   {
     Serial.println("Entered Conf Mode");
+    titleMarquee.stop();
+    // One transaction for the whole message
+    tft.startWrite();
     tft.fillScreen(TFT_BLACK);
+    damage.reset();
     
-    // Use FreeSans smooth fonts
+    // FreeSans, there is no NotoSans at this size
     setFont(4);
     tft.setTextColor(TFT_WHITE, TFT_BLACK);
     tft.setCursor(5, 20);
@@ -942,14 +989,19 @@ public:
     tft.setCursor(20, 165);
     tft.println(WiFi.softAPIP().toString());
     tft.setTextColor(TFT_WHITE, TFT_BLACK);
+    tft.endWrite();
   }
 
   void drawRefreshTokenMessage()
   {
     Serial.println("Refresh Token Mode");
+    titleMarquee.stop();
+    // One transaction for the whole message
+    tft.startWrite();
     tft.fillScreen(TFT_BLACK);
+    damage.reset();
     
-    // Use FreeSans smooth fonts
+    // FreeSans, there is no NotoSans at this size
     setFont(4);
     tft.setTextColor(TFT_WHITE, TFT_BLACK);
     tft.setCursor(5, 20);
@@ -967,123 +1019,78 @@ public:
     tft.println(WiFi.localIP().toString());
     tft.setCursor(10, 180);
     tft.println("Port: 80");
+    tft.endWrite();
   }
 
 private:
-  int displayImageUsingFile(char *albumArtUrl)
+  int drawImagefromFile(const char *imageFileUri)
   {
+    jpeg.open((const char *)imageFileUri, myOpen, myClose, myRead, mySeek, JPEGDraw);
+    return drawOpenedImage();
+  }
 
-    // In this example I reuse the same filename
-    // over and over, maybe saving the art using
-    // the album URI as the name would be better
-    // as you could save having to download them each
-    // time, but this seems to work fine.
-    if (SPIFFS.exists(ALBUM_ART) == true)
-    {
-      Serial.println("Removing existing image");
-      SPIFFS.remove(ALBUM_ART);
-    }
-
-    fs::File f = SPIFFS.open(ALBUM_ART, "w+");
-    if (!f)
-    {
-      Serial.println("file open failed");
-      return -1;
-    }
-
-    // Spotify uses a different cert for the Image server, so we need to swap to that for the call
-    client.setCACert(spotify_image_server_cert);
-    bool gotImage = spotify_display->getImage(albumArtUrl, &f);
-
-    // Swapping back to the main spotify cert
-    client.setCACert(spotify_server_cert);
-
-    // Make sure to close the file!
-    f.close();
-
-    if (gotImage)
-    {
-      return drawImagefromFile(ALBUM_ART);
-    }
-    else
-    {
-      return -2;
-    }
+  // No flash access at all, JPEGDEC reads the download straight from RAM
+  int drawImageFromRam(uint8_t *imageData, size_t length)
+  {
+    jpeg.openRAM(imageData, length, JPEGDraw);
+    return drawOpenedImage();
   }
 
-  int drawImagefromFile(const char *imageFileUri)
+  int drawOpenedImage()
   {
     unsigned long lTime = millis();
-    lTime = millis();
-    jpeg.open((const char *)imageFileUri, myOpen, myClose, myRead, mySeek, JPEGDraw);
     jpeg.setPixelType(1);
-    int imageMarginLeft = 20; // Margin from left edge - moved right
-    int imageMarginTop = 20;  // Margin from top edge - moved down
+    jpegTransferUs = 0;
+    jpegDmaWaitUs = 0;
+    jpegDmaBlocks = 0;
+    jpegDmaBusyBlocks = 0;
+
+    // The art covers its area (JPEGDraw keeps it inside), so that isn't cleared
+    int artWidth = min(jpeg.getWidth() / 2, imageWidth);
+    int artHeight = min(jpeg.getHeight() / 2, imageHeight);
+    damage.painted(imageMarginLeft, imageMarginTop, artWidth, artHeight);
+
+    // The art is decoded straight to the panel, not through the display list,
+    // in one transaction of its own (the DMA pushes need one anyway)
+    tft.startWrite();
     // decode will return 1 on sucess and 0 on a failure
     int decodeStatus = jpeg.decode(imageMarginLeft, imageMarginTop, JPEG_SCALE_HALF);
     // jpeg.decode(45, 0, 0);
     jpeg.close();
+    if (jpegDmaEnabled)
+    {
+      tft.dmaWait();
+    }
+    tft.endWrite();
     
-    // Apply rounded corners after decoding (much faster than processing during decode)
-    if (decodeStatus == 1)
+    // The corners were already rounded by JPEGDraw. Half an image is cleared
+    // at the end of the frame rather than left on screen.
+    if (decodeStatus != 1)
     {
-      applyRoundedCorners(imageMarginLeft, imageMarginTop, imageWidth, imageHeight);
-      
-      // Clip any pixels that extend beyond the image width by drawing black rectangles
-      // on the right edge if the image rendered wider than expected
-      int imageRightEdge = imageMarginLeft + imageWidth;
-      int textMarginLeft = 10;
-      
-      // Clear the gap between image and text (this removes any white bar)
-      tft.fillRect(imageRightEdge, imageMarginTop, textMarginLeft, imageHeight, TFT_BLACK);
-      
-      // Also clear a few pixels to the right of the image edge in case of slight overflow
-      // This is a safety measure without affecting image quality
-      if (imageRightEdge < screenWidth)
-      {
-        tft.fillRect(imageRightEdge, imageMarginTop, 5, imageHeight, TFT_BLACK);
-      }
+      damage.markDirty(imageMarginLeft, imageMarginTop, artWidth, artHeight);
     }
     
     Serial.print("Time taken to decode and display Image (ms): ");
     Serial.println(millis() - lTime);
 
-    return decodeStatus;
-  }
-
-  // Fast function to apply rounded corners using horizontal line drawing
-  void applyRoundedCorners(int imgX, int imgY, int imgWidth, int imgHeight)
-  {
-    int radius = cornerRadius;
-    
-    // Pre-calculate the radius squared to avoid repeated multiplication
-    int radiusSq = radius * radius;
-    
-    // Process each row in the corner regions
-    for (int y = 0; y < radius; y++)
+    // TFT_eSPI doesn't say when a DMA transfer ends, so the SPI time is worked
+    // out from the clock. The waits and busy blocks are measured.
+    unsigned long overlapUs = jpegTransferUs > jpegDmaWaitUs ? jpegTransferUs - jpegDmaWaitUs : 0;
+    Serial.print(jpegDmaEnabled ? "DMA transfer, estimated (ms): " : "Blocking transfer, estimated (ms): ");
+    Serial.print(jpegTransferUs / 1000);
+    if (jpegDmaEnabled)
     {
-      int dy = radius - y - 1; // Adjusted for proper corner alignment
-      int dySq = dy * dy;
-      
-      // Calculate the horizontal distance using sqrt for precise corner masking
-      // xOffset represents how many pixels from the corner edge should be masked
-      int xOffset = radius - (int)(sqrt(radiusSq - dySq) + 0.5); // Round to nearest integer
-      
-      // Draw horizontal lines to mask corners (much faster than individual pixels)
-      if (xOffset > 0)
-      {
-        // Top-left corner
-        tft.drawFastHLine(imgX, imgY + y, xOffset, TFT_BLACK);
-        
-        // Top-right corner
-        tft.drawFastHLine(imgX + imgWidth - xOffset, imgY + y, xOffset, TFT_BLACK);
-        
-        // Bottom-left corner
-        tft.drawFastHLine(imgX, imgY + imgHeight - 1 - y, xOffset, TFT_BLACK);
-        
-        // Bottom-right corner
-        tft.drawFastHLine(imgX + imgWidth - xOffset, imgY + imgHeight - 1 - y, xOffset, TFT_BLACK);
-      }
+      Serial.print(", overlapped with decode, estimated (ms): ");
+      Serial.print(overlapUs / 1000);
+      Serial.print(", decoder waiting for DMA (ms): ");
+      Serial.print(jpegDmaWaitUs / 1000);
+      Serial.print(", blocks that found DMA busy: ");
+      Serial.print(jpegDmaBusyBlocks);
+      Serial.print("/");
+      Serial.print(jpegDmaBlocks);
     }
+    Serial.println();
+
+    return decodeStatus;
   }
 };
@@ -0,0 +1,101 @@
+// Per-pixel colour transform for the album art
+// Every stage here is baked into colorLut.h by tools/colorLut/colorLutGen.cpp,
+// so the display only does one table lookup per pixel. Rerun the generator
+// after changing anything in this file (it checks the table still matches).
+//
+// This file is also compiled on the host by the generator, so it may only
+// use plain C++ and constrain().
+
+#ifndef COLORPIPELINE_H
+#define COLORPIPELINE_H
+
+#include <math.h>
+#include <stdint.h>
+
+// Saturation boost amount (1.00 = no change, higher = more saturation)
+// Adjust between 1.00-1.02 for best results
+static const float saturationBoost = 1.0108; // Please dont change this i took a lot of time to find the best thing
+
+// Stages for each panel, gamma and brightness of 1.0 leave the colours alone
+struct ColorPipelineConfig
+{
+  float saturation;
+  float gamma;      // out = in ^ gamma, on 0-1 channels
+  float brightness; // Multiplier applied after gamma
+};
+
+static const ColorPipelineConfig COLOR_PIPELINE_CYD = {saturationBoost, 1.0f, 1.0f};
+static const ColorPipelineConfig COLOR_PIPELINE_CYD2USB = {saturationBoost, 1.0f, 1.0f};
+
+#ifdef CYD2USB
+static const ColorPipelineConfig &colorPipeline = COLOR_PIPELINE_CYD2USB;
+#else
+static const ColorPipelineConfig &colorPipeline = COLOR_PIPELINE_CYD;
+#endif
+
+// Function to boost saturation of an RGB565 pixel
+uint16_t boostSaturation(uint16_t pixel, float boost)
+{
+  // Extract RGB components from RGB565
+  uint8_t r5 = (pixel >> 11) & 0x1F;  // 5 bits
+  uint8_t g6 = (pixel >> 5) & 0x3F;   // 6 bits
+  uint8_t b5 = pixel & 0x1F;          // 5 bits
+
+  // Expand to 8-bit for processing (proper conversion)
+  float r = (r5 * 255.0) / 31.0;
+  float g = (g6 * 255.0) / 63.0;
+  float b = (b5 * 255.0) / 31.0;
+
+  // Calculate luminance (weighted average, more accurate than simple average)
+  float gray = 0.299 * r + 0.587 * g + 0.114 * b;
+
+  // Push each component away from gray to increase saturation
+  r = gray + (r - gray) * boost;
+  g = gray + (g - gray) * boost;
+  b = gray + (b - gray) * boost;
+
+  // Clamp to valid range
+  r = constrain(r, 0.0, 255.0);
+  g = constrain(g, 0.0, 255.0);
+  b = constrain(b, 0.0, 255.0);
+
+  // Convert back to RGB565 (proper rounding)
+  r5 = (uint8_t)((r * 31.0 / 255.0) + 0.5);
+  g6 = (uint8_t)((g * 63.0 / 255.0) + 0.5);
+  b5 = (uint8_t)((b * 31.0 / 255.0) + 0.5);
+
+  return (r5 << 11) | (g6 << 5) | b5;
+}
+
+// Gamma and brightness for one channel, value and result are 0-maxValue
+uint8_t adjustChannel(uint8_t value, uint8_t maxValue, const ColorPipelineConfig &config)
+{
+  float v = powf((float)value / maxValue, config.gamma) * config.brightness;
+  v = constrain(v, 0.0f, 1.0f);
+  return (uint8_t)(v * maxValue + 0.5f);
+}
+
+// The whole transform for one pixel as JPEGDEC hands it over (RGB565 big-endian).
+// The saturation stage works on that value as it is, exactly like JPEGDraw
+// always did, the panel stages work on the real channels.
+uint16_t colorPipelinePixel(uint16_t pixel, const ColorPipelineConfig &config)
+{
+  if (config.saturation > 1.0)
+  {
+    pixel = boostSaturation(pixel, config.saturation);
+  }
+
+  if (config.gamma != 1.0f || config.brightness != 1.0f)
+  {
+    uint16_t native = (pixel >> 8) | (pixel << 8);
+    uint8_t r5 = adjustChannel((native >> 11) & 0x1F, 31, config);
+    uint8_t g6 = adjustChannel((native >> 5) & 0x3F, 63, config);
+    uint8_t b5 = adjustChannel(native & 0x1F, 31, config);
+    native = (r5 << 11) | (g6 << 5) | b5;
+    pixel = (native >> 8) | (native << 8);
+  }
+
+  return pixel;
+}
+
+#endif
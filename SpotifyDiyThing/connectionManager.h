@@ -0,0 +1,664 @@
+// Persistent HTTPS connection handling for the hosts this project talks to
+// Keeps one keep-alive TLS connection per host (api.spotify.com, accounts.spotify.com
+// and the i.scdn.co image server), caches the DNS lookup and only reconnects when the
+// server has closed the socket. Reconnects resume the previous TLS session (see
+// tlsSessionClient.h). Every HTTP request in the project goes through here.
+
+#include <WiFi.h>
+
+#define HTTP_TIMEOUT_MS 5000              // Max time to wait for data from the server
+#define CONNECTION_IDLE_TIMEOUT_MS 50000  // Spotify drops idle sockets, reconnect before it does
+#define HTTP_DRAIN_LIMIT 4096             // Larger unread bodies are cheaper to drop with the connection
+
+enum HostId
+{
+  HOST_API,      // api.spotify.com
+  HOST_ACCOUNTS, // accounts.spotify.com
+  HOST_IMAGES,   // i.scdn.co
+  HOST_COUNT
+};
+
+struct HostConnection
+{
+  const char *hostname;
+  const char *caCert;
+  ResumableTlsClient tls;
+  IPAddress address;
+  bool addressResolved;
+  unsigned long lastUsed;
+};
+
+// Reads a response body off the connection, honouring Content-Length and
+// chunked transfer encoding so the connection can be reused afterwards.
+class HttpBodyStream : public Stream
+{
+public:
+  void begin(Client *client, long contentLength, bool chunked)
+  {
+    _client = client;
+    _remaining = chunked ? 0 : contentLength;
+    _chunked = chunked;
+    _done = !chunked && contentLength == 0;
+    _failed = false;
+    _bufferLen = 0;
+    _bufferPos = 0;
+  }
+
+  int available()
+  {
+    if (_bufferPos < _bufferLen)
+    {
+      return _bufferLen - _bufferPos;
+    }
+    return fill() ? _bufferLen : 0;
+  }
+
+  int read()
+  {
+    if (_bufferPos >= _bufferLen && !fill())
+    {
+      return -1;
+    }
+    return _buffer[_bufferPos++];
+  }
+
+  int peek()
+  {
+    if (_bufferPos >= _bufferLen && !fill())
+    {
+      return -1;
+    }
+    return _buffer[_bufferPos];
+  }
+
+  // Bulk read, returns the number of bytes copied (0 once the body is finished)
+  size_t readBody(uint8_t *dest, size_t length)
+  {
+    size_t copied = 0;
+    while (copied < length)
+    {
+      if (_bufferPos >= _bufferLen && !fill())
+      {
+        break;
+      }
+      size_t chunk = min(length - copied, _bufferLen - _bufferPos);
+      memcpy(dest + copied, _buffer + _bufferPos, chunk);
+      _bufferPos += chunk;
+      copied += chunk;
+    }
+    return copied;
+  }
+
+  size_t write(uint8_t) { return 0; }
+
+  // Throws away what is left of the body. Returns false if the connection
+  // is not in a reusable state afterwards.
+  bool drain(size_t maxBytes)
+  {
+    size_t skipped = 0;
+    while (!_done && !_failed)
+    {
+      _bufferPos = _bufferLen;
+      if (!fill())
+      {
+        break;
+      }
+      skipped += _bufferLen;
+      if (skipped > maxBytes)
+      {
+        return false;
+      }
+    }
+    return _done && !_failed;
+  }
+
+  bool finished() { return _done; }
+
+private:
+  int timedRead()
+  {
+    unsigned long start = millis();
+    while (!_client->available())
+    {
+      if (!_client->connected() || millis() - start > HTTP_TIMEOUT_MS)
+      {
+        return -1;
+      }
+      delay(1);
+    }
+    return _client->read();
+  }
+
+  // Reads a chunk-size line, returns -1 on failure
+  long readChunkSize()
+  {
+    long size = 0;
+    bool inExtension = false;
+    while (true)
+    {
+      int c = timedRead();
+      if (c < 0)
+      {
+        return -1;
+      }
+      if (c == '\n')
+      {
+        return size;
+      }
+      if (c == ';')
+      {
+        inExtension = true;
+      }
+      if (inExtension || c == '\r')
+      {
+        continue;
+      }
+
+      if (c >= '0' && c <= '9') size = size * 16 + (c - '0');
+      else if (c >= 'a' && c <= 'f') size = size * 16 + (c - 'a' + 10);
+      else if (c >= 'A' && c <= 'F') size = size * 16 + (c - 'A' + 10);
+    }
+  }
+
+  bool fill()
+  {
+    _bufferPos = 0;
+    _bufferLen = 0;
+    if (_done || _failed)
+    {
+      return false;
+    }
+
+    if (_chunked && _remaining == 0)
+    {
+      long chunkSize = readChunkSize();
+      if (chunkSize < 0)
+      {
+        _failed = true;
+        return false;
+      }
+      if (chunkSize == 0)
+      {
+        // Last chunk, skip any trailers up to the empty line
+        int lineLength = 0;
+        while (true)
+        {
+          int c = timedRead();
+          if (c < 0)
+          {
+            _failed = true;
+            return false;
+          }
+          if (c == '\n')
+          {
+            if (lineLength == 0)
+            {
+              break;
+            }
+            lineLength = 0;
+          }
+          else if (c != '\r')
+          {
+            lineLength++;
+          }
+        }
+        _done = true;
+        return false;
+      }
+      _remaining = chunkSize;
+    }
+
+    // A negative length means the body runs until the server closes the connection
+    size_t toRead = sizeof(_buffer);
+    if (_remaining >= 0 && (long)toRead > _remaining)
+    {
+      toRead = _remaining;
+    }
+
+    unsigned long start = millis();
+    int received = 0;
+    while (received <= 0)
+    {
+      if (_client->available())
+      {
+        received = _client->read(_buffer, toRead);
+      }
+      else if (!_client->connected())
+      {
+        // Closing the connection is the end of an unbounded body, anything else is a failure
+        if (_remaining < 0)
+        {
+          _done = true;
+        }
+        else
+        {
+          _failed = true;
+        }
+        return false;
+      }
+      else if (millis() - start > HTTP_TIMEOUT_MS)
+      {
+        _failed = true;
+        return false;
+      }
+      else
+      {
+        delay(1);
+      }
+    }
+
+    _bufferLen = received;
+    if (_remaining >= 0)
+    {
+      _remaining -= received;
+      if (_remaining == 0)
+      {
+        if (_chunked)
+        {
+          // Each chunk is followed by CRLF
+          if (timedRead() < 0 || timedRead() < 0)
+          {
+            _failed = true;
+          }
+        }
+        else
+        {
+          _done = true;
+        }
+      }
+    }
+    return true;
+  }
+
+  Client *_client = NULL;
+  long _remaining = 0;
+  bool _chunked = false;
+  bool _done = true;
+  bool _failed = false;
+  uint8_t _buffer[256];
+  size_t _bufferLen = 0;
+  size_t _bufferPos = 0;
+};
+
+class ConnectionManager
+{
+public:
+  void begin()
+  {
+    setupHost(HOST_API, "api.spotify.com", spotify_server_cert);
+    setupHost(HOST_ACCOUNTS, "accounts.spotify.com", spotify_server_cert);
+    setupHost(HOST_IMAGES, "i.scdn.co", spotify_image_server_cert);
+  }
+
+  // Sends a request and reads the status line and headers. The response
+  // body can then be read from body(), endRequest() must always be called
+  // afterwards so the connection can be reused.
+  // Returns the HTTP status code, or a negative value on connection errors.
+  int beginRequest(HostId host, const char *method, const char *path,
+                   const char *accessToken = NULL, const char *body = NULL,
+                   const char *contentType = NULL)
+  {
+    HostConnection &conn = hosts[host];
+    activeHost = host;
+    requestCount++;
+
+    // A reused socket may have been closed by the server while idle,
+    // in that case we retry once on a fresh connection. Only if the server
+    // can't have acted on the request though: it didn't all go out, or
+    // sending it twice does no harm.
+    for (int attempt = 0; attempt < 2; attempt++)
+    {
+      bool reused = false;
+      if (conn.tls.connected() && millis() - conn.lastUsed < CONNECTION_IDLE_TIMEOUT_MS)
+      {
+        reused = true;
+      }
+      else if (!connect(conn))
+      {
+        return -1;
+      }
+
+      int statusCode = -2;
+      bool sent = writeRequest(conn, method, path, accessToken, body, contentType);
+      if (sent)
+      {
+        statusCode = readResponseHead(conn);
+      }
+
+      if (statusCode > 0)
+      {
+        conn.lastUsed = millis();
+        if (reused)
+        {
+          reuseCount++;
+        }
+        return statusCode;
+      }
+
+      conn.tls.stop();
+      if (!reused || (sent && !isIdempotent(method)))
+      {
+        return statusCode;
+      }
+      Serial.print("Kept-alive connection to ");
+      Serial.print(conn.hostname);
+      Serial.println(" was closed, reconnecting");
+    }
+    return -1;
+  }
+
+  Stream &body()
+  {
+    return responseBody;
+  }
+
+  HttpBodyStream &responseStream()
+  {
+    return responseBody;
+  }
+
+  long contentLength()
+  {
+    return responseContentLength;
+  }
+
+  void endRequest()
+  {
+    if (activeHost == HOST_COUNT)
+    {
+      return;
+    }
+
+    HostConnection &conn = hosts[activeHost];
+    if (!keepAlive || !responseBody.drain(HTTP_DRAIN_LIMIT))
+    {
+      conn.tls.stop();
+    }
+    conn.lastUsed = millis();
+    activeHost = HOST_COUNT;
+  }
+
+  // Request where only the status code matters
+  int request(HostId host, const char *method, const char *path,
+              const char *accessToken = NULL, const char *body = NULL,
+              const char *contentType = NULL)
+  {
+    int statusCode = beginRequest(host, method, path, accessToken, body, contentType);
+    endRequest();
+    return statusCode;
+  }
+
+  void printStats()
+  {
+    Serial.print("HTTPS requests: ");
+    Serial.print(requestCount);
+    Serial.print(", reused connections: ");
+    Serial.print(reuseCount);
+    Serial.print(", new connections: ");
+    Serial.println(connectCount);
+    Serial.print("TLS handshakes resumed: ");
+    Serial.print(tlsHandshakeStats.resumed);
+    Serial.print(", full: ");
+    Serial.print(tlsHandshakeStats.full);
+    if (tlsHandshakeStats.unknown > 0)
+    {
+      Serial.print(", not known: ");
+      Serial.print(tlsHandshakeStats.unknown);
+    }
+    Serial.println();
+  }
+
+private:
+  void setupHost(HostId host, const char *hostname, const char *caCert)
+  {
+    hosts[host].hostname = hostname;
+    hosts[host].caCert = caCert;
+    hosts[host].addressResolved = false;
+    hosts[host].lastUsed = 0;
+    hosts[host].tls.setRtcSlot(host);
+  }
+
+  bool resolve(HostConnection &conn)
+  {
+    if (conn.addressResolved)
+    {
+      return true;
+    }
+    if (!WiFi.hostByName(conn.hostname, conn.address))
+    {
+      Serial.print("DNS lookup failed for ");
+      Serial.println(conn.hostname);
+      return false;
+    }
+    conn.addressResolved = true;
+    return true;
+  }
+
+  bool connect(HostConnection &conn)
+  {
+    conn.tls.stop();
+
+    // Try the cached address first, if that fails the host may have moved
+    for (int attempt = 0; attempt < 2; attempt++)
+    {
+      if (!resolve(conn))
+      {
+        return false;
+      }
+
+      unsigned long start = millis();
+      if (conn.tls.connect(conn.address, 443, conn.hostname, conn.caCert))
+      {
+        connectCount++;
+        conn.lastUsed = millis();
+        Serial.print("Connected to ");
+        Serial.print(conn.hostname);
+        Serial.print(" in ");
+        Serial.print(millis() - start);
+        Serial.println("ms");
+        return true;
+      }
+
+      conn.addressResolved = false;
+    }
+
+    Serial.print("Connection to ");
+    Serial.print(conn.hostname);
+    Serial.println(" failed");
+    return false;
+  }
+
+  // Requests that leave the same result however often they are sent
+  static bool isIdempotent(const char *method)
+  {
+    return strcmp(method, "GET") == 0 || strcmp(method, "PUT") == 0 || strcmp(method, "DELETE") == 0;
+  }
+
+  bool writeRequest(HostConnection &conn, const char *method, const char *path,
+                    const char *accessToken, const char *body, const char *contentType)
+  {
+    // Build the whole head in one buffer so it goes out in a single TLS record
+    char head[768];
+    size_t bodyLength = body != NULL ? strlen(body) : 0;
+    int len = snprintf(head, sizeof(head), "%s %s HTTP/1.1\r\nHost: %s\r\nConnection: keep-alive\r\n",
+                       method, path, conn.hostname);
+    if (accessToken != NULL && len > 0 && len < (int)sizeof(head))
+    {
+      len += snprintf(head + len, sizeof(head) - len, "Authorization: Bearer %s\r\n", accessToken);
+    }
+    if (contentType != NULL && len > 0 && len < (int)sizeof(head))
+    {
+      len += snprintf(head + len, sizeof(head) - len, "Content-Type: %s\r\n", contentType);
+    }
+    if (strcmp(method, "GET") != 0 && len > 0 && len < (int)sizeof(head))
+    {
+      len += snprintf(head + len, sizeof(head) - len, "Content-Length: %u\r\n", (unsigned int)bodyLength);
+    }
+    if (len > 0 && len < (int)sizeof(head))
+    {
+      len += snprintf(head + len, sizeof(head) - len, "\r\n");
+    }
+    if (len <= 0 || len >= (int)sizeof(head))
+    {
+      Serial.println("Request head too long");
+      return false;
+    }
+
+    if (conn.tls.write((const uint8_t *)head, len) != (size_t)len)
+    {
+      return false;
+    }
+    if (bodyLength > 0 && conn.tls.write((const uint8_t *)body, bodyLength) != bodyLength)
+    {
+      return false;
+    }
+    return true;
+  }
+
+  // Reads a header line into the buffer, returns its length or -1 on timeout
+  int readLine(HostConnection &conn, char *line, size_t size)
+  {
+    size_t len = 0;
+    unsigned long start = millis();
+    while (true)
+    {
+      if (!conn.tls.available())
+      {
+        if (!conn.tls.connected() || millis() - start > HTTP_TIMEOUT_MS)
+        {
+          return -1;
+        }
+        delay(1);
+        continue;
+      }
+
+      int c = conn.tls.read();
+      if (c == '\n')
+      {
+        break;
+      }
+      if (c != '\r' && len < size - 1)
+      {
+        line[len++] = c;
+      }
+    }
+    line[len] = '\0';
+    return len;
+  }
+
+  int readResponseHead(HostConnection &conn)
+  {
+    char line[160];
+    if (readLine(conn, line, sizeof(line)) <= 0)
+    {
+      return -3;
+    }
+
+    // "HTTP/1.1 200 OK"
+    char *space = strchr(line, ' ');
+    int statusCode = space != NULL ? atoi(space + 1) : 0;
+    if (statusCode <= 0)
+    {
+      return -3;
+    }
+
+    long length = -1;
+    bool chunked = false;
+    keepAlive = strncmp(line, "HTTP/1.1", 8) == 0;
+
+    while (true)
+    {
+      int len = readLine(conn, line, sizeof(line));
+      if (len < 0)
+      {
+        return -3;
+      }
+      if (len == 0)
+      {
+        break; // Headers end
+      }
+
+      if (strncasecmp(line, "Content-Length:", 15) == 0)
+      {
+        length = atol(line + 15);
+      }
+      else if (strncasecmp(line, "Transfer-Encoding:", 18) == 0 && strstr(line + 18, "chunked") != NULL)
+      {
+        chunked = true;
+      }
+      else if (strncasecmp(line, "Connection:", 11) == 0 && strstr(line + 11, "close") != NULL)
+      {
+        keepAlive = false;
+      }
+    }
+
+    // These never carry a body, whatever the headers say
+    if (statusCode == 204 || statusCode == 304 || (statusCode >= 100 && statusCode < 200))
+    {
+      length = 0;
+      chunked = false;
+    }
+    if (length < 0 && !chunked)
+    {
+      keepAlive = false; // Body is terminated by the server closing the socket
+    }
+
+    responseContentLength = length;
+    responseBody.begin(&conn.tls, length, chunked);
+    return statusCode;
+  }
+
+  HostConnection hosts[HOST_COUNT];
+  HostId activeHost = HOST_COUNT;
+  HttpBodyStream responseBody;
+  long responseContentLength = 0;
+  bool keepAlive = false;
+
+  unsigned long requestCount = 0;
+  unsigned long reuseCount = 0;
+  unsigned long connectCount = 0;
+};
+
+ConnectionManager spotifyConnections;
+
+// Downloads an image (e.g. "https://i.scdn.co/image/...") into the given output
+bool downloadImage(const char *imageUrl, Print *out)
+{
+  const char *path = strstr(imageUrl, "i.scdn.co");
+  if (path == NULL || (path = strchr(path, '/')) == NULL)
+  {
+    Serial.print("Unexpected image host: ");
+    Serial.println(imageUrl);
+    return false;
+  }
+
+  int statusCode = spotifyConnections.beginRequest(HOST_IMAGES, "GET", path);
+  if (statusCode != 200)
+  {
+    Serial.print("Image request failed: ");
+    Serial.println(statusCode);
+    spotifyConnections.endRequest();
+    return false;
+  }
+
+  HttpBodyStream &body = spotifyConnections.responseStream();
+  uint8_t buffer[512];
+  size_t total = 0;
+  size_t received;
+  bool written = true;
+  while ((received = body.readBody(buffer, sizeof(buffer))) > 0)
+  {
+    if (out->write(buffer, received) != received)
+    {
+      written = false; // Output is full, no point reading the rest
+      break;
+    }
+    total += received;
+  }
+  bool complete = written && body.finished();
+  spotifyConnections.endRequest();
+
+  Serial.print("Downloaded image bytes: ");
+  Serial.println(total);
+  return complete && total > 0;
+}
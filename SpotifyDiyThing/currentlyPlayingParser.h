@@ -0,0 +1,686 @@
+// Streaming parser for the currently-playing response
+// The response is several KB of JSON (available markets, external URLs and
+// so on) and the display uses about a dozen fields of it. This reads the body
+// a piece at a time as it comes off the connection, keeps track of where it is
+// in the object tree, and copies only the wanted values straight into a
+// PlayingPayload. Nothing is allocated and no document is built, anything
+// else is skipped over as it goes past.
+//
+// This file is also compiled on the host by tools/currentlyPlaying, so it may
+// only use plain C++. SPOTIFY_MAX_NUM_ARTISTS and SPOTIFY_NUM_ALBUM_IMAGES
+// (SpotifyArduino.h) have to be defined before it is included.
+
+#ifndef CURRENTLY_PLAYING_PARSER_H
+#define CURRENTLY_PLAYING_PARSER_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PLAYING_NAME_SIZE 256 // Same as TEXT_LAYOUT_MAX_BYTES, longer names are cut on a character boundary
+#define PLAYING_ARTIST_NAME_SIZE 128
+#define PLAYING_URI_SIZE 80
+#define PLAYING_URL_SIZE 128
+#define PLAYING_PARSER_MAX_DEPTH 12
+#define PLAYING_PARSER_TOKEN_SIZE 24 // Keys, numbers and literals, none we look at is longer
+
+struct PlayingArtist
+{
+  char name[PLAYING_ARTIST_NAME_SIZE];
+  char uri[PLAYING_URI_SIZE];
+};
+
+struct PlayingImage
+{
+  char url[PLAYING_URL_SIZE];
+  int width;
+  int height;
+};
+
+// Everything the display uses from one response, in fixed storage
+struct PlayingPayload
+{
+  char trackName[PLAYING_NAME_SIZE];
+  char trackUri[PLAYING_URI_SIZE];   // Empty when nothing is playing (or an ad)
+  char albumName[PLAYING_NAME_SIZE]; // The show for an episode
+  char albumUri[PLAYING_URI_SIZE];
+  char contextUri[PLAYING_URI_SIZE]; // Empty when there is no context
+  PlayingArtist artists[SPOTIFY_MAX_NUM_ARTISTS];
+  int numArtists;
+  PlayingImage images[SPOTIFY_NUM_ALBUM_IMAGES];
+  int numImages;
+  bool episode;
+  bool isPlaying;
+  long progressMs;
+  long durationMs;
+  long long timestamp; // When Spotify took progressMs, ms since 1970
+};
+
+// Copies text into a fixed buffer, cutting it short on a character boundary
+void playingCopy(char *dest, size_t size, const char *text)
+{
+  if (text == NULL)
+  {
+    dest[0] = '\0';
+    return;
+  }
+  size_t length = strlen(text);
+  if (length >= size)
+  {
+    length = size - 1;
+    while (length > 0 && (text[length] & 0xC0) == 0x80)
+    {
+      length--;
+    }
+  }
+  memcpy(dest, text, length);
+  dest[length] = '\0';
+}
+
+class CurrentlyPlayingParser
+{
+public:
+  // Starts a new response, payload is cleared and filled in as it is parsed
+  void begin(PlayingPayload &payload)
+  {
+    memset(&payload, 0, sizeof(payload));
+    _payload = &payload;
+    _state = EXPECT_VALUE;
+    _depth = 0;
+  }
+
+  // Parses the next piece of the body. Returns false once the JSON is broken,
+  // anything fed after that is ignored.
+  bool feed(const char *data, size_t length)
+  {
+    size_t i = 0;
+    while (i < length && _state != FAILED)
+    {
+      char c = data[i];
+      if (step(c))
+      {
+        i++;
+      }
+    }
+    return _state != FAILED;
+  }
+
+  // True once the whole top level object has been read
+  bool done()
+  {
+    return _state == DONE;
+  }
+
+private:
+  enum State
+  {
+    EXPECT_VALUE,
+    ARRAY_START,  // Just after '[', a value or ']'
+    OBJECT_START, // Just after '{', a key or '}'
+    EXPECT_KEY,   // After ',' in an object
+    EXPECT_COLON,
+    IN_STRING,
+    IN_ESCAPE,
+    IN_UNICODE,
+    IN_SCALAR, // Number, true, false or null
+    AFTER_VALUE,
+    DONE,
+    FAILED
+  };
+
+  // Keys that lead to a value we keep, anything else is KEY_OTHER
+  enum Key : uint8_t
+  {
+    KEY_OTHER,
+    KEY_INDEX, // Stands for an array element in a path
+    KEY_ITEM,
+    KEY_NAME,
+    KEY_URI,
+    KEY_ARTISTS,
+    KEY_ALBUM,
+    KEY_SHOW,
+    KEY_IMAGES,
+    KEY_URL,
+    KEY_WIDTH,
+    KEY_HEIGHT,
+    KEY_DURATION,
+    KEY_PROGRESS,
+    KEY_IS_PLAYING,
+    KEY_TIMESTAMP,
+    KEY_CONTEXT,
+    KEY_TYPE,
+    KEY_COUNT
+  };
+
+  enum Field : uint8_t
+  {
+    FIELD_NONE,
+    FIELD_TRACK_NAME,
+    FIELD_TRACK_URI,
+    FIELD_DURATION,
+    FIELD_ARTIST_NAME,
+    FIELD_ARTIST_URI,
+    FIELD_ALBUM_NAME,
+    FIELD_ALBUM_URI,
+    FIELD_IMAGE_URL,
+    FIELD_IMAGE_WIDTH,
+    FIELD_IMAGE_HEIGHT,
+    FIELD_PROGRESS,
+    FIELD_IS_PLAYING,
+    FIELD_TIMESTAMP,
+    FIELD_CONTEXT_URI,
+    FIELD_TYPE
+  };
+
+  struct FieldPath
+  {
+    uint8_t keys[5];
+    uint8_t length;
+    Field field;
+  };
+
+  struct Level
+  {
+    bool array;
+    uint8_t key; // Object: the key of the value being read
+    int index;   // Array: the element being read
+  };
+
+  static Key keyFor(const char *name)
+  {
+    static const char *const names[KEY_COUNT] = {
+        "", "", "item", "name", "uri", "artists", "album", "show", "images", "url", "width",
+        "height", "duration_ms", "progress_ms", "is_playing", "timestamp", "context", "currently_playing_type"};
+    for (int key = KEY_ITEM; key < KEY_COUNT; key++)
+    {
+      if (strcmp(name, names[key]) == 0)
+      {
+        return (Key)key;
+      }
+    }
+    return KEY_OTHER;
+  }
+
+  // Which field (if any) the value about to be read is
+  Field fieldHere()
+  {
+    // Episodes have the show and their own images where a track has its
+    // album, so both fill the same fields
+    static const FieldPath paths[] = {
+        {{KEY_ITEM, KEY_NAME}, 2, FIELD_TRACK_NAME},
+        {{KEY_ITEM, KEY_URI}, 2, FIELD_TRACK_URI},
+        {{KEY_ITEM, KEY_DURATION}, 2, FIELD_DURATION},
+        {{KEY_ITEM, KEY_ARTISTS, KEY_INDEX, KEY_NAME}, 4, FIELD_ARTIST_NAME},
+        {{KEY_ITEM, KEY_ARTISTS, KEY_INDEX, KEY_URI}, 4, FIELD_ARTIST_URI},
+        {{KEY_ITEM, KEY_ALBUM, KEY_NAME}, 3, FIELD_ALBUM_NAME},
+        {{KEY_ITEM, KEY_ALBUM, KEY_URI}, 3, FIELD_ALBUM_URI},
+        {{KEY_ITEM, KEY_ALBUM, KEY_IMAGES, KEY_INDEX, KEY_URL}, 5, FIELD_IMAGE_URL},
+        {{KEY_ITEM, KEY_ALBUM, KEY_IMAGES, KEY_INDEX, KEY_WIDTH}, 5, FIELD_IMAGE_WIDTH},
+        {{KEY_ITEM, KEY_ALBUM, KEY_IMAGES, KEY_INDEX, KEY_HEIGHT}, 5, FIELD_IMAGE_HEIGHT},
+        {{KEY_ITEM, KEY_SHOW, KEY_NAME}, 3, FIELD_ALBUM_NAME},
+        {{KEY_ITEM, KEY_SHOW, KEY_URI}, 3, FIELD_ALBUM_URI},
+        {{KEY_ITEM, KEY_IMAGES, KEY_INDEX, KEY_URL}, 4, FIELD_IMAGE_URL},
+        {{KEY_ITEM, KEY_IMAGES, KEY_INDEX, KEY_WIDTH}, 4, FIELD_IMAGE_WIDTH},
+        {{KEY_ITEM, KEY_IMAGES, KEY_INDEX, KEY_HEIGHT}, 4, FIELD_IMAGE_HEIGHT},
+        {{KEY_PROGRESS}, 1, FIELD_PROGRESS},
+        {{KEY_IS_PLAYING}, 1, FIELD_IS_PLAYING},
+        {{KEY_TIMESTAMP}, 1, FIELD_TIMESTAMP},
+        {{KEY_CONTEXT, KEY_URI}, 2, FIELD_CONTEXT_URI},
+        {{KEY_TYPE}, 1, FIELD_TYPE},
+    };
+
+    if (_depth == 0 || _depth > 5)
+    {
+      return FIELD_NONE;
+    }
+    uint8_t here[5];
+    for (int i = 0; i < _depth; i++)
+    {
+      here[i] = _levels[i].array ? (uint8_t)KEY_INDEX : _levels[i].key;
+      if (here[i] == KEY_OTHER)
+      {
+        return FIELD_NONE;
+      }
+    }
+    for (const FieldPath &path : paths)
+    {
+      if (path.length == _depth && memcmp(path.keys, here, _depth) == 0)
+      {
+        return path.field;
+      }
+    }
+    return FIELD_NONE;
+  }
+
+  // Element of the innermost array, for the artist and image fields
+  int arrayIndex()
+  {
+    for (int i = _depth - 1; i >= 0; i--)
+    {
+      if (_levels[i].array)
+      {
+        return _levels[i].index;
+      }
+    }
+    return 0;
+  }
+
+  // Where a string value goes, NULL to skip it
+  char *stringTarget(Field field, size_t &size)
+  {
+    int index = arrayIndex();
+    switch (field)
+    {
+    case FIELD_TRACK_NAME:
+      size = sizeof(_payload->trackName);
+      return _payload->trackName;
+    case FIELD_TRACK_URI:
+      size = sizeof(_payload->trackUri);
+      return _payload->trackUri;
+    case FIELD_ALBUM_NAME:
+      size = sizeof(_payload->albumName);
+      return _payload->albumName;
+    case FIELD_ALBUM_URI:
+      size = sizeof(_payload->albumUri);
+      return _payload->albumUri;
+    case FIELD_CONTEXT_URI:
+      size = sizeof(_payload->contextUri);
+      return _payload->contextUri;
+    case FIELD_ARTIST_NAME:
+    case FIELD_ARTIST_URI:
+      if (index >= SPOTIFY_MAX_NUM_ARTISTS)
+      {
+        return NULL;
+      }
+      if (index >= _payload->numArtists)
+      {
+        _payload->numArtists = index + 1;
+      }
+      size = field == FIELD_ARTIST_NAME ? sizeof(_payload->artists[0].name) : sizeof(_payload->artists[0].uri);
+      return field == FIELD_ARTIST_NAME ? _payload->artists[index].name : _payload->artists[index].uri;
+    case FIELD_IMAGE_URL:
+      if (index >= SPOTIFY_NUM_ALBUM_IMAGES)
+      {
+        return NULL;
+      }
+      if (index >= _payload->numImages)
+      {
+        _payload->numImages = index + 1;
+      }
+      size = sizeof(_payload->images[0].url);
+      return _payload->images[index].url;
+    case FIELD_TYPE:
+      size = sizeof(_token);
+      return _token;
+    default:
+      return NULL;
+    }
+  }
+
+  void scalarValue(Field field, const char *text)
+  {
+    int index = arrayIndex();
+    switch (field)
+    {
+    case FIELD_DURATION:
+      _payload->durationMs = atol(text);
+      break;
+    case FIELD_PROGRESS:
+      _payload->progressMs = atol(text);
+      break;
+    case FIELD_TIMESTAMP:
+      _payload->timestamp = atoll(text);
+      break;
+    case FIELD_IS_PLAYING:
+      _payload->isPlaying = strcmp(text, "true") == 0;
+      break;
+    case FIELD_IMAGE_WIDTH:
+    case FIELD_IMAGE_HEIGHT:
+      if (index < SPOTIFY_NUM_ALBUM_IMAGES)
+      {
+        int &size = field == FIELD_IMAGE_WIDTH ? _payload->images[index].width : _payload->images[index].height;
+        size = atoi(text);
+      }
+      break;
+    default:
+      break;
+    }
+  }
+
+  // Handles one character, returns false if it has to be looked at again
+  // in the new state (the character that ends a number)
+  bool step(char c)
+  {
+    bool space = c == ' ' || c == '\n' || c == '\r' || c == '\t';
+    switch (_state)
+    {
+    case EXPECT_VALUE:
+    case ARRAY_START:
+      if (space)
+      {
+        return true;
+      }
+      if (_state == ARRAY_START && c == ']')
+      {
+        return close(true);
+      }
+      if (c == '{' || c == '[')
+      {
+        if (_depth == PLAYING_PARSER_MAX_DEPTH)
+        {
+          _state = FAILED;
+          return true;
+        }
+        Level &level = _levels[_depth++];
+        level.array = c == '[';
+        level.key = KEY_OTHER;
+        level.index = 0;
+        _state = level.array ? ARRAY_START : OBJECT_START;
+        return true;
+      }
+      _field = fieldHere();
+      if (c == '"')
+      {
+        _inKey = false;
+        _target = stringTarget(_field, _targetSize);
+        startString();
+        return true;
+      }
+      if (c == '-' || (c >= '0' && c <= '9') || c == 't' || c == 'f' || c == 'n')
+      {
+        _tokenLength = 0;
+        _state = IN_SCALAR;
+        return false;
+      }
+      _state = FAILED;
+      return true;
+
+    case OBJECT_START:
+    case EXPECT_KEY:
+      if (space)
+      {
+        return true;
+      }
+      if (_state == OBJECT_START && c == '}')
+      {
+        return close(false);
+      }
+      if (c == '"')
+      {
+        _inKey = true;
+        _target = _token;
+        _targetSize = sizeof(_token);
+        startString();
+        return true;
+      }
+      _state = FAILED;
+      return true;
+
+    case EXPECT_COLON:
+      if (!space)
+      {
+        _state = c == ':' ? EXPECT_VALUE : FAILED;
+      }
+      return true;
+
+    case IN_STRING:
+      if (c == '"')
+      {
+        endString();
+      }
+      else if (c == '\\')
+      {
+        _state = IN_ESCAPE;
+      }
+      else
+      {
+        append(c);
+      }
+      return true;
+
+    case IN_ESCAPE:
+      _state = IN_STRING;
+      switch (c)
+      {
+      case 'b':
+        append('\b');
+        break;
+      case 'f':
+        append('\f');
+        break;
+      case 'n':
+        append('\n');
+        break;
+      case 'r':
+        append('\r');
+        break;
+      case 't':
+        append('\t');
+        break;
+      case 'u':
+        _state = IN_UNICODE;
+        _hexDigits = 0;
+        _hexValue = 0;
+        break;
+      default:
+        append(c); // '"', '\\' and '/'
+        break;
+      }
+      return true;
+
+    case IN_UNICODE:
+    {
+      int digit = (c >= '0' && c <= '9') ? c - '0' : (c >= 'a' && c <= 'f') ? c - 'a' + 10 : (c >= 'A' && c <= 'F') ? c - 'A' + 10 : -1;
+      if (digit < 0)
+      {
+        _state = FAILED;
+        return true;
+      }
+      _hexValue = (_hexValue << 4) | digit;
+      if (++_hexDigits == 4)
+      {
+        appendCodepoint(_hexValue);
+        _state = IN_STRING;
+      }
+      return true;
+    }
+
+    case IN_SCALAR:
+      if (space || c == ',' || c == '}' || c == ']')
+      {
+        _token[_tokenLength] = '\0';
+        scalarValue(_field, _token);
+        valueDone();
+        return false;
+      }
+      if (_tokenLength < sizeof(_token) - 1)
+      {
+        _token[_tokenLength++] = c;
+      }
+      return true;
+
+    case AFTER_VALUE:
+      if (space)
+      {
+        return true;
+      }
+      if (c == ',')
+      {
+        Level &level = _levels[_depth - 1];
+        if (level.array)
+        {
+          level.index++;
+          _state = EXPECT_VALUE;
+        }
+        else
+        {
+          _state = EXPECT_KEY;
+        }
+        return true;
+      }
+      if (c == '}' || c == ']')
+      {
+        return close(c == ']');
+      }
+      _state = FAILED;
+      return true;
+
+    case DONE:
+      if (!space)
+      {
+        _state = FAILED;
+      }
+      return true;
+
+    default:
+      return true;
+    }
+  }
+
+  bool close(bool array)
+  {
+    if (_depth == 0 || _levels[_depth - 1].array != array)
+    {
+      _state = FAILED;
+      return true;
+    }
+    _depth--;
+    valueDone();
+    return true;
+  }
+
+  void valueDone()
+  {
+    _state = _depth == 0 ? DONE : AFTER_VALUE;
+  }
+
+  void startString()
+  {
+    _targetLength = 0;
+    _truncated = false;
+    _highSurrogate = 0;
+    _state = IN_STRING;
+  }
+
+  void endString()
+  {
+    if (_target != NULL)
+    {
+      if (_truncated)
+      {
+        trimPartialCharacter();
+      }
+      _target[_targetLength] = '\0';
+    }
+
+    if (_inKey)
+    {
+      _levels[_depth - 1].key = keyFor(_token);
+      _state = EXPECT_COLON;
+      return;
+    }
+    if (_field == FIELD_TYPE)
+    {
+      _payload->episode = strcmp(_token, "episode") == 0;
+    }
+    valueDone();
+  }
+
+  void append(char c)
+  {
+    if (_target == NULL)
+    {
+      return;
+    }
+    if (_targetLength < _targetSize - 1)
+    {
+      _target[_targetLength++] = c;
+    }
+    else
+    {
+      _truncated = true;
+    }
+  }
+
+  // A \u escape, as UTF-8. Surrogate pairs come in two escapes.
+  void appendCodepoint(uint32_t codepoint)
+  {
+    if (codepoint >= 0xD800 && codepoint <= 0xDBFF)
+    {
+      _highSurrogate = codepoint;
+      return;
+    }
+    if (codepoint >= 0xDC00 && codepoint <= 0xDFFF)
+    {
+      if (_highSurrogate == 0)
+      {
+        return;
+      }
+      codepoint = 0x10000 + ((_highSurrogate - 0xD800) << 10) + (codepoint - 0xDC00);
+    }
+    _highSurrogate = 0;
+
+    if (codepoint < 0x80)
+    {
+      append(codepoint);
+    }
+    else if (codepoint < 0x800)
+    {
+      append(0xC0 | (codepoint >> 6));
+      append(0x80 | (codepoint & 0x3F));
+    }
+    else if (codepoint < 0x10000)
+    {
+      append(0xE0 | (codepoint >> 12));
+      append(0x80 | ((codepoint >> 6) & 0x3F));
+      append(0x80 | (codepoint & 0x3F));
+    }
+    else
+    {
+      append(0xF0 | (codepoint >> 18));
+      append(0x80 | ((codepoint >> 12) & 0x3F));
+      append(0x80 | ((codepoint >> 6) & 0x3F));
+      append(0x80 | (codepoint & 0x3F));
+    }
+  }
+
+  // A cut string may end part way through a character, drop what is there of it
+  void trimPartialCharacter()
+  {
+    size_t start = _targetLength;
+    while (start > 0 && (_target[start - 1] & 0xC0) == 0x80)
+    {
+      start--;
+    }
+    if (start == 0)
+    {
+      return;
+    }
+    uint8_t lead = _target[start - 1];
+    size_t expected = lead >= 0xF0 ? 4 : lead >= 0xE0 ? 3 : lead >= 0xC0 ? 2 : 1;
+    if (_targetLength - (start - 1) < expected)
+    {
+      _targetLength = start - 1;
+    }
+  }
+
+  PlayingPayload *_payload = NULL;
+  State _state = EXPECT_VALUE;
+  Level _levels[PLAYING_PARSER_MAX_DEPTH];
+  int _depth = 0;
+
+  Field _field = FIELD_NONE;
+  bool _inKey = false;
+  char *_target = NULL; // Where the string being read goes, NULL to skip it
+  size_t _targetSize = 0;
+  size_t _targetLength = 0;
+  bool _truncated = false;
+
+  char _token[PLAYING_PARSER_TOKEN_SIZE]; // Keys, numbers and literals
+  size_t _tokenLength = 0;
+  int _hexDigits = 0;
+  uint32_t _hexValue = 0;
+  uint32_t _highSurrogate = 0;
+};
+
+#endif
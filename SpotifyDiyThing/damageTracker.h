@@ -0,0 +1,259 @@
+// Damage tracking for the now playing screen
+// Instead of each part of the screen clearing its own area with fillRect,
+// areas that need clearing to the background are marked dirty here. Parts
+// that paint an area opaquely (the album art, smooth font text) say so
+// before drawing it, and that area is taken out of the dirty set. One flush
+// at the end of the frame fills whatever is left, so each pixel is pushed
+// at most once a frame, cleared or drawn.
+//
+// The dirty set never overlaps itself: a new rectangle only adds the parts
+// that aren't dirty already, and rectangles that line up afterwards are
+// merged back together so a flush sends as few fills as it can. The fills
+// are recorded in a display list, which sends them when it runs.
+//
+// Mark an area dirty before anything is painted over it in the same frame,
+// dirty marks are not checked against what has already been drawn.
+
+#include <TFT_eSPI.h>
+
+#define DAMAGE_MAX_RECTS 32 // More than this and the set is flushed early
+
+struct DamageRect
+{
+  int x;
+  int y;
+  int w;
+  int h;
+
+  bool empty() const
+  {
+    return w <= 0 || h <= 0;
+  }
+
+  long area() const
+  {
+    return (long)w * h;
+  }
+
+  bool intersects(const DamageRect &other) const
+  {
+    return x < other.x + other.w && other.x < x + w && y < other.y + other.h && other.y < y + h;
+  }
+};
+
+class DamageTracker
+{
+public:
+  void begin(TFT_eSPI *display, DisplayList *list, uint16_t background)
+  {
+    _display = display;
+    _list = list;
+    _background = background;
+    reset();
+  }
+
+  // Forgets anything dirty, after the whole screen was cleared some other way
+  void reset()
+  {
+    _count = 0;
+  }
+
+  // Needs clearing to the background by the next flush
+  void markDirty(int x, int y, int w, int h)
+  {
+    DamageRect rect = {x, y, w, h};
+    if (clip(rect))
+    {
+      add(rect, 0);
+      merge();
+    }
+  }
+
+  // About to be painted opaquely, so the flush leaves it alone
+  void painted(int x, int y, int w, int h)
+  {
+    DamageRect rect = {x, y, w, h};
+    if (!clip(rect))
+    {
+      return;
+    }
+    _drawn += rect.area();
+
+    DamageRect kept[DAMAGE_MAX_RECTS];
+    int count = 0;
+    for (int i = 0; i < _count; i++)
+    {
+      DamageRect pieces[4];
+      int pieceCount = 1;
+      pieces[0] = _rects[i];
+      if (_rects[i].intersects(rect))
+      {
+        pieceCount = split(_rects[i], rect, pieces);
+      }
+      if (count + pieceCount > DAMAGE_MAX_RECTS)
+      {
+        // No room for the pieces, clear it all now and let this be drawn over it
+        flush();
+        return;
+      }
+      for (int p = 0; p < pieceCount; p++)
+      {
+        kept[count++] = pieces[p];
+      }
+    }
+    memcpy(_rects, kept, count * sizeof(DamageRect));
+    _count = count;
+    merge();
+  }
+
+  bool dirty()
+  {
+    return _count > 0;
+  }
+
+  // Clears everything that's still dirty
+  void flush()
+  {
+    for (int i = 0; i < _count; i++)
+    {
+      _list->fill(_rects[i].x, _rects[i].y, _rects[i].w, _rects[i].h, _background);
+      _cleared += _rects[i].area();
+      _fills++;
+    }
+    _count = 0;
+  }
+
+  // Flushes, and prints how many pixels the frame pushed when log is set
+  void endFrame(bool log = true)
+  {
+    flush();
+    if (log)
+    {
+      long screen = (long)_display->width() * _display->height();
+      Serial.print("Frame pushed ");
+      Serial.print(_cleared + _drawn);
+      Serial.print(" pixels (");
+      Serial.print(_drawn);
+      Serial.print(" drawn, ");
+      Serial.print(_cleared);
+      Serial.print(" cleared in ");
+      Serial.print(_fills);
+      Serial.print(" fills), ");
+      Serial.print((_cleared + _drawn) * 100 / screen);
+      Serial.println("% of the screen");
+    }
+    _cleared = 0;
+    _drawn = 0;
+    _fills = 0;
+  }
+
+private:
+  // Keeps the rectangle on the display, false if nothing is left of it
+  bool clip(DamageRect &rect)
+  {
+    int right = rect.x + rect.w;
+    int bottom = rect.y + rect.h;
+    rect.x = max(rect.x, 0);
+    rect.y = max(rect.y, 0);
+    rect.w = min(right, (int)_display->width()) - rect.x;
+    rect.h = min(bottom, (int)_display->height()) - rect.y;
+    return !rect.empty();
+  }
+
+  // Adds the parts of rect not already covered by _rects[from] onwards.
+  // Anything before from is known not to touch it.
+  void add(DamageRect rect, int from)
+  {
+    for (int i = from; i < _count; i++)
+    {
+      if (_rects[i].intersects(rect))
+      {
+        DamageRect pieces[4];
+        int pieceCount = split(rect, _rects[i], pieces);
+        for (int p = 0; p < pieceCount; p++)
+        {
+          add(pieces[p], i + 1);
+        }
+        return;
+      }
+    }
+
+    if (_count == DAMAGE_MAX_RECTS)
+    {
+      // Out of room, clear what is there now
+      flush();
+    }
+    _rects[_count++] = rect;
+  }
+
+  // The parts of rect outside cut, at most 4: full width bands above and
+  // below it, and the pieces left and right of it in between
+  int split(const DamageRect &rect, const DamageRect &cut, DamageRect *pieces)
+  {
+    int count = 0;
+    int top = max(rect.y, cut.y);
+    int bottom = min(rect.y + rect.h, cut.y + cut.h);
+    if (cut.y > rect.y)
+    {
+      pieces[count++] = {rect.x, rect.y, rect.w, cut.y - rect.y};
+    }
+    if (cut.y + cut.h < rect.y + rect.h)
+    {
+      pieces[count++] = {rect.x, cut.y + cut.h, rect.w, rect.y + rect.h - (cut.y + cut.h)};
+    }
+    if (cut.x > rect.x)
+    {
+      pieces[count++] = {rect.x, top, cut.x - rect.x, bottom - top};
+    }
+    if (cut.x + cut.w < rect.x + rect.w)
+    {
+      pieces[count++] = {cut.x + cut.w, top, rect.x + rect.w - (cut.x + cut.w), bottom - top};
+    }
+    return count;
+  }
+
+  // Joins rectangles that share a whole edge, until none do
+  void merge()
+  {
+    bool merged = true;
+    while (merged)
+    {
+      merged = false;
+      for (int i = 0; i < _count && !merged; i++)
+      {
+        for (int j = i + 1; j < _count && !merged; j++)
+        {
+          DamageRect &a = _rects[i];
+          DamageRect &b = _rects[j];
+          if (a.x == b.x && a.w == b.w && (a.y + a.h == b.y || b.y + b.h == a.y))
+          {
+            a.y = min(a.y, b.y);
+            a.h += b.h;
+            merged = true;
+          }
+          else if (a.y == b.y && a.h == b.h && (a.x + a.w == b.x || b.x + b.w == a.x))
+          {
+            a.x = min(a.x, b.x);
+            a.w += b.w;
+            merged = true;
+          }
+          if (merged)
+          {
+            _rects[j] = _rects[--_count];
+          }
+        }
+      }
+    }
+  }
+
+  TFT_eSPI *_display = NULL;
+  DisplayList *_list = NULL;
+  uint16_t _background = TFT_BLACK;
+  DamageRect _rects[DAMAGE_MAX_RECTS];
+  int _count = 0;
+
+  // For the current frame
+  long _cleared = 0;
+  long _drawn = 0;
+  int _fills = 0;
+};
@@ -0,0 +1,261 @@
+// Drawing for one screen update, recorded and then sent in one go
+// Called one by one, fillRect, pushSprite and text each take the SPI bus,
+// send an address window and let the bus go again. Recorded here instead,
+// a whole update is sent inside one startWrite()/endWrite(), and a draw
+// that carries straight on from the one before it is merged into it:
+//  - a fill of the same colour sharing a whole edge
+//  - the next columns of the same sprite, next to it on screen too (the
+//    digits of "12" are side by side in the time label atlas)
+//  - more text in the same font and colour, starting where it ended (the
+//    "..." after a cut line)
+// Draws run in the order they were recorded, so later ones still go over
+// earlier ones.
+//
+// Text is drawn by a TextPainter when the list runs, from a copy of the
+// bytes. run() can print how many transactions and address windows the
+// update took, against drawing each call on its own.
+
+#include <TFT_eSPI.h>
+
+#define DISPLAY_LIST_MAX_OPS 48     // Run early when full
+#define DISPLAY_LIST_TEXT_SIZE 1024 // Bytes of text one update can hold
+
+// Draws text straight to the display, inside the list's transaction
+class TextPainter
+{
+public:
+  virtual void paintText(uint8_t font, int x, int y, const char *text, int length, uint16_t color) = 0;
+};
+
+enum DisplayOpKind : uint8_t
+{
+  DISPLAY_FILL,
+  DISPLAY_SPRITE,
+  DISPLAY_TEXT
+};
+
+struct DisplayOp
+{
+  DisplayOpKind kind;
+  uint8_t font;     // DISPLAY_TEXT
+  uint16_t color;   // DISPLAY_FILL and DISPLAY_TEXT
+  int16_t x;
+  int16_t y;        // Baseline for DISPLAY_TEXT
+  int16_t w;        // Advance width for DISPLAY_TEXT
+  int16_t h;
+  int16_t sourceX;  // DISPLAY_SPRITE
+  int16_t sourceY;
+  uint16_t text;    // DISPLAY_TEXT, offset and length in the text buffer
+  uint16_t length;
+  TFT_eSprite *sprite;
+};
+
+class DisplayList
+{
+public:
+  DisplayList(TFT_eSPI *display, TextPainter *painter) : _display(display), _painter(painter) {}
+
+  void fill(int x, int y, int w, int h, uint16_t color)
+  {
+    if (w <= 0 || h <= 0)
+    {
+      return;
+    }
+    makeRoom(0);
+    _calls++;
+    DisplayOp *last = lastOp(DISPLAY_FILL);
+    if (last != NULL && last->color == color)
+    {
+      if (last->x == x && last->w == w && (last->y + last->h == y || y + h == last->y))
+      {
+        last->y = min((int)last->y, y);
+        last->h += h;
+        return;
+      }
+      if (last->y == y && last->h == h && (last->x + last->w == x || x + w == last->x))
+      {
+        last->x = min((int)last->x, x);
+        last->w += w;
+        return;
+      }
+    }
+
+    DisplayOp *op = add(DISPLAY_FILL);
+    op->x = x;
+    op->y = y;
+    op->w = w;
+    op->h = h;
+    op->color = color;
+  }
+
+  // Part of a sprite, which has to stay as it is until the list has run
+  void pushSprite(TFT_eSprite *sprite, int x, int y, int sourceX, int sourceY, int w, int h)
+  {
+    if (w <= 0 || h <= 0)
+    {
+      return;
+    }
+    makeRoom(0);
+    _calls++;
+    DisplayOp *last = lastOp(DISPLAY_SPRITE);
+    if (last != NULL && last->sprite == sprite && last->y == y && last->h == h && last->sourceY == sourceY &&
+        last->x + last->w == x && last->sourceX + last->w == sourceX)
+    {
+      last->w += w;
+      return;
+    }
+
+    DisplayOp *op = add(DISPLAY_SPRITE);
+    op->sprite = sprite;
+    op->x = x;
+    op->y = y;
+    op->w = w;
+    op->h = h;
+    op->sourceX = sourceX;
+    op->sourceY = sourceY;
+  }
+
+  // Text with its baseline at y, width is its advance
+  void text(uint8_t font, int x, int y, const char *text, int length, int width, uint16_t color)
+  {
+    if (length <= 0)
+    {
+      return;
+    }
+    if (length > DISPLAY_LIST_TEXT_SIZE)
+    {
+      length = DISPLAY_LIST_TEXT_SIZE;
+    }
+    makeRoom(length);
+    _calls++;
+
+    // Only merged if its bytes follow straight on in the buffer
+    DisplayOp *last = lastOp(DISPLAY_TEXT);
+    bool merge = last != NULL && last->font == font && last->color == color && last->y == y &&
+                 last->x + last->w == x && last->text + last->length == _textUsed;
+    memcpy(_text + _textUsed, text, length);
+    _textUsed += length;
+    if (merge)
+    {
+      last->w += width;
+      last->length += length;
+      return;
+    }
+
+    DisplayOp *op = add(DISPLAY_TEXT);
+    op->font = font;
+    op->color = color;
+    op->x = x;
+    op->y = y;
+    op->w = width;
+    op->text = _textUsed - length;
+    op->length = length;
+  }
+
+  bool empty()
+  {
+    return _count == 0;
+  }
+
+  // Draws everything recorded inside one transaction and empties the list.
+  // With log set, prints what it took.
+  void run(bool log = false)
+  {
+    if (_count == 0)
+    {
+      return;
+    }
+
+    _display->startWrite();
+    for (int i = 0; i < _count; i++)
+    {
+      DisplayOp &op = _ops[i];
+      switch (op.kind)
+      {
+      case DISPLAY_FILL:
+        _display->fillRect(op.x, op.y, op.w, op.h, op.color);
+        break;
+      case DISPLAY_SPRITE:
+        op.sprite->pushSprite(op.x, op.y, op.sourceX, op.sourceY, op.w, op.h);
+        break;
+      case DISPLAY_TEXT:
+        _painter->paintText(op.font, op.x, op.y, _text + op.text, op.length, op.color);
+        break;
+      }
+    }
+    _display->endWrite();
+
+    // Drawn one by one every call is a transaction and an address window.
+    // FreeSans text counts as one window, it really sends one per run of pixels.
+    if (log)
+    {
+      Serial.print("Display list: ");
+      Serial.print(_calls);
+      Serial.print(" draws in 1 transaction, ");
+      Serial.print(_count);
+      Serial.print(" address windows (one by one: ");
+      Serial.print(_calls);
+      Serial.print(" transactions, ");
+      Serial.print(_calls);
+      Serial.println(" address windows)");
+    }
+    _runs++;
+    _totalCalls += _calls;
+    _totalOps += _count;
+    _count = 0;
+    _calls = 0;
+    _textUsed = 0;
+  }
+
+  // Totals since the last call
+  void printStats()
+  {
+    Serial.print("Display list: ");
+    Serial.print(_runs);
+    Serial.print(" transactions, ");
+    Serial.print(_totalOps);
+    Serial.print(" address windows (one by one: ");
+    Serial.print(_totalCalls);
+    Serial.print(" transactions, ");
+    Serial.print(_totalCalls);
+    Serial.println(" address windows)");
+    _runs = 0;
+    _totalCalls = 0;
+    _totalOps = 0;
+  }
+
+private:
+  // The last op, if it is of this kind
+  DisplayOp *lastOp(DisplayOpKind kind)
+  {
+    return _count > 0 && _ops[_count - 1].kind == kind ? &_ops[_count - 1] : NULL;
+  }
+
+  // Runs the list early if another op, or textBytes more text, won't fit
+  void makeRoom(int textBytes)
+  {
+    if (_count == DISPLAY_LIST_MAX_OPS || textBytes > DISPLAY_LIST_TEXT_SIZE - _textUsed)
+    {
+      run(false);
+    }
+  }
+
+  DisplayOp *add(DisplayOpKind kind)
+  {
+    DisplayOp *op = &_ops[_count++];
+    op->kind = kind;
+    return op;
+  }
+
+  TFT_eSPI *_display;
+  TextPainter *_painter;
+  DisplayOp _ops[DISPLAY_LIST_MAX_OPS];
+  int _count = 0;
+  char _text[DISPLAY_LIST_TEXT_SIZE];
+  int _textUsed = 0;
+
+  unsigned long _calls = 0; // Recorded since the last run, before merging
+  unsigned long _runs = 0;
+  unsigned long _totalCalls = 0;
+  unsigned long _totalOps = 0;
+};
@@ -0,0 +1,159 @@
+// Scrolling title for text too long for one line
+// The whole title is drawn once into a 4 bit sprite whose palette is the 16
+// step ramp between the text colour and the background, so the smooth font
+// coverage levels are the palette indexes. Each frame only pushes a window
+// of the sprite to the panel, moved on a pixel, and never touches the font.
+//
+// The sprite holds the title and a gap after it. The window wraps from the
+// end of the sprite back to its start, so the title scrolls round in a loop
+// and pauses each time it is back at the start.
+//
+// The window is recorded in a display list, run it after start() and frame().
+// Include after smoothFont.h, scheduler.h and displayList.h.
+
+#include <TFT_eSPI.h>
+
+#define MARQUEE_ENABLED false  // Scroll long titles on one line instead of cutting them to two
+#define MARQUEE_FRAME_MS 40    // 25 frames a second
+#define MARQUEE_STEP 1         // Pixels moved per frame
+#define MARQUEE_GAP 48         // Pixels between the end of the title and its start coming round again
+#define MARQUEE_PAUSE_MS 2000  // Held still at the start of each pass
+#define MARQUEE_MAX_WIDTH 1200 // Widest sprite (title and gap), about 14KB with the title font
+
+class Marquee
+{
+public:
+  Marquee(TFT_eSPI *display, DisplayList *list) : _display(display), _list(list), _sprite(display) {}
+
+  // Draws text into the sprite for a window width pixels wide, with the text
+  // baseline at x, y like SmoothFont::drawText. Returns false and shows
+  // nothing if the text fits the window anyway, would make the sprite wider
+  // than MARQUEE_MAX_WIDTH, or there isn't the memory.
+  bool start(SmoothFont &font, const char *text, int x, int y, int width, uint16_t color, uint16_t background)
+  {
+    stop();
+
+    int length = strlen(text);
+    int textWidth = measureText(font, text, length);
+    int spriteWidth = textWidth + MARQUEE_GAP;
+    if (textWidth <= width || spriteWidth > MARQUEE_MAX_WIDTH)
+    {
+      return false;
+    }
+
+    unsigned long start = micros();
+    _sprite.setColorDepth(4);
+    if (_sprite.createSprite(spriteWidth, font.lineHeight()) == nullptr)
+    {
+      Serial.println("Not enough memory for the marquee");
+      return false;
+    }
+
+    uint16_t palette[16];
+    for (int level = 0; level < 16; level++)
+    {
+      palette[level] = _display->alphaBlend(level * 17, color, background);
+    }
+    _sprite.createPalette(palette, 16);
+    _sprite.fillSprite(0);
+    if (!font.drawToSprite(_sprite, text, length, textWidth))
+    {
+      _sprite.deleteSprite();
+      return false;
+    }
+
+    // The sprite starts a pixel left of the text, like drawText's box
+    _x = x - 1;
+    _y = y - font.ascent();
+    _width = width + 1;
+    _spriteWidth = spriteWidth;
+    _height = font.lineHeight();
+    _offset = 0;
+    _pausedUntil = millis() + MARQUEE_PAUSE_MS;
+    pushWindow();
+
+    Serial.print("Marquee sprite ");
+    Serial.print(_spriteWidth);
+    Serial.print("x");
+    Serial.print(_height);
+    Serial.print(", ");
+    Serial.print(memoryUsed());
+    Serial.print(" bytes, drawn in ");
+    Serial.print(micros() - start);
+    Serial.print("us, ");
+    Serial.print(_width * _height);
+    Serial.println(" pixels a frame");
+    return true;
+  }
+
+  // Whether start() would scroll text in a window width pixels wide: it
+  // doesn't fit, and isn't too wide for the sprite
+  bool scrolls(SmoothFont &font, const char *text, int width)
+  {
+    int textWidth = measureText(font, text, strlen(text));
+    return textWidth > width && textWidth + MARQUEE_GAP <= MARQUEE_MAX_WIDTH;
+  }
+
+  // Frees the sprite, whatever is on the panel stays there
+  void stop()
+  {
+    if (_sprite.created())
+    {
+      _sprite.deleteSprite();
+    }
+  }
+
+  bool active()
+  {
+    return _sprite.created();
+  }
+
+  size_t memoryUsed()
+  {
+    return active() ? (size_t)(_spriteWidth + 1) / 2 * _height : 0;
+  }
+
+  // Moves the title on by MARQUEE_STEP, call every MARQUEE_FRAME_MS
+  void frame()
+  {
+    if (!active() || !Scheduler::reached(millis(), _pausedUntil))
+    {
+      return;
+    }
+
+    _offset += MARQUEE_STEP;
+    if (_offset >= _spriteWidth)
+    {
+      _offset = 0;
+      _pausedUntil = millis() + MARQUEE_PAUSE_MS;
+    }
+    pushWindow();
+  }
+
+private:
+  void pushWindow()
+  {
+    // Up to the end of the sprite, then round to its start
+    int first = _spriteWidth - _offset;
+    if (first > _width)
+    {
+      first = _width;
+    }
+    _list->pushSprite(&_sprite, _x, _y, _offset, 0, first, _height);
+    if (first < _width)
+    {
+      _list->pushSprite(&_sprite, _x + first, _y, 0, 0, _width - first, _height);
+    }
+  }
+
+  TFT_eSPI *_display;
+  DisplayList *_list;
+  TFT_eSprite _sprite;
+  int _x = 0;
+  int _y = 0;
+  int _width = 0;
+  int _height = 0;
+  int _spriteWidth = 0;
+  int _offset = 0; // Sprite column at the left of the window
+  unsigned long _pausedUntil = 0;
+};
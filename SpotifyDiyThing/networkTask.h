@@ -0,0 +1,212 @@
+// Network task
+// All Spotify I/O (API requests, token refreshes and album art downloads) runs
+// in its own task pinned to core 0. The UI loop on core 1 posts commands to it
+// and picks the results up in processNetworkResults() (spotifyLogic.h), so
+// drawing and input handling never wait on a socket.
+
+#define NETWORK_TASK_CORE 0
+#define NETWORK_TASK_STACK_SIZE 12288 // TLS handshakes need a deep stack
+#define NETWORK_TASK_PRIORITY 1
+#define NETWORK_QUEUE_LENGTH 8
+#define NETWORK_IDLE_WAIT_MS 1000 // How often the idle task checks the access token
+
+// While a song plays, the art of the next tracks in the queue is downloaded
+// into the album art cache so it can be shown as soon as the track changes
+#define PREFETCH_TRACKS 2
+#define PREFETCH_DELAY_MS 5000     // After a track change, so the poll and art fetch go first
+#define PREFETCH_INTERVAL_MS 60000 // The queue can also change without a track change
+
+enum NetCommandType
+{
+  NET_POLL,
+  NET_SET_VOLUME,
+  NET_PLAY,
+  NET_PAUSE,
+  NET_LIKE,
+  NET_UNLIKE,
+  NET_FETCH_IMAGE
+};
+
+struct NetCommand
+{
+  NetCommandType type;
+  int value;     // Volume for NET_SET_VOLUME
+  char arg[200]; // Track ID for NET_LIKE/NET_UNLIKE, image URL for NET_FETCH_IMAGE
+};
+
+// Results come back with the type of the command that produced them
+struct NetResult
+{
+  NetCommandType type;
+  int status; // HTTP status for NET_POLL
+  bool ok;
+  int value;
+  char arg[200];
+
+  // NET_POLL only, one of playingPayloads. The UI copies it out straight
+  // away, it is only written again two polls later.
+  PlayingPayload *payload;
+
+  // NET_FETCH_IMAGE only, whoever takes the result off the queue has to
+  // albumArtRelease() it
+  AlbumArt art;
+};
+
+QueueHandle_t netCommandQueue;
+QueueHandle_t netResultQueue;
+TaskHandle_t networkTaskHandle = NULL;
+
+// Polls parse into these in turn, so the hot path never allocates. Only one
+// NET_POLL is in flight at a time, two slots leave a spare while the UI copies.
+PlayingPayload playingPayloads[2];
+int nextPlayingPayload = 0;
+
+char prefetchTrackUri[200] = "";
+unsigned long prefetchDueTime = 0;
+bool prefetchEnabled = false; // Only while something is playing
+
+void postNetResult(NetResult &result)
+{
+  // The UI drains this queue every loop, so waiting here is only ever brief
+  xQueueSend(netResultQueue, &result, portMAX_DELAY);
+  scheduler.wake();
+}
+
+void handleNetCommand(NetCommand &command)
+{
+  NetResult result;
+  result.type = command.type;
+  result.status = 0;
+  result.ok = false;
+  result.value = command.value;
+  strcpy(result.arg, command.arg);
+  result.payload = NULL;
+  result.art.source = ART_NONE;
+
+  switch (command.type)
+  {
+  case NET_POLL:
+    result.payload = &playingPayloads[nextPlayingPayload];
+    nextPlayingPayload = (nextPlayingPayload + 1) % 2;
+    result.status = getCurrentlyPlaying(*result.payload, SPOTIFY_MARKET);
+    result.ok = result.status == 200;
+    if (!result.ok)
+    {
+      result.payload = NULL;
+      prefetchEnabled = false;
+      break;
+    }
+    prefetchEnabled = result.payload->isPlaying;
+    if (result.payload->trackUri[0] != '\0' && strcmp(prefetchTrackUri, result.payload->trackUri) != 0)
+    {
+      strncpy(prefetchTrackUri, result.payload->trackUri, sizeof(prefetchTrackUri) - 1);
+      prefetchDueTime = millis() + PREFETCH_DELAY_MS;
+    }
+    break;
+  case NET_SET_VOLUME:
+    result.ok = spotifySetVolume(command.value);
+    break;
+  case NET_PLAY:
+    result.ok = spotifyPlay();
+    break;
+  case NET_PAUSE:
+    result.ok = spotifyPause();
+    break;
+  case NET_LIKE:
+    result.ok = saveTrackToLiked(command.arg) == 200;
+    break;
+  case NET_UNLIKE:
+    result.ok = removeTrackFromLiked(command.arg) == 200;
+    break;
+  case NET_FETCH_IMAGE:
+    result.ok = albumArtDownload(command.arg, result.art);
+    break;
+  }
+
+  postNetResult(result);
+
+  if (command.type == NET_FETCH_IMAGE && result.ok)
+  {
+    albumArtStoreInCache(command.arg, result.art);
+  }
+}
+
+// Idle work, gives up as soon as a command comes in
+void prefetchUpcomingArt()
+{
+  if (!prefetchEnabled || !artCache.enabled() || (long)(millis() - prefetchDueTime) < 0)
+  {
+    return;
+  }
+  prefetchDueTime = millis() + PREFETCH_INTERVAL_MS;
+
+  char urls[PREFETCH_TRACKS][200];
+  int count = getUpcomingAlbumArt(urls, PREFETCH_TRACKS);
+  for (int i = 0; i < count && uxQueueMessagesWaiting(netCommandQueue) == 0; i++)
+  {
+    albumArtPrefetch(urls[i]);
+  }
+}
+
+void networkTask(void *parameter)
+{
+  NetCommand command;
+  for (;;)
+  {
+    if (xQueueReceive(netCommandQueue, &command, pdMS_TO_TICKS(NETWORK_IDLE_WAIT_MS)) == pdTRUE)
+    {
+      handleNetCommand(command);
+    }
+
+    // Refresh the access token ahead of expiry, outside of any user action
+    accessTokens.loop();
+
+    if (uxQueueMessagesWaiting(netCommandQueue) == 0)
+    {
+      prefetchUpcomingArt();
+    }
+  }
+}
+
+// Call once the access token has been fetched, from then on only the network
+// task may touch spotifyConnections and accessTokens
+void startNetworkTask()
+{
+  netCommandQueue = xQueueCreate(NETWORK_QUEUE_LENGTH, sizeof(NetCommand));
+  netResultQueue = xQueueCreate(NETWORK_QUEUE_LENGTH, sizeof(NetResult));
+
+  xTaskCreatePinnedToCore(networkTask, "network", NETWORK_TASK_STACK_SIZE, NULL,
+                          NETWORK_TASK_PRIORITY, &networkTaskHandle, NETWORK_TASK_CORE);
+}
+
+// Queues a command without blocking, returns false if the queue is full
+bool postNetCommand(NetCommandType type, int value = 0, const char *arg = NULL)
+{
+  if (networkTaskHandle == NULL)
+  {
+    return false;
+  }
+
+  NetCommand command;
+  command.type = type;
+  command.value = value;
+  command.arg[0] = '\0';
+  if (arg != NULL)
+  {
+    strncpy(command.arg, arg, sizeof(command.arg) - 1);
+    command.arg[sizeof(command.arg) - 1] = '\0';
+  }
+
+  if (xQueueSend(netCommandQueue, &command, 0) != pdTRUE)
+  {
+    Serial.println("Network command queue full, dropping command");
+    return false;
+  }
+  return true;
+}
+
+// Non-blocking, returns true and fills result if one was waiting
+bool takeNetResult(NetResult &result)
+{
+  return netResultQueue != NULL && xQueueReceive(netResultQueue, &result, 0) == pdTRUE;
+}
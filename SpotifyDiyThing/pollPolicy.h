@@ -0,0 +1,215 @@
+// When to ask Spotify what is playing next
+// Instead of a fixed interval, each poll result picks the next delay:
+//  - playing: just after the song is predicted to end (songStartMillis +
+//    songDuration), but no later than POLL_PLAYING_MS so skips made from
+//    the app still show up
+//  - an ad or a private session, which can't be timed: every POLL_PLAYING_MS
+//  - paused, or nothing playing (204): every POLL_PAUSED_MS / POLL_IDLE_MS
+//  - for POLL_FAST_WINDOW_MS after input on the device (play/pause, volume,
+//    like): every POLL_FAST_MS, so whatever it changed is picked up straight away
+//  - a failed poll: POLL_ERROR_MS
+// Every delay is kept between POLL_MIN_MS and POLL_MAX_MS.
+//
+// printStats() shows the requests per hour (and what each poll was for)
+// against the old fixed 5 second interval, and how long after the
+// predicted end of a song the next one was seen.
+
+#define POLL_MIN_MS 1000
+#define POLL_MAX_MS 60000
+#define POLL_PLAYING_MS 5000          // Longest wait while a song plays, as the old fixed interval
+#define POLL_TRACK_END_MARGIN_MS 800  // After the predicted end, so the next song has started
+#define POLL_PAUSED_MS 15000
+#define POLL_IDLE_MS 30000            // Nothing playing
+#define POLL_ERROR_MS 5000
+#define POLL_FAST_MS 1000             // Right after a button press
+#define POLL_FAST_WINDOW_MS 6000
+#define POLL_FIXED_INTERVAL_MS 5000   // The old fixed interval, only used for the stats
+
+enum PollReason
+{
+  POLL_START,
+  POLL_TRACK_END,
+  POLL_PLAYING,
+  POLL_PAUSED,
+  POLL_IDLE,
+  POLL_INPUT,
+  POLL_ERROR,
+  POLL_REASON_COUNT
+};
+
+static const char *pollReasonNames[POLL_REASON_COUNT] = {"start", "track end", "playing", "paused", "idle", "input", "error"};
+
+class PollPolicy
+{
+public:
+  // taskId is the scheduler one-shot that sends the poll, it runs straight away
+  void begin(int taskId)
+  {
+    _task = taskId;
+    _statsStart = millis();
+    schedule(0, POLL_START);
+  }
+
+  // A poll found a song playing that will end at trackEndMillis
+  void playing(unsigned long trackEndMillis)
+  {
+    _trackEnd = trackEndMillis;
+    _trackEndKnown = true;
+
+    long untilEnd = (long)(trackEndMillis - millis()) + POLL_TRACK_END_MARGIN_MS;
+    if (untilEnd <= POLL_PLAYING_MS)
+    {
+      // Still the old song just after its end, the next one is only a moment away
+      schedule(untilEnd > 0 ? untilEnd : POLL_MIN_MS, POLL_TRACK_END);
+    }
+    else
+    {
+      schedule(POLL_PLAYING_MS, POLL_PLAYING);
+    }
+  }
+
+  // Something plays that has no track to time (an ad, a private session)
+  void untimed()
+  {
+    _trackEndKnown = false;
+    schedule(POLL_PLAYING_MS, POLL_PLAYING);
+  }
+
+  void paused()
+  {
+    _trackEndKnown = false;
+    schedule(POLL_PAUSED_MS, POLL_PAUSED);
+  }
+
+  // Nothing playing (204)
+  void idle()
+  {
+    _trackEndKnown = false;
+    schedule(POLL_IDLE_MS, POLL_IDLE);
+  }
+
+  // The poll failed, or couldn't be sent
+  void failed()
+  {
+    schedule(POLL_ERROR_MS, POLL_ERROR);
+  }
+
+  // Input on the device (play/pause, volume, like), poll fast for a while
+  void userInput()
+  {
+    _fastUntil = millis() + POLL_FAST_WINDOW_MS;
+    _fast = true;
+    // Bring the next poll forward, never push it back
+    if ((long)(_due - millis()) > POLL_FAST_MS)
+    {
+      schedule(POLL_FAST_MS, POLL_INPUT);
+    }
+  }
+
+  // Call when a poll is sent
+  void sent()
+  {
+    _requests[_reason]++;
+  }
+
+  // Call when a poll shows a new song, before playing() for it
+  void trackChanged()
+  {
+    if (_trackEndKnown && Scheduler::reached(millis(), _trackEnd))
+    {
+      unsigned long latency = millis() - _trackEnd;
+      _changes++;
+      _totalLatencyMs += latency;
+      if (latency > _maxLatencyMs)
+      {
+        _maxLatencyMs = latency;
+      }
+    }
+  }
+
+  void printStats()
+  {
+    unsigned long elapsedMs = millis() - _statsStart;
+    unsigned long total = 0;
+    for (int i = 0; i < POLL_REASON_COUNT; i++)
+    {
+      total += _requests[i];
+    }
+
+    Serial.print("Polls: ");
+    Serial.print(total);
+    Serial.print(" in ");
+    Serial.print(elapsedMs / 1000);
+    Serial.print("s, ");
+    Serial.print(elapsedMs > 0 ? (unsigned long)((uint64_t)total * 3600000 / elapsedMs) : 0);
+    Serial.print(" an hour (fixed interval: ");
+    Serial.print(3600000 / POLL_FIXED_INTERVAL_MS);
+    Serial.println(")");
+
+    Serial.print(" ");
+    for (int i = 0; i < POLL_REASON_COUNT; i++)
+    {
+      Serial.print(" ");
+      Serial.print(pollReasonNames[i]);
+      Serial.print(": ");
+      Serial.print(_requests[i]);
+      _requests[i] = 0;
+    }
+    Serial.println();
+
+    Serial.print("  Songs seen after their end: ");
+    Serial.print(_changes);
+    Serial.print(", ");
+    Serial.print(_changes > 0 ? _totalLatencyMs / _changes : 0);
+    Serial.print("ms avg, ");
+    Serial.print(_maxLatencyMs);
+    Serial.print("ms max (fixed interval: up to ");
+    Serial.print(POLL_FIXED_INTERVAL_MS);
+    Serial.println("ms)");
+
+    _statsStart = millis();
+    _changes = 0;
+    _totalLatencyMs = 0;
+    _maxLatencyMs = 0;
+  }
+
+private:
+  void schedule(unsigned long delayMs, PollReason reason)
+  {
+    // Straight after a button press, fast polling wins over everything else
+    if (_fast && Scheduler::reached(millis(), _fastUntil))
+    {
+      _fast = false;
+    }
+    if (_fast && delayMs > POLL_FAST_MS)
+    {
+      delayMs = POLL_FAST_MS;
+      reason = POLL_INPUT;
+    }
+
+    if (reason != POLL_START)
+    {
+      delayMs = constrain(delayMs, POLL_MIN_MS, POLL_MAX_MS);
+    }
+    _reason = reason;
+    _due = millis() + delayMs;
+    scheduler.runIn(_task, delayMs);
+  }
+
+  int _task = -1;
+  PollReason _reason = POLL_START;
+  unsigned long _due = 0;
+
+  unsigned long _trackEnd = 0;
+  bool _trackEndKnown = false;
+  unsigned long _fastUntil = 0;
+  bool _fast = false;
+
+  unsigned long _statsStart = 0;
+  unsigned long _requests[POLL_REASON_COUNT] = {};
+  unsigned long _changes = 0;
+  unsigned long _totalLatencyMs = 0;
+  unsigned long _maxLatencyMs = 0;
+};
+
+PollPolicy pollPolicy;
@@ -0,0 +1,217 @@
+// Progress bar component
+// The whole bar lives in a small 16 bit sprite. Each update only re-renders
+// the columns around the old and new end of the fill, and only those columns
+// are pushed to the display. The fill is tracked in 1/8 pixel steps and the
+// rounded ends are anti-aliased, so the bar creeps along smoothly instead of
+// jumping a whole percent at a time. Pushes are recorded in a display list,
+// which sends them when the update is finished.
+
+#include <TFT_eSPI.h>
+
+#define PROGRESS_BAR_SUBPIXELS 8 // Fill position resolution, per pixel
+
+class ProgressBar
+{
+public:
+  ProgressBar(TFT_eSPI *display, DisplayList *list) : _sprite(display), _list(list) {}
+
+  // Colours are RGB565, the gradient runs from top to bottom of the fill
+  bool begin(int x, int y, int width, int height, uint16_t fillTop, uint16_t fillBottom,
+             uint16_t trackColor, uint16_t borderColor, uint16_t backgroundColor)
+  {
+    _x = x;
+    _y = y;
+    _width = width;
+    _height = height;
+    _track = trackColor;
+    _border = borderColor;
+    _background = backgroundColor;
+    if (_height > PROGRESS_BAR_MAX_HEIGHT)
+    {
+      _height = PROGRESS_BAR_MAX_HEIGHT;
+    }
+
+    if (_sprite.createSprite(_width, _height) == nullptr)
+    {
+      Serial.println("Not enough memory for the progress bar sprite");
+      return false;
+    }
+
+    // The ends are half circles, inside a one pixel border
+    _innerWidth = _width - 2;
+    _innerHeight = _height - 2;
+    for (int row = 0; row < _height; row++)
+    {
+      _outerInset[row] = capInset(row, _height);
+    }
+    for (int row = 0; row < _innerHeight; row++)
+    {
+      _innerInset[row] = capInset(row, _innerHeight);
+      _fillColor[row] = lerpColor(fillTop, fillBottom, row * PROGRESS_BAR_SUBPIXELS / _innerHeight);
+    }
+    // Subtle highlight on the top edge for a glossy effect
+    _fillColor[0] = TFT_WHITE;
+
+    reset();
+    return true;
+  }
+
+  // The next update redraws the whole bar (new song, screen cleared)
+  void reset()
+  {
+    _drawn = false;
+  }
+
+  void update(long progress, long duration)
+  {
+    if (!_sprite.created())
+    {
+      return;
+    }
+
+    int fill = 0;
+    if (duration > 0 && progress > 0)
+    {
+      long clamped = progress < duration ? progress : duration;
+      fill = (long long)clamped * _innerWidth * PROGRESS_BAR_SUBPIXELS / duration;
+      // Ensure minimum width for visibility when progress > 0
+      int minFill = _innerHeight * PROGRESS_BAR_SUBPIXELS;
+      if (fill < minFill)
+      {
+        fill = minFill;
+      }
+    }
+
+    if (!_drawn)
+    {
+      _fill = fill;
+      renderColumns(0, _width);
+      push(0, _width);
+      _drawn = true;
+      return;
+    }
+
+    if (fill == _fill)
+    {
+      return;
+    }
+
+    // Columns the end cap covers at the old and at the new position
+    int low = (fill < _fill ? fill : _fill) - _innerHeight * PROGRESS_BAR_SUBPIXELS;
+    int high = fill > _fill ? fill : _fill;
+    int firstColumn = 1 + low / PROGRESS_BAR_SUBPIXELS;
+    int lastColumn = 1 + (high + PROGRESS_BAR_SUBPIXELS - 1) / PROGRESS_BAR_SUBPIXELS;
+    firstColumn = firstColumn < 0 ? 0 : firstColumn;
+    lastColumn = lastColumn > _width ? _width : lastColumn;
+
+    _fill = fill;
+    renderColumns(firstColumn, lastColumn);
+    push(firstColumn, lastColumn);
+  }
+
+  unsigned long pixelsPushed = 0;
+
+private:
+  static const int PROGRESS_BAR_MAX_HEIGHT = 16;
+
+  // How far (in subpixels) a rounded end is cut in on a given row
+  static int capInset(int row, int height)
+  {
+    float radius = height / 2.0f;
+    float dy = row + 0.5f - radius;
+    float dx = sqrtf(radius * radius - dy * dy);
+    return (int)((radius - dx) * PROGRESS_BAR_SUBPIXELS + 0.5f);
+  }
+
+  // How much of the pixel column [column, column + 1) lies inside [start, end), in subpixels
+  static int overlap(int column, int start, int end)
+  {
+    int left = column * PROGRESS_BAR_SUBPIXELS;
+    int right = left + PROGRESS_BAR_SUBPIXELS;
+    int from = start > left ? start : left;
+    int to = end < right ? end : right;
+    return to > from ? to - from : 0;
+  }
+
+  // Mix of a and b, amount is 0 (all b) to PROGRESS_BAR_SUBPIXELS (all a)
+  static uint16_t lerpColor(uint16_t b, uint16_t a, int amount)
+  {
+    if (amount <= 0)
+    {
+      return b;
+    }
+    if (amount >= PROGRESS_BAR_SUBPIXELS)
+    {
+      return a;
+    }
+    int r = ((a >> 11) * amount + (b >> 11) * (PROGRESS_BAR_SUBPIXELS - amount)) / PROGRESS_BAR_SUBPIXELS;
+    int g = (((a >> 5) & 0x3F) * amount + ((b >> 5) & 0x3F) * (PROGRESS_BAR_SUBPIXELS - amount)) / PROGRESS_BAR_SUBPIXELS;
+    int bl = ((a & 0x1F) * amount + (b & 0x1F) * (PROGRESS_BAR_SUBPIXELS - amount)) / PROGRESS_BAR_SUBPIXELS;
+    return (r << 11) | (g << 5) | bl;
+  }
+
+  uint16_t pixelColor(int column, int row)
+  {
+    int outerEnd = _width * PROGRESS_BAR_SUBPIXELS - _outerInset[row];
+    int outer = overlap(column, _outerInset[row], outerEnd);
+    if (outer == 0)
+    {
+      return _background;
+    }
+
+    uint16_t color = _border;
+    int innerRow = row - 1;
+    int innerColumn = column - 1;
+    if (innerRow >= 0 && innerRow < _innerHeight && innerColumn >= 0 && innerColumn < _innerWidth)
+    {
+      int inset = _innerInset[innerRow];
+      int track = overlap(innerColumn, inset, _innerWidth * PROGRESS_BAR_SUBPIXELS - inset);
+      color = lerpColor(color, _track, track);
+
+      // The fill is a pill of its own, so its end is rounded like the bar's
+      int filled = overlap(innerColumn, inset, _fill - inset);
+      color = lerpColor(color, _fillColor[innerRow], filled);
+    }
+
+    return lerpColor(_background, color, outer);
+  }
+
+  void renderColumns(int first, int last)
+  {
+    for (int column = first; column < last; column++)
+    {
+      for (int row = 0; row < _height; row++)
+      {
+        _sprite.drawPixel(column, row, pixelColor(column, row));
+      }
+    }
+  }
+
+  void push(int first, int last)
+  {
+    if (last <= first)
+    {
+      return;
+    }
+    _list->pushSprite(&_sprite, _x + first, _y, first, 0, last - first, _height);
+    pixelsPushed += (last - first) * _height;
+  }
+
+  TFT_eSprite _sprite;
+  DisplayList *_list;
+  int _x = 0;
+  int _y = 0;
+  int _width = 0;
+  int _height = 0;
+  int _innerWidth = 0;
+  int _innerHeight = 0;
+  int _fill = 0; // Subpixels
+  bool _drawn = false;
+
+  uint16_t _track = 0;
+  uint16_t _border = 0;
+  uint16_t _background = 0;
+  int _outerInset[PROGRESS_BAR_MAX_HEIGHT];
+  int _innerInset[PROGRESS_BAR_MAX_HEIGHT];
+  uint16_t _fillColor[PROGRESS_BAR_MAX_HEIGHT]; // Gradient, one colour per row
+};
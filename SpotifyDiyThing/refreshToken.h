@@ -60,9 +60,6 @@ void handleRoot()
   server.send(200, "text/html", webpage);
 }
 
-// Forward declaration
-extern char storedAccessToken[400];
-
 void handleCallback()
 {
   String code = "";
@@ -80,12 +77,8 @@ void handleCallback()
   {
     strcpy(refreshToken, rt);
     haveRefreshToken = true;
-    
-    // Note: Access token is stored internally by SpotifyArduino library
-    // For manual API calls, we'll need to refresh and extract it separately
-    // For now, the token will be populated after first refresh
-    storedAccessToken[0] = '\0'; // Will be populated on next refresh
-    
+
+    // The access token manager fetches its own token with the new refresh token
     server.send(200, "text/plain", "Got Token, your device should be ready");
   }
   else
@@ -37,6 +37,19 @@ const int VOLUME_MAX = 100;
 const float VOLUME_STEP = 0.5;  // Adjust volume by 0.5% per encoder click for ultra-smooth control
 const int VOLUME_ACCELERATION_THRESHOLD = 3;  // Clicks per 100ms to trigger acceleration (lower = earlier acceleration)
 
+// Volume command channel - only the latest target is kept, older values are dropped
+// The PUT is sent once the knob has stopped (trailing edge), so a spin costs one API
+// call. Only a spin longer than VOLUME_MAX_HOLD_TIME sends before it stops, so the
+// speaker doesn't lag far behind the screen. It goes to the
+// network task as a NET_SET_VOLUME, so the UI never waits for it, and only one is
+// queued or running at a time (volumeInFlight)
+int volumeTarget = -1;  // Volume waiting to be sent, -1 when there is nothing to send
+bool volumeInFlight = false;  // A NET_SET_VOLUME is queued or running, the next waits for its result
+unsigned long lastVolumeInputTime = 0;
+unsigned long volumeHeldSince = 0;  // When volumeTarget got the first change that hasn't been sent
+const unsigned long VOLUME_SETTLE_TIME = 150;     // ms without clicks before the knob counts as stopped
+const unsigned long VOLUME_MAX_HOLD_TIME = 3000;  // ms a change waits at most while the knob keeps turning
+
 // Acceleration tracking
 int lastEncoderPos = 0;
 unsigned long lastEncoderTime = 0;
@@ -48,13 +61,7 @@ bool trackLiked = false;  // Track if we've liked this song during this session
 bool isCurrentlyPlaying = false;
 
 // Forward declarations
-extern SpotifyArduino spotify;
 extern SpotifyDisplay *spotifyDisplay;
-extern WiFiClientSecure client;
-extern const char* spotify_server_cert;
-extern bool pauseSpotifyPolling;
-extern char storedAccessToken[400];
-void refreshStoredAccessToken(); // Refresh access token for manual API calls
 void onVolumeChanged(int volume);
 void onButtonPressed();
 void updateCurrentTrackUri(const char* trackUri);
@@ -90,6 +97,7 @@ void IRAM_ATTR buttonISR() {
         firstClickTime = buttonTime;
         clickCount = 1;
       }
+      scheduler.wakeFromISR();
     }
   }
 }
@@ -133,6 +141,7 @@ void IRAM_ATTR encoderISR() {
       lastDTState = dtState;
       encoderChanged = true;
       lastInterruptTime = interruptTime;
+      scheduler.wakeFromISR();
     }
   }
 }
@@ -224,227 +233,54 @@ void handleEncoderVolumeChange() {
       currentVolume = newVolume;
       lastEncoderPos = currentPos;
       
-      // Pause polling to avoid SSL conflicts
-      pauseSpotifyPolling = true;
-      
-      // Set device volume via Spotify API
-      // This sets the volume for the currently active device
-      int volumeStatus = spotify.setVolume(currentVolume);
-      
-      // Resume polling
-      pauseSpotifyPolling = false;
-      
-      if (volumeStatus == 204) {
-        Serial.println("Volume set successfully");
-      } else {
-        Serial.print("Failed to set volume. Status: ");
-        Serial.println(volumeStatus);
+      // Replace whatever was pending, the API call happens in sendPendingVolume()
+      if (volumeTarget < 0) {
+        volumeHeldSince = currentTime;
       }
+      volumeTarget = currentVolume;
+      lastVolumeInputTime = currentTime;
       
-      // Notify display of volume change
+      // Show the new volume straight away, don't wait for the API
       onVolumeChanged(currentVolume);
     }
   }
 }
 
-// Save track to liked songs via Spotify API
-int saveTrackToLiked(const char* trackId) {
-  if (strlen(trackId) == 0) {
-    Serial.println("No track ID available");
-    return -1;
-  }
-  
-  Serial.println("=== SAVE TRACK DEBUG ===");
-  Serial.print("Track ID: ");
-  Serial.println(trackId);
-  
-  // Pause polling to avoid SSL conflicts
-  pauseSpotifyPolling = true;
-  Serial.println("Paused Spotify polling for write operation");
-  
-  // Refresh access token before use
-  Serial.println("Refreshing access token for API call...");
-  refreshStoredAccessToken();
-  delay(100); // Give time for token refresh to complete
-  
-  // Check if we have a valid token
-  if (strlen(storedAccessToken) == 0) {
-    Serial.println("ERROR: Access token is empty!");
-    pauseSpotifyPolling = false;
-    return -1;
-  }
-  
-  Serial.print("Using access token (first 20 chars): ");
-  Serial.println(String(storedAccessToken).substring(0, 20));
-  
-  // Ensure any existing connection is closed
-  if (client.connected()) {
-    client.stop();
-    Serial.println("Closed existing client connection");
-  }
-  
-  // Wait for connection to fully close
-  delay(500);
-  
-  Serial.println("Creating fresh HTTPS connection");
-  
-  // Create fresh connection for this request
-  WiFiClientSecure freshClient;
-  freshClient.setCACert(spotify_server_cert);
-  
-  if (!freshClient.connect("api.spotify.com", 443)) {
-    Serial.println("Connection to api.spotify.com failed");
-    pauseSpotifyPolling = false;
-    return -1;
+// Sends the latest volume target to Spotify when the knob has settled
+void sendPendingVolume() {
+  // One PUT at a time, volumeTarget keeps being replaced meanwhile
+  if (volumeTarget < 0 || volumeInFlight) {
+    return;
   }
   
-  Serial.println("Connected to api.spotify.com");
-  
-  // Build the PUT request manually
-  String url = "/v1/me/tracks?ids=" + String(trackId);
-  String authHeader = "Bearer " + String(storedAccessToken);
-  
-  freshClient.print(String("PUT ") + url + " HTTP/1.1\r\n" +
-                   "Host: api.spotify.com\r\n" +
-                   "Authorization: " + authHeader + "\r\n" +
-                   "Content-Length: 0\r\n" +
-                   "Connection: close\r\n\r\n");
-  
-  Serial.println("Request sent, waiting for response...");
-  
-  // Wait for response
-  unsigned long timeout = millis();
-  while (freshClient.available() == 0) {
-    if (millis() - timeout > 5000) {
-      Serial.println("Request timeout");
-      freshClient.stop();
-      pauseSpotifyPolling = false;
-      return -1;
-    }
-    delay(10);
+  unsigned long now = millis();
+  bool knobStopped = now - lastVolumeInputTime >= VOLUME_SETTLE_TIME;
+  bool heldTooLong = now - volumeHeldSince >= VOLUME_MAX_HOLD_TIME;
+  if (!knobStopped && !heldTooLong) {
+    return;
   }
   
-  // Read status code
-  String response = freshClient.readStringUntil('\n');
-  Serial.print("Response: ");
-  Serial.println(response);
-  
-  int statusCode = -1;
-  if (response.indexOf("200") > 0 || response.indexOf("204") > 0) {
-    statusCode = 200;
-    Serial.println(">>> Track ADDED to favorites (via direct HTTP)");
-  } else {
-    Serial.println(">>> FAILED to add track");
+  // Set device volume via Spotify API, the network task sends it
+  // This sets the volume for the currently active device
+  if (postNetCommand(NET_SET_VOLUME, volumeTarget)) {
+    volumeTarget = -1;
+    volumeInFlight = true;
+    pollPolicy.userInput();
   }
-  
-  freshClient.stop();
-  
-  // Resume polling
-  pauseSpotifyPolling = false;
-  Serial.println("Resumed Spotify polling");
-  Serial.println("=======================");
-  
-  return statusCode;
 }
 
-// Remove track from liked songs via Spotify API
-int removeTrackFromLiked(const char* trackId) {
-  if (strlen(trackId) == 0) {
-    Serial.println("No track ID available");
-    return -1;
-  }
-  
-  Serial.println("=== REMOVE TRACK DEBUG ===");
-  Serial.print("Track ID: ");
-  Serial.println(trackId);
-  
-  // Pause polling to avoid SSL conflicts
-  pauseSpotifyPolling = true;
-  Serial.println("Paused Spotify polling for write operation");
-  
-  // Refresh access token before use
-  Serial.println("Refreshing access token for API call...");
-  refreshStoredAccessToken();
-  delay(100); // Give time for token refresh to complete
-  
-  // Check if we have a valid token
-  if (strlen(storedAccessToken) == 0) {
-    Serial.println("ERROR: Access token is empty!");
-    pauseSpotifyPolling = false;
-    return -1;
-  }
-  
-  Serial.print("Using access token (first 20 chars): ");
-  Serial.println(String(storedAccessToken).substring(0, 20));
-  
-  // Ensure any existing connection is closed
-  if (client.connected()) {
-    client.stop();
-    Serial.println("Closed existing client connection");
-  }
-  
-  // Wait for connection to fully close
-  delay(500);
-  
-  Serial.println("Creating fresh HTTPS connection");
-  
-  // Create fresh connection for this request
-  WiFiClientSecure freshClient;
-  freshClient.setCACert(spotify_server_cert);
-  
-  if (!freshClient.connect("api.spotify.com", 443)) {
-    Serial.println("Connection to api.spotify.com failed");
-    pauseSpotifyPolling = false;
-    return -1;
-  }
-  
-  Serial.println("Connected to api.spotify.com");
-  
-  // Build the DELETE request manually
-  String url = "/v1/me/tracks?ids=" + String(trackId);
-  String authHeader = "Bearer " + String(storedAccessToken);
-  
-  freshClient.print(String("DELETE ") + url + " HTTP/1.1\r\n" +
-                   "Host: api.spotify.com\r\n" +
-                   "Authorization: " + authHeader + "\r\n" +
-                   "Content-Length: 0\r\n" +
-                   "Connection: close\r\n\r\n");
-  
-  Serial.println("Request sent, waiting for response...");
-  
-  // Wait for response
-  unsigned long timeout = millis();
-  while (freshClient.available() == 0) {
-    if (millis() - timeout > 5000) {
-      Serial.println("Request timeout");
-      freshClient.stop();
-      pauseSpotifyPolling = false;
-      return -1;
-    }
-    delay(10);
-  }
-  
-  // Read status code
-  String response = freshClient.readStringUntil('\n');
-  Serial.print("Response: ");
-  Serial.println(response);
-  
-  int statusCode = -1;
-  if (response.indexOf("200") > 0 || response.indexOf("204") > 0) {
-    statusCode = 200;
-    Serial.println(">>> Track REMOVED from favorites (via direct HTTP)");
+// Called with the network task's answer to NET_SET_VOLUME
+void onVolumeResult(int volume, bool volumeSet) {
+  volumeInFlight = false;
+  if (volumeSet) {
+    Serial.print("Volume set successfully: ");
+    Serial.println(volume);
   } else {
-    Serial.println(">>> FAILED to remove track");
+    Serial.println("Failed to set volume");
   }
   
-  freshClient.stop();
-  
-  // Resume polling
-  pauseSpotifyPolling = false;
-  Serial.println("Resumed Spotify polling");
-  Serial.println("=========================");
-  
-  return statusCode;
+  // Whatever the knob was turned to meanwhile, only the newest value
+  sendPendingVolume();
 }
 
 // Extract track ID from Spotify URI (spotify:track:TRACK_ID)
@@ -484,8 +320,6 @@ void handleEncoderButtonPress() {
       return;
     }
     
-    int statusCode;
-    
 #if ENABLE_UNLIKE_FEATURE
     // Toggle like/unlike based on session tracking
     Serial.print("Current liked status: ");
@@ -494,40 +328,20 @@ void handleEncoderButtonPress() {
     if (trackLiked) {
       // Try to remove from favorites
       Serial.println("Attempting to UNLIKE track...");
-      statusCode = removeTrackFromLiked(trackId.c_str());
-      if (statusCode == 200 || statusCode == 204) {
-        trackLiked = false;
-        Serial.println(">>> Track REMOVED from favorites");
-      } else {
-        Serial.print(">>> FAILED to remove track. Status: ");
-        Serial.println(statusCode);
-      }
+      postNetCommand(NET_UNLIKE, 0, trackId.c_str());
     } else {
       // Try to add to favorites
       Serial.println("Attempting to LIKE track...");
-      statusCode = saveTrackToLiked(trackId.c_str());
-      if (statusCode == 200 || statusCode == 204) {
-        trackLiked = true;
-        Serial.println(">>> Track ADDED to favorites");
-      } else {
-        Serial.print(">>> FAILED to add track. Status: ");
-        Serial.println(statusCode);
-      }
+      postNetCommand(NET_LIKE, 0, trackId.c_str());
     }
 #else
     // Add-only mode (no toggle, just add to favorites)
     Serial.println("Attempting to ADD track to favorites...");
-    statusCode = saveTrackToLiked(trackId.c_str());
-    if (statusCode == 200 || statusCode == 204) {
-      Serial.println(">>> Track ADDED to favorites");
-    } else {
-      Serial.print(">>> FAILED to add track. Status: ");
-      Serial.println(statusCode);
-    }
+    postNetCommand(NET_LIKE, 0, trackId.c_str());
 #endif
+    pollPolicy.userInput();
     
     lastActionTime = currentTime;
-    onButtonPressed();
     return;
   }
   
@@ -543,34 +357,17 @@ void handleEncoderButtonPress() {
       Serial.println(">>> SINGLE CLICK - Toggling Play/Pause");
       clickCount = 0;
       
-      // Pause polling to avoid SSL conflicts
-      pauseSpotifyPolling = true;
-      
-      // Add delay before PUT request to avoid SSL issues
-      delay(100);
-      
-      // Toggle play/pause based on current state
-      bool success = false;
+      // Toggle play/pause based on current state, onPlayStateResult() gets the answer
       if (isCurrentlyPlaying) {
         Serial.println("Pausing...");
-        success = spotify.pause();
+        postNetCommand(NET_PAUSE);
       } else {
         Serial.println("Playing...");
-        success = spotify.play();
-      }
-      
-      // Resume polling
-      pauseSpotifyPolling = false;
-      
-      if (success) {
-        Serial.println("Play/pause toggled successfully");
-        isCurrentlyPlaying = !isCurrentlyPlaying;
-      } else {
-        Serial.println("Failed to toggle play/pause");
+        postNetCommand(NET_PLAY);
       }
+      pollPolicy.userInput();  // Show the new state (and the song it starts) quickly
       
       lastActionTime = currentTime;
-      onButtonPressed();
     } else {
       // Reset if we can't process due to cooldown
       clickCount = 0;
@@ -594,13 +391,35 @@ void updatePlayingState(bool isPlaying) {
   isCurrentlyPlaying = isPlaying;
 }
 
+// Called with the network task's answer to NET_LIKE/NET_UNLIKE
+void onLikeResult(bool liked, bool success) {
+  if (success) {
+    trackLiked = liked;
+    Serial.println(liked ? ">>> Track ADDED to favorites" : ">>> Track REMOVED from favorites");
+  } else {
+    Serial.println(liked ? ">>> FAILED to add track" : ">>> FAILED to remove track");
+  }
+  onButtonPressed();
+}
+
+// Called with the network task's answer to NET_PLAY/NET_PAUSE
+void onPlayStateResult(bool playing, bool success) {
+  if (success) {
+    Serial.println("Play/pause toggled successfully");
+    isCurrentlyPlaying = playing;
+  } else {
+    Serial.println("Failed to toggle play/pause");
+  }
+  onButtonPressed();
+}
+
 // Callback function to notify display of volume change
 // This will be called when volume changes
 void onVolumeChanged(int volume) {
   Serial.print("Volume changed to: ");
   Serial.print(volume);
   Serial.println("%");
-  // Display handler can implement visual feedback
+  spotifyDisplay->showVolume(volume);
 }
 
 // Callback function to notify display of button press
@@ -614,4 +433,5 @@ void onButtonPressed() {
 void checkRotaryEncoderInput() {
   handleEncoderVolumeChange();
   handleEncoderButtonPress();
+  sendPendingVolume();
 }
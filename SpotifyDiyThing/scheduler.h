@@ -0,0 +1,246 @@
+// Cooperative scheduler for the UI loop
+// Everything loop() does is a task here, either periodic or a one-shot that
+// is armed with runIn(). run() calls whatever is due, earliest deadline
+// first, then sleeps until the next deadline. Interrupts and the network
+// task cut the sleep short with wake(), and tasks added with runOnWake run
+// straight away when that happens.
+//
+// Deadlines are compared as the signed difference to millis(), so nothing
+// goes wrong when millis() wraps after 49 days.
+//
+// Each task's run count and time are kept, printStats() shows where the
+// loop's time went since the last call.
+
+#define SCHEDULER_MAX_TASKS 10
+#define SCHEDULER_MAX_SLEEP_MS 1000 // Upper bound on one sleep, in case a wake is missed
+
+typedef void (*SchedulerCallback)();
+
+struct SchedulerTask
+{
+  const char *name;
+  SchedulerCallback callback;
+  unsigned long period; // ms, 0 for a one-shot
+  unsigned long due;    // millis() when it next runs
+  bool armed;
+  bool runOnWake;
+
+  unsigned long runs;
+  unsigned long totalUs;
+  unsigned long maxUs;
+};
+
+class Scheduler
+{
+public:
+  // Call from setup(), on the task that runs loop()
+  void begin()
+  {
+    _loopTask = xTaskGetCurrentTaskHandle();
+    _statsStart = millis();
+  }
+
+  // Returns the task id, or -1 if the table is full. A periodic task first
+  // runs straight away, a one-shot (period 0) waits for runIn().
+  int add(const char *name, SchedulerCallback callback, unsigned long periodMs, bool runOnWake = false)
+  {
+    if (_count >= SCHEDULER_MAX_TASKS)
+    {
+      Serial.println("Scheduler task table is full");
+      return -1;
+    }
+
+    SchedulerTask &task = _tasks[_count];
+    memset(&task, 0, sizeof(task));
+    task.name = name;
+    task.callback = callback;
+    task.period = periodMs;
+    task.due = millis();
+    task.armed = periodMs > 0;
+    task.runOnWake = runOnWake;
+    return _count++;
+  }
+
+  // Runs the task delayMs from now (periodic tasks carry on from there)
+  void runIn(int id, unsigned long delayMs)
+  {
+    if (id < 0 || id >= _count)
+    {
+      return;
+    }
+    _tasks[id].due = millis() + delayMs;
+    _tasks[id].armed = true;
+  }
+
+  void cancel(int id)
+  {
+    if (id >= 0 && id < _count)
+    {
+      _tasks[id].armed = false;
+    }
+  }
+
+  // True once deadline has been reached
+  static bool reached(unsigned long now, unsigned long deadline)
+  {
+    return (long)(now - deadline) >= 0;
+  }
+
+  // Call as the whole of loop()
+  void run()
+  {
+    int id;
+    while ((id = nextDue(millis())) >= 0)
+    {
+      SchedulerTask &task = _tasks[id];
+      if (task.period > 0)
+      {
+        task.due += task.period;
+        if (reached(millis(), task.due))
+        {
+          // Fell behind, don't try to catch up
+          task.due = millis() + task.period;
+        }
+      }
+      else
+      {
+        task.armed = false;
+      }
+
+      unsigned long start = micros();
+      task.callback();
+      unsigned long elapsed = micros() - start;
+      task.runs++;
+      task.totalUs += elapsed;
+      if (elapsed > task.maxUs)
+      {
+        task.maxUs = elapsed;
+      }
+    }
+
+    sleep();
+  }
+
+  // Cuts the current (or next) sleep short, from a task
+  void wake()
+  {
+    if (_loopTask != NULL)
+    {
+      xTaskNotifyGive(_loopTask);
+    }
+  }
+
+  // Same, from an interrupt handler
+  void IRAM_ATTR wakeFromISR()
+  {
+    if (_loopTask != NULL)
+    {
+      BaseType_t woken = pdFALSE;
+      vTaskNotifyGiveFromISR(_loopTask, &woken);
+      if (woken == pdTRUE)
+      {
+        portYIELD_FROM_ISR();
+      }
+    }
+  }
+
+  // Prints each task's share of the time since the last call, then starts over
+  void printStats()
+  {
+    unsigned long elapsedMs = millis() - _statsStart;
+    Serial.print("Loop stats over ");
+    Serial.print(elapsedMs);
+    Serial.print("ms, asleep ");
+    Serial.print(_sleepMs);
+    Serial.print("ms, woken early ");
+    Serial.println(_wakes);
+
+    for (int i = 0; i < _count; i++)
+    {
+      SchedulerTask &task = _tasks[i];
+      Serial.print("  ");
+      Serial.print(task.name);
+      Serial.print(": ");
+      Serial.print(task.runs);
+      Serial.print(" runs, ");
+      Serial.print(task.totalUs);
+      Serial.print("us total, ");
+      Serial.print(task.runs > 0 ? task.totalUs / task.runs : 0);
+      Serial.print("us avg, ");
+      Serial.print(task.maxUs);
+      Serial.println("us max");
+      task.runs = 0;
+      task.totalUs = 0;
+      task.maxUs = 0;
+    }
+
+    _statsStart = millis();
+    _sleepMs = 0;
+    _wakes = 0;
+  }
+
+private:
+  // The armed task with the earliest deadline that has been reached, or -1
+  int nextDue(unsigned long now)
+  {
+    int best = -1;
+    for (int i = 0; i < _count; i++)
+    {
+      SchedulerTask &task = _tasks[i];
+      if (task.armed && reached(now, task.due) && (best < 0 || (long)(task.due - _tasks[best].due) < 0))
+      {
+        best = i;
+      }
+    }
+    return best;
+  }
+
+  void sleep()
+  {
+    unsigned long now = millis();
+    unsigned long wait = SCHEDULER_MAX_SLEEP_MS;
+    for (int i = 0; i < _count; i++)
+    {
+      SchedulerTask &task = _tasks[i];
+      if (!task.armed)
+      {
+        continue;
+      }
+      if (reached(now, task.due))
+      {
+        return; // Became due while the others ran
+      }
+      if (task.due - now < wait)
+      {
+        wait = task.due - now;
+      }
+    }
+
+    uint32_t woken = ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(wait));
+    _sleepMs += millis() - now;
+
+    if (woken > 0)
+    {
+      _wakes++;
+      now = millis();
+      for (int i = 0; i < _count; i++)
+      {
+        if (_tasks[i].runOnWake)
+        {
+          _tasks[i].due = now;
+          _tasks[i].armed = true;
+        }
+      }
+    }
+  }
+
+  SchedulerTask _tasks[SCHEDULER_MAX_TASKS];
+  int _count = 0;
+  TaskHandle_t _loopTask = NULL;
+
+  unsigned long _statsStart = 0;
+  unsigned long _sleepMs = 0;
+  unsigned long _wakes = 0;
+};
+
+Scheduler scheduler;
@@ -0,0 +1,333 @@
+// Anti-aliased fonts from the .vlw files in data/
+// Each font is read from SPIFFS once at boot. Only the printable ASCII glyphs
+// are kept (the track text is transliterated to ASCII first), with their
+// coverage cut down to 4 bits and packed two pixels to a byte.
+//
+// Text is drawn one row at a time into a small line buffer: the glyph
+// coverage picks a colour from a 16 step ramp between the text colour and
+// the background, so nothing is ever read back from the panel. The whole
+// text box is sent in one address window.
+
+#include <TFT_eSPI.h>
+#include <SPIFFS.h>
+
+#include "textLayout.h"
+
+#define SMOOTH_FONT_RAM_BUDGET (16 * 1024) // Bytes of glyph data all fonts may use, 0 keeps the FreeSans fonts
+#define SMOOTH_FONT_FIRST 0x20
+#define SMOOTH_FONT_LAST 0x7E
+#define SMOOTH_FONT_GLYPHS (SMOOTH_FONT_LAST - SMOOTH_FONT_FIRST + 1)
+#define SMOOTH_FONT_MAX_WIDTH 320 // Widest box drawn in one go, longer text is drawn in pieces
+
+struct SmoothGlyph
+{
+  uint32_t offset; // Into the packed bitmaps
+  uint8_t width;
+  uint8_t height;
+  uint8_t xAdvance;
+  int8_t dX; // Left edge from the cursor
+  int8_t dY; // Top edge above the baseline
+};
+
+// One row of the box being drawn, shared by all fonts (only the display draws text)
+static uint8_t smoothFontCoverage[SMOOTH_FONT_MAX_WIDTH];
+static uint16_t smoothFontRow[SMOOTH_FONT_MAX_WIDTH];
+
+class SmoothFont : public GlyphMetrics
+{
+public:
+  // Loads the ASCII glyphs of a .vlw file, budget is the RAM it may take.
+  // Returns false (and keeps nothing) if the file is missing or too big.
+  bool load(const char *path, size_t budget)
+  {
+    unload();
+
+    fs::File f = SPIFFS.open(path, "r");
+    if (!f)
+    {
+      Serial.print("Font not found: ");
+      Serial.println(path);
+      return false;
+    }
+
+    // Header: glyph count, version, point size, unused, ascent, descent
+    uint32_t glyphCount = readInt32(f);
+    f.seek(24);
+
+    // Glyph table: code point, height, width, xAdvance, dY, dX, unused
+    uint32_t fileOffset = 24 + glyphCount * 28; // Bitmaps follow the table, 1 byte per pixel
+    uint32_t glyphFileOffset[SMOOTH_FONT_GLYPHS];
+    size_t packedSize = 0;
+    for (uint32_t i = 0; i < glyphCount; i++)
+    {
+      uint32_t codepoint = readInt32(f);
+      uint8_t height = readInt32(f);
+      uint8_t width = readInt32(f);
+      uint8_t xAdvance = readInt32(f);
+      int8_t dY = (int32_t)readInt32(f);
+      int8_t dX = (int32_t)readInt32(f);
+      readInt32(f);
+
+      if (codepoint >= SMOOTH_FONT_FIRST && codepoint <= SMOOTH_FONT_LAST)
+      {
+        SmoothGlyph &glyph = _glyphs[codepoint - SMOOTH_FONT_FIRST];
+        glyph.offset = packedSize;
+        glyph.width = width;
+        glyph.height = height;
+        glyph.xAdvance = xAdvance;
+        glyph.dX = dX;
+        glyph.dY = dY;
+        glyphFileOffset[codepoint - SMOOTH_FONT_FIRST] = fileOffset;
+        packedSize += (width * height + 1) / 2;
+
+        if (dY > _ascent)
+        {
+          _ascent = dY;
+        }
+        if (height - dY > _descent)
+        {
+          _descent = height - dY;
+        }
+      }
+      fileOffset += width * height;
+    }
+
+    if (packedSize + sizeof(_glyphs) > budget)
+    {
+      Serial.print("Font does not fit the RAM budget: ");
+      Serial.println(path);
+      f.close();
+      unload();
+      return false;
+    }
+
+    _bitmaps = (uint8_t *)calloc(packedSize, 1);
+    if (_bitmaps == NULL)
+    {
+      f.close();
+      unload();
+      return false;
+    }
+    _bitmapSize = packedSize;
+
+    // Glyphs missing from the file stay empty, with no advance
+    uint8_t coverage[255];
+    for (int i = 0; i < SMOOTH_FONT_GLYPHS; i++)
+    {
+      SmoothGlyph &glyph = _glyphs[i];
+      if (glyph.width == 0)
+      {
+        continue;
+      }
+      f.seek(glyphFileOffset[i]);
+      for (int pixel = 0, y = 0; y < glyph.height; y++)
+      {
+        f.read(coverage, glyph.width);
+        for (int x = 0; x < glyph.width; x++, pixel++)
+        {
+          uint8_t level = (coverage[x] * 15 + 127) / 255;
+          _bitmaps[glyph.offset + pixel / 2] |= (pixel & 1) ? level << 4 : level;
+        }
+      }
+    }
+    f.close();
+    return true;
+  }
+
+  void unload()
+  {
+    free(_bitmaps);
+    _bitmaps = NULL;
+    _bitmapSize = 0;
+    _ascent = 0;
+    _descent = 0;
+    memset(_glyphs, 0, sizeof(_glyphs));
+  }
+
+  bool loaded()
+  {
+    return _bitmaps != NULL;
+  }
+
+  size_t memoryUsed()
+  {
+    return loaded() ? _bitmapSize + sizeof(_glyphs) : 0;
+  }
+
+  int advance(uint32_t codepoint) override
+  {
+    const SmoothGlyph *glyph = find(codepoint);
+    return glyph != NULL ? glyph->xAdvance : 0;
+  }
+
+  int lineHeight() override
+  {
+    return _ascent + _descent;
+  }
+
+  // Pixels from the top of a line to the baseline
+  int ascent()
+  {
+    return _ascent;
+  }
+
+  // Draws length bytes of text with the baseline at y, on a plain background.
+  // Returns the x after the text. Call it inside startWrite()/endWrite() (the
+  // display list does), otherwise every row is a transaction of its own.
+  int drawText(TFT_eSPI &display, int x, int y, const char *text, int length, uint16_t color, uint16_t background)
+  {
+    // Colour for each coverage level, in the byte order the panel takes
+    uint16_t ramp[16];
+    for (int level = 0; level < 16; level++)
+    {
+      uint16_t blended = display.alphaBlend(level * 17, color, background);
+      ramp[level] = (blended >> 8) | (blended << 8);
+    }
+
+    int end = 0;
+    while (end < length)
+    {
+      // As much text as fits in the line buffer
+      int start = end;
+      int width = 0;
+      while (end < length)
+      {
+        int bytes;
+        int step = advance(utf8Decode(text + end, bytes));
+        if (width + step > SMOOTH_FONT_MAX_WIDTH - 2 && end > start)
+        {
+          break;
+        }
+        width += step;
+        end += bytes;
+      }
+      drawBox(display, x, y, text + start, end - start, width, ramp);
+      x += width;
+    }
+    return x;
+  }
+
+  // Draws text into a 4 bit sprite as palette indexes, 0 for no coverage up
+  // to 15 for full, so the sprite's palette decides the colours. The sprite
+  // must be at least textWidth + 2 wide and lineHeight() high, and cleared to 0.
+  // Returns false if there's no memory for the row buffer.
+  bool drawToSprite(TFT_eSprite &sprite, const char *text, int length, int textWidth)
+  {
+    int boxWidth = textWidth + 2;
+    uint8_t *coverage = (uint8_t *)malloc(boxWidth);
+    if (coverage == NULL)
+    {
+      return false;
+    }
+
+    for (int row = 0; row < lineHeight(); row++)
+    {
+      coverageRow(row, text, length, coverage, boxWidth);
+      for (int column = 0; column < boxWidth; column++)
+      {
+        if (coverage[column] > 0)
+        {
+          sprite.drawPixel(column, row, coverage[column]);
+        }
+      }
+    }
+    free(coverage);
+    return true;
+  }
+
+private:
+  static uint32_t readInt32(fs::File &f)
+  {
+    uint8_t bytes[4];
+    f.read(bytes, 4);
+    return ((uint32_t)bytes[0] << 24) | ((uint32_t)bytes[1] << 16) | ((uint32_t)bytes[2] << 8) | bytes[3];
+  }
+
+  const SmoothGlyph *find(uint32_t codepoint)
+  {
+    if (codepoint < SMOOTH_FONT_FIRST || codepoint > SMOOTH_FONT_LAST)
+    {
+      return NULL;
+    }
+    return &_glyphs[codepoint - SMOOTH_FONT_FIRST];
+  }
+
+  // Draws one piece of text whose advances add up to width
+  void drawBox(TFT_eSPI &display, int x, int y, const char *text, int length, int width, const uint16_t *ramp)
+  {
+    // One pixel either side for glyphs that hang past their advance
+    int left = x - 1;
+    int boxWidth = width + 2;
+    int top = y - _ascent;
+    int boxHeight = lineHeight();
+
+    // Keep it on the display
+    int firstColumn = left < 0 ? -left : 0;
+    int lastColumn = left + boxWidth > display.width() ? display.width() - left : boxWidth;
+    int firstRow = top < 0 ? -top : 0;
+    int lastRow = top + boxHeight > display.height() ? display.height() - top : boxHeight;
+    if (firstColumn >= lastColumn || firstRow >= lastRow)
+    {
+      return;
+    }
+
+    display.setAddrWindow(left + firstColumn, top + firstRow, lastColumn - firstColumn, lastRow - firstRow);
+    for (int row = firstRow; row < lastRow; row++)
+    {
+      coverageRow(row, text, length, smoothFontCoverage, boxWidth);
+      for (int column = firstColumn; column < lastColumn; column++)
+      {
+        smoothFontRow[column] = ramp[smoothFontCoverage[column]];
+      }
+      display.pushPixels(smoothFontRow + firstColumn, lastColumn - firstColumn);
+    }
+  }
+
+  // Coverage (0-15) of one row of a text box into coverage, boxWidth long.
+  // The box starts one pixel left of the text and its top is the ascent.
+  void coverageRow(int row, const char *text, int length, uint8_t *coverage, int boxWidth)
+  {
+    memset(coverage, 0, boxWidth);
+
+    // Every glyph that reaches this row adds its coverage
+    int penX = 1;
+    for (int i = 0; i < length;)
+    {
+      int bytes;
+      const SmoothGlyph *glyph = find(utf8Decode(text + i, bytes));
+      i += bytes;
+      if (glyph == NULL)
+      {
+        continue;
+      }
+
+      int glyphRow = row - (_ascent - glyph->dY);
+      if (glyphRow >= 0 && glyphRow < glyph->height)
+      {
+        int pixel = glyphRow * glyph->width;
+        const uint8_t *bitmap = _bitmaps + glyph->offset;
+        for (int column = 0; column < glyph->width; column++, pixel++)
+        {
+          int boxColumn = penX + glyph->dX + column;
+          if (boxColumn < 0 || boxColumn >= boxWidth)
+          {
+            continue;
+          }
+          uint8_t level = (bitmap[pixel / 2] >> ((pixel & 1) * 4)) & 0x0F;
+          // Neighbouring glyphs that touch keep the stronger coverage
+          if (level > coverage[boxColumn])
+          {
+            coverage[boxColumn] = level;
+          }
+        }
+      }
+      penX += glyph->xAdvance;
+    }
+  }
+
+  SmoothGlyph _glyphs[SMOOTH_FONT_GLYPHS];
+  uint8_t *_bitmaps = NULL;
+  size_t _bitmapSize = 0;
+  int _ascent = 0;
+  int _descent = 0;
+};
@@ -0,0 +1,343 @@
+// Spotify Web API requests
+// These block until the response is in, so they are only called from the
+// network task (see networkTask.h), never from the UI loop.
+
+// Player control requests, sent over the kept-alive api.spotify.com connection
+bool spotifySetVolume(int volume)
+{
+  char path[60];
+  sprintf(path, "/v1/me/player/volume?volume_percent=%d", volume);
+  int statusCode = accessTokens.authorizedRequest(HOST_API, "PUT", path);
+  return statusCode >= 200 && statusCode < 300;
+}
+
+bool spotifyPlay()
+{
+  int statusCode = accessTokens.authorizedRequest(HOST_API, "PUT", "/v1/me/player/play");
+  return statusCode >= 200 && statusCode < 300;
+}
+
+bool spotifyPause()
+{
+  int statusCode = accessTokens.authorizedRequest(HOST_API, "PUT", "/v1/me/player/pause");
+  return statusCode >= 200 && statusCode < 300;
+}
+
+// The currently playing response is read with the streaming parser in
+// currentlyPlayingParser.h. Set to false to parse it into an ArduinoJson
+// document instead, like before, to compare the two in the serial log.
+#define CURRENTLY_PLAYING_STREAMING true
+#define CURRENTLY_PLAYING_READ_SIZE 256 // Bytes of body parsed at a time
+
+int currentlyPlayingBufferSize = 3000; // Document size for the ArduinoJson path
+
+// Peak heap taken while parsing. Free heap before minus after only shows a
+// leak, so this goes by the low-water mark (ESP.getMinFreeHeap()) instead.
+// That mark is kept since boot, so a peak that stays above it is only known
+// to be at most the distance down to it.
+struct HeapPeak
+{
+  void start()
+  {
+    freeBefore = ESP.getFreeHeap();
+    minBefore = ESP.getMinFreeHeap();
+  }
+
+  void stop()
+  {
+    size_t minAfter = ESP.getMinFreeHeap();
+    exact = minAfter < minBefore;
+    bytes = freeBefore - (exact ? minAfter : minBefore);
+  }
+
+  size_t freeBefore = 0;
+  size_t minBefore = 0;
+  size_t bytes = 0;
+  bool exact = false; // Otherwise bytes is an upper bound
+};
+
+// Parses the body a piece at a time as it arrives. parseUs is the time spent
+// parsing, without the time spent waiting for the network.
+bool streamCurrentlyPlaying(PlayingPayload &payload, HeapPeak &heap, unsigned long &parseUs)
+{
+  heap.start();
+  CurrentlyPlayingParser parser;
+  parser.begin(payload);
+
+  HttpBodyStream &body = spotifyConnections.responseStream();
+  char buffer[CURRENTLY_PLAYING_READ_SIZE];
+  size_t received;
+  parseUs = 0;
+  while ((received = body.readBody((uint8_t *)buffer, sizeof(buffer))) > 0)
+  {
+    unsigned long start = micros();
+    bool ok = parser.feed(buffer, received);
+    parseUs += micros() - start;
+    if (!ok)
+    {
+      break;
+    }
+  }
+  heap.stop();
+
+  if (!parser.done())
+  {
+    Serial.println(F("Currently playing response is not valid JSON"));
+    return false;
+  }
+  return true;
+}
+
+// The ArduinoJson path, copies the same fields into payload
+bool deserializeCurrentlyPlaying(PlayingPayload &payload, HeapPeak &heap)
+{
+  heap.start();
+
+  // Only keep the fields we use: https://arduinojson.org/v6/example/filter/
+  StaticJsonDocument<464> filter;
+  JsonObject filter_item = filter.createNestedObject("item");
+  filter_item["duration_ms"] = true;
+  filter_item["name"] = true;
+  filter_item["uri"] = true;
+
+  JsonObject filter_item_artists_0 = filter_item["artists"].createNestedObject();
+  filter_item_artists_0["name"] = true;
+  filter_item_artists_0["uri"] = true;
+
+  JsonObject filter_item_album = filter_item.createNestedObject("album");
+  filter_item_album["name"] = true;
+  filter_item_album["uri"] = true;
+
+  JsonObject filter_item_album_images_0 = filter_item_album["images"].createNestedObject();
+  filter_item_album_images_0["height"] = true;
+  filter_item_album_images_0["width"] = true;
+  filter_item_album_images_0["url"] = true;
+
+  // Podcast filters
+  JsonObject filter_item_show = filter_item.createNestedObject("show");
+  filter_item_show["name"] = true;
+  filter_item_show["uri"] = true;
+
+  JsonObject filter_item_images_0 = filter_item["images"].createNestedObject();
+  filter_item_images_0["height"] = true;
+  filter_item_images_0["width"] = true;
+  filter_item_images_0["url"] = true;
+
+  filter["is_playing"] = true;
+  filter["progress_ms"] = true;
+  filter["timestamp"] = true;
+  filter["currently_playing_type"] = true;
+  filter["context"]["uri"] = true;
+
+  DynamicJsonDocument doc(currentlyPlayingBufferSize);
+  DeserializationError error = deserializeJson(doc, spotifyConnections.body(), DeserializationOption::Filter(filter));
+  heap.stop();
+  if (error)
+  {
+    Serial.print(F("deserializeJson() failed with code "));
+    Serial.println(error.c_str());
+    return false;
+  }
+
+  memset(&payload, 0, sizeof(payload));
+  JsonObject item = doc["item"];
+  const char *currentlyPlayingType = doc["currently_playing_type"];
+  payload.episode = currentlyPlayingType != NULL && strcmp(currentlyPlayingType, "episode") == 0;
+  payload.isPlaying = doc["is_playing"].as<bool>();
+  payload.progressMs = doc["progress_ms"].as<long>();
+  payload.timestamp = doc["timestamp"].as<long long>();
+  payload.durationMs = item["duration_ms"].as<long>();
+  playingCopy(payload.trackName, sizeof(payload.trackName), item["name"].as<const char *>());
+  playingCopy(payload.trackUri, sizeof(payload.trackUri), item["uri"].as<const char *>());
+  playingCopy(payload.contextUri, sizeof(payload.contextUri), doc["context"]["uri"].as<const char *>());
+
+  JsonArray images;
+  if (payload.episode)
+  {
+    playingCopy(payload.albumName, sizeof(payload.albumName), item["show"]["name"].as<const char *>());
+    playingCopy(payload.albumUri, sizeof(payload.albumUri), item["show"]["uri"].as<const char *>());
+    images = item["images"];
+  }
+  else
+  {
+    int numArtists = item["artists"].size();
+    if (numArtists > SPOTIFY_MAX_NUM_ARTISTS)
+    {
+      numArtists = SPOTIFY_MAX_NUM_ARTISTS;
+    }
+    payload.numArtists = numArtists;
+    for (int i = 0; i < numArtists; i++)
+    {
+      PlayingArtist &artist = payload.artists[i];
+      playingCopy(artist.name, sizeof(artist.name), item["artists"][i]["name"].as<const char *>());
+      playingCopy(artist.uri, sizeof(artist.uri), item["artists"][i]["uri"].as<const char *>());
+    }
+    playingCopy(payload.albumName, sizeof(payload.albumName), item["album"]["name"].as<const char *>());
+    playingCopy(payload.albumUri, sizeof(payload.albumUri), item["album"]["uri"].as<const char *>());
+    images = item["album"]["images"];
+  }
+
+  int numImages = images.size();
+  if (numImages > SPOTIFY_NUM_ALBUM_IMAGES)
+  {
+    numImages = SPOTIFY_NUM_ALBUM_IMAGES;
+  }
+  payload.numImages = numImages;
+  for (int i = 0; i < numImages; i++)
+  {
+    PlayingImage &image = payload.images[i];
+    image.height = images[i]["height"].as<int>();
+    image.width = images[i]["width"].as<int>();
+    playingCopy(image.url, sizeof(image.url), images[i]["url"].as<const char *>());
+  }
+  return true;
+}
+
+// Same request as SpotifyArduino::getCurrentlyPlaying, but over our kept-alive
+// connection, into payload
+int getCurrentlyPlaying(PlayingPayload &payload, const char *market)
+{
+  char command[100];
+  snprintf(command, sizeof(command), "/v1/me/player/currently-playing?additional_types=episode&market=%s", market);
+
+  int statusCode = accessTokens.beginAuthorizedRequest(HOST_API, "GET", command);
+  if (statusCode == 200)
+  {
+    unsigned long start = micros();
+    HeapPeak heap;
+    unsigned long parseUs = 0;
+    bool parsed = CURRENTLY_PLAYING_STREAMING ? streamCurrentlyPlaying(payload, heap, parseUs)
+                                              : deserializeCurrentlyPlaying(payload, heap);
+    unsigned long totalUs = micros() - start;
+
+    Serial.print(CURRENTLY_PLAYING_STREAMING ? "Currently playing streamed in " : "Currently playing deserialized in ");
+    Serial.print(totalUs);
+    if (CURRENTLY_PLAYING_STREAMING)
+    {
+      Serial.print("us (parsing ");
+      Serial.print(parseUs);
+      Serial.print("us)");
+    }
+    else
+    {
+      Serial.print("us");
+    }
+    Serial.print(heap.exact ? ", heap peak while parsing: " : ", heap peak while parsing at most: ");
+    Serial.println((long)heap.bytes);
+
+    if (!parsed)
+    {
+      statusCode = -1;
+    }
+  }
+  spotifyConnections.endRequest();
+
+  return statusCode;
+}
+
+// Send a PUT (like) or DELETE (unlike) for a track to /v1/me/tracks
+// over the kept-alive api.spotify.com connection
+int sendLikedTrackRequest(const char *method, const char *trackId)
+{
+  if (strlen(trackId) == 0)
+  {
+    Serial.println("No track ID available");
+    return -1;
+  }
+
+  Serial.print(method);
+  Serial.print(" liked track ID: ");
+  Serial.println(trackId);
+
+  // The token manager keeps the access token fresh, so this is a single round trip
+  char url[80];
+  snprintf(url, sizeof(url), "/v1/me/tracks?ids=%s", trackId);
+  int response = accessTokens.authorizedRequest(HOST_API, method, url);
+
+  Serial.print("Response: ");
+  Serial.println(response);
+
+  return (response == 200 || response == 204) ? 200 : -1;
+}
+
+// Save track to liked songs via Spotify API
+int saveTrackToLiked(const char *trackId)
+{
+  int statusCode = sendLikedTrackRequest("PUT", trackId);
+  if (statusCode == 200)
+  {
+    Serial.println(">>> Track ADDED to favorites (via direct HTTP)");
+  }
+  else
+  {
+    Serial.println(">>> FAILED to add track");
+  }
+  return statusCode;
+}
+
+// Remove track from liked songs via Spotify API
+int removeTrackFromLiked(const char *trackId)
+{
+  int statusCode = sendLikedTrackRequest("DELETE", trackId);
+  if (statusCode == 200)
+  {
+    Serial.println(">>> Track REMOVED from favorites (via direct HTTP)");
+  }
+  else
+  {
+    Serial.println(">>> FAILED to remove track");
+  }
+  return statusCode;
+}
+
+int queueBufferSize = 6144;
+
+// Fills urls with the album art (the same size processImageInfo picks) of the
+// next tracks in the user's queue. Returns how many it found, or -1 on error.
+int getUpcomingAlbumArt(char urls[][200], int maxUrls)
+{
+  int statusCode = accessTokens.beginAuthorizedRequest(HOST_API, "GET", "/v1/me/player/queue");
+  if (statusCode != 200)
+  {
+    spotifyConnections.endRequest();
+    return -1;
+  }
+
+  StaticJsonDocument<128> filter;
+  filter["queue"][0]["album"]["images"][0]["url"] = true;
+
+  DynamicJsonDocument doc(queueBufferSize);
+  DeserializationError error = deserializeJson(doc, spotifyConnections.body(), DeserializationOption::Filter(filter));
+  spotifyConnections.endRequest();
+  // A long queue may not fit, but only the first few entries matter
+  if (error && error != DeserializationError::NoMemory)
+  {
+    Serial.print(F("deserializeJson() failed with code "));
+    Serial.println(error.c_str());
+    return -1;
+  }
+
+  int found = 0;
+  JsonArray queue = doc["queue"];
+  for (JsonObject queued : queue)
+  {
+    if (found >= maxUrls)
+    {
+      break;
+    }
+
+    // Episodes have no album, they are skipped
+    JsonArray images = queued["album"]["images"];
+    int numImages = images.size();
+    if (numImages > SPOTIFY_NUM_ALBUM_IMAGES)
+    {
+      numImages = SPOTIFY_NUM_ALBUM_IMAGES;
+    }
+    const char *url = numImages >= 2 ? images[numImages - 2]["url"].as<const char *>() : NULL;
+    if (url != NULL && strlen(url) < 200)
+    {
+      strcpy(urls[found++], url);
+    }
+  }
+  return found;
+}
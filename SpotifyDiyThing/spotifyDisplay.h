@@ -11,6 +11,12 @@ class SpotifyDisplay {
     virtual void displayTrackProgress(long progress, long duration) = 0;
     virtual void printCurrentlyPlayingToScreen(CurrentlyPlaying currentlyPlaying) = 0;
     virtual void displayFavoriteIndicator() = 0;
+    // Moves anything animated on by a frame (default implementation does nothing)
+    virtual void animate() {}
+    // Called when a redraw has finished drawing (default implementation does nothing)
+    virtual void endFrame() {}
+    // Drawing stats for the periodic log (default implementation does nothing)
+    virtual void printStats() {}
 
     //Probably Touch screen related
     virtual void checkForInput() =0;
@@ -18,7 +24,7 @@ class SpotifyDisplay {
     //Image Related
     virtual void clearImage()= 0;
     virtual boolean processImageInfo (CurrentlyPlaying currentlyPlaying)=0;
-    virtual int displayImage() = 0;
+    virtual int displayImage(const AlbumArt &art) = 0;
 
     virtual void drawWifiManagerMessage(WiFiManager *myWiFiManager) = 0;
     virtual void drawRefreshTokenMessage() = 0;
@@ -26,10 +32,15 @@ class SpotifyDisplay {
     // Backlight animation methods (default implementations do nothing for displays without backlight control)
     virtual void fadeBacklightOut(int durationMs = 300, int targetBrightness = 0) {}
     virtual void fadeBacklightIn(int durationMs = 300, int targetBrightness = 153) {}
+    // Fades don't block, this is false until the last one has finished
+    virtual bool backlightFadeDone() { return true; }
     
     // Progress bar reset method (default implementation does nothing)
     virtual void resetProgressBar() {}
 
+    // Local volume feedback while the knob is turned (default implementation does nothing)
+    virtual void showVolume(int volume) {}
+
     void setAlbumArtUrl(const char* albumArtUrl){
       strcpy(_albumArtUrl, albumArtUrl);
     }
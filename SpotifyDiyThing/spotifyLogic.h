@@ -2,33 +2,27 @@ SpotifyDisplay *sp_Display;
 
 SpotifyArduino spotify(client, NULL, NULL);
 
-// Store access token for manual HTTP requests (like track liking)
-char storedAccessToken[400] = "";
-
-// Store client credentials and refresh token for on-demand token refresh
-const char *storedClientId = NULL;
-const char *storedClientSecret = NULL;
-char storedRefreshToken[400] = "";
-
 bool albumArtChanged = false;
 bool textNeedsUpdate = false;
-CurrentlyPlaying lastCurrentlyPlaying;
+TrackState shownTrack;  // What the display shows, polls are diffed against it
+TrackState polledTrack; // The latest poll, before it is diffed
 
 long songStartMillis;
 long songDuration;
 
-char lastTrackUri[200];
-char lastTrackContextUri[200];
-
-// You might want to make this much smaller, so it will update responsively
-
-unsigned long delayBetweenRequests = 5000; // Time between requests (5 seconds)
-unsigned long requestDueTime;              // time when request due
-
 unsigned long delayBetweenProgressUpdates = 500; // Time between requests (0.5 seconds)
-unsigned long progressDueTime;                   // time when request due
 
-bool pauseSpotifyPolling = false;          // Pause polling during write operations to avoid SSL conflicts
+bool pollInFlight = false;         // A NET_POLL is queued or running on the network task
+bool imageInFlight = false;        // A NET_FETCH_IMAGE is queued or running on the network task
+bool forceRedraw = false;          // Redraw text and art with the next result, even if unchanged
+bool redrawFading = false;         // The backlight is fading out (or out) for a redraw
+bool redrawPending = false;        // Draw once the fade out has finished
+bool redrawImage = false;          // The pending redraw includes the album art
+
+// Art from the last NET_FETCH_IMAGE result, kept until the redraw has decoded
+// it. No more art is asked for until then, see albumArtRelease().
+AlbumArt pendingArt = {ART_NONE};
+char pendingArtUrl[200];
 
 void spotifySetup(SpotifyDisplay *theDisplay, const char *clientId, const char *clientSecret)
 {
@@ -36,269 +30,345 @@ void spotifySetup(SpotifyDisplay *theDisplay, const char *clientId, const char *
   client.setCACert(spotify_server_cert);
   spotify.lateInit(clientId, clientSecret);
 
-  // Store credentials for later use in manual token refresh
-  storedClientId = clientId;
-  storedClientSecret = clientSecret;
+  // Only used for the refresh token flow, API requests use our own token
+  spotify.autoTokenRefresh = false;
 
-  lastTrackUri[0] = '\0';
-  lastTrackContextUri[0] = '\0';
-}
+  spotifyConnections.begin();
+  accessTokens.begin(clientId, clientSecret);
 
-bool isSameTrack(const char *trackUri)
-{
-
-  return strcmp(lastTrackUri, trackUri) == 0;
+  shownTrack.clear();
 }
 
-void setTrackUri(const char *trackUri)
+void spotifyRefreshToken(const char *refreshToken)
 {
-  strcpy(lastTrackUri, trackUri);
+  accessTokens.setRefreshToken(refreshToken);
+
+  Serial.println("Refreshing Access Tokens");
+  if (!accessTokens.refresh())
+  {
+    Serial.println("Failed to get access tokens");
+  }
 }
 
-void setTrackContextUri(const char *trackContext)
+// Takes a poll into shownTrack, returns what changed (a TrackChange mask).
+// Only the progress bar and the play state are updated here, text and art
+// are left to the caller because they are drawn behind a fade.
+uint8_t handleCurrentlyPlaying(PlayingPayload &payload)
 {
-  if (trackContext == NULL)
+  polledTrack.set(payload);
+  if (!polledTrack.hasTrack())
   {
-    lastTrackContextUri[0] = '\0';
+    // An ad, or a private session, keep showing what was there. The song
+    // shown has ended, so nothing is timed from it any more.
+    songStartMillis = 0;
+    return 0;
   }
-  else
+
+  uint8_t changes = polledTrack.diff(shownTrack);
+  if (forceRedraw)
   {
-    strcpy(lastTrackContextUri, trackContext);
+    changes |= TRACK_CHANGED_ALL;
   }
-}
+  shownTrack = polledTrack;
 
-// Helper function to manually extract access token from Spotify API
-void extractAndStoreAccessToken(const char *clientId, const char *clientSecret, const char *refreshToken)
-{
-  WiFiClientSecure tokenClient;
-  tokenClient.setCACert(spotify_server_cert);
-  
-  if (!tokenClient.connect("accounts.spotify.com", 443))
+  if (changes & TRACK_CHANGED_TRACK)
   {
-    Serial.println("Failed to connect to accounts.spotify.com for token extraction");
-    return;
+    pollPolicy.trackChanged();
+
+    // Update rotary encoder with current track URI for liking
+    updateCurrentTrackUri(shownTrack.trackUri());
   }
-  
-  // Build the POST body
-  String postBody = "grant_type=refresh_token&refresh_token=" + String(refreshToken) +
-                   "&client_id=" + String(clientId) +
-                   "&client_secret=" + String(clientSecret);
-  
-  // Make the request
-  tokenClient.print(String("POST /api/token HTTP/1.1\r\n") +
-                   "Host: accounts.spotify.com\r\n" +
-                   "Content-Type: application/x-www-form-urlencoded\r\n" +
-                   "Content-Length: " + postBody.length() + "\r\n" +
-                   "Connection: close\r\n\r\n" +
-                   postBody);
-  
-  // Wait for response
-  unsigned long timeout = millis();
-  while (tokenClient.available() == 0)
+
+  // Mark that text needs update - will happen together with album art
+  if (changes & TRACK_CHANGED_TEXT)
   {
-    if (millis() - timeout > 5000)
-    {
-      Serial.println("Token request timeout");
-      tokenClient.stop();
-      return;
-    }
-    delay(10);
+    textNeedsUpdate = true;
   }
-  
-  // Skip headers
-  while (tokenClient.available())
+
+  // Update playing state for rotary encoder
+  updatePlayingState(shownTrack.isPlaying());
+
+  // A failed download leaves albumArtChanged set, so it is tried again
+  CurrentlyPlaying current;
+  shownTrack.toCurrentlyPlaying(current);
+  if (((changes & TRACK_CHANGED_ART) || albumArtChanged) && current.numImages >= 2)
   {
-    String line = tokenClient.readStringUntil('\n');
-    if (line == "\r")
-    {
-      break; // Headers end
-    }
+    albumArtChanged = sp_Display->processImageInfo(current);
   }
-  
-  // Read JSON response
-  String jsonResponse = tokenClient.readString();
-  tokenClient.stop();
-  
-  // Parse JSON to extract access_token
-  DynamicJsonDocument doc(1024);
-  DeserializationError error = deserializeJson(doc, jsonResponse);
-  
-  if (!error && doc.containsKey("access_token"))
+
+  if (shownTrack.isPlaying())
   {
-    const char *accessToken = doc["access_token"];
-    strcpy(storedAccessToken, accessToken);
-    Serial.println("Successfully extracted and stored access token");
+    // If we know at what millis the song started at, we can make a good guess
+    // at updating the progress bar more often than checking the API
+    songStartMillis = millis() - shownTrack.progressMs();
+    songDuration = shownTrack.durationMs();
   }
   else
   {
-    Serial.println("Failed to parse access token from response");
-    storedAccessToken[0] = '\0';
+    // Song doesn't seem to be playing, do not update the progress
+    songStartMillis = 0;
   }
-}
 
-void spotifyRefreshToken(const char *refreshToken)
-{
-  spotify.setRefreshToken(refreshToken);
-  
-  // Store refresh token for later use
-  strcpy(storedRefreshToken, refreshToken);
-
-  // If you want to enable some extra debugging
-  // uncomment the "#define SPOTIFY_DEBUG" in SpotifyArduino.h
-
-  Serial.println("Refreshing Access Tokens");
-  if (!spotify.refreshAccessToken())
+  // In between, updateProgressBar() keeps the bar moving on its own
+  if (changes & (TRACK_CHANGED_TRACK | TRACK_CHANGED_PLAY_STATE | TRACK_CHANGED_PROGRESS))
   {
-    Serial.println("Failed to get access tokens");
+    sp_Display->displayTrackProgress(shownTrack.progressMs(), shownTrack.durationMs());
   }
-  else
+  return changes;
+}
+
+// Runs every delayBetweenProgressUpdates
+void updateProgressBar()
+{
+  if (songStartMillis != 0)
   {
-    // Also extract and store the access token for manual HTTP requests
-    Serial.println("Extracting access token for manual API calls...");
-    extractAndStoreAccessToken(storedClientId, storedClientSecret, refreshToken);
+    long songProgress = millis() - songStartMillis;
+    if (songProgress > songDuration)
+    {
+      songProgress = songDuration;
+    }
+    sp_Display->displayTrackProgress(songProgress, songDuration);
   }
 }
 
-// Function to refresh stored access token on demand (for manual API calls)
-void refreshStoredAccessToken()
+// Starts fading out for a track change. The fade runs on its own, so the
+// art can download and decode while the screen goes dark.
+void beginRedrawFade()
 {
-  if (storedRefreshToken[0] != '\0' && storedClientId != NULL && storedClientSecret != NULL)
+  if (!redrawFading)
   {
-    Serial.println("Refreshing stored access token...");
-    extractAndStoreAccessToken(storedClientId, storedClientSecret, storedRefreshToken);
+    // Fade out to completely black before updating everything
+    sp_Display->fadeBacklightOut(600, 0); // Smooth fade out (600ms)
+    redrawFading = true;
   }
-  else
+}
+
+void requestAlbumArt()
+{
+  // Held art is asked for again once the redraw has let it go
+  if (!imageInFlight && pendingArt.source == ART_NONE &&
+      postNetCommand(NET_FETCH_IMAGE, 0, sp_Display->getAlbumArtUrl()))
   {
-    Serial.println("Cannot refresh token: credentials not initialized");
+    imageInFlight = true;
   }
 }
 
-void handleCurrentlyPlaying(CurrentlyPlaying currentlyPlaying)
+// Fades out, draws whatever changed and fades back in, so text and art change together.
+// The drawing waits in finishRedraw() until the fade out has finished.
+void redrawCurrentlyPlaying(bool drawImage)
 {
-  if (currentlyPlaying.trackUri != NULL)
+  beginRedrawFade();
+  redrawPending = true;
+  redrawImage = redrawImage || drawImage;
+}
+
+// Call from the UI loop, draws a pending redraw once the screen is dark
+void finishRedraw()
+{
+  if (!redrawPending || !sp_Display->backlightFadeDone())
   {
-    if (!isSameTrack(currentlyPlaying.trackUri))
-    {
-      setTrackUri(currentlyPlaying.trackUri);
-      setTrackContextUri(currentlyPlaying.contextUri);
+    return;
+  }
 
-      // Update rotary encoder with current track URI for liking
-      updateCurrentTrackUri(currentlyPlaying.trackUri);
+  // Reset progress bar for new song
+  sp_Display->resetProgressBar();
 
-      // Mark that text needs update - will happen together with album art
-      textNeedsUpdate = true;
+  // The art was already downloaded by the network task, this only decodes it
+  bool artOutdated = false;
+  if (redrawImage)
+  {
+    // The album can change again while the screen fades out
+    artOutdated = !sp_Display->isSameAlbum(pendingArtUrl);
+  }
+  if (redrawImage && !artOutdated)
+  {
+    // Art first, so it is out of the area to clear if the text needs it cleared early
+    sp_Display->clearImage();
+    int displayImageResult = sp_Display->displayImage(pendingArt);
+
+    if (displayImageResult)
+    {
+      albumArtChanged = false;
+    }
+    else
+    {
+      Serial.print("failed to display image: ");
+      Serial.println(displayImageResult);
     }
+  }
+  albumArtRelease(pendingArt);
 
-    // Store the current playing info for later use
-    lastCurrentlyPlaying = currentlyPlaying;
+  // Update text if needed (always do this for new songs)
+  if (textNeedsUpdate || forceRedraw)
+  {
+    CurrentlyPlaying current;
+    shownTrack.toCurrentlyPlaying(current);
+    sp_Display->printCurrentlyPlayingToScreen(current);
+    textNeedsUpdate = false;
+  }
 
-    // Update playing state for rotary encoder
-    updatePlayingState(currentlyPlaying.isPlaying);
+  // Whatever the new text and art didn't cover is cleared once here
+  sp_Display->endFrame();
 
-    albumArtChanged = sp_Display->processImageInfo(currentlyPlaying);
+  forceRedraw = false;
+  redrawPending = false;
+  redrawImage = false;
+  redrawFading = false;
+
+  // Fade back in smoothly after both text and image are displayed
+  sp_Display->fadeBacklightIn(600); // Smooth fade in (600ms)
+
+  if (artOutdated)
+  {
+    requestAlbumArt();
+  }
+}
+
+void handlePollResult(NetResult &result)
+{
+  pollInFlight = false;
 
-    sp_Display->displayTrackProgress(currentlyPlaying.progressMs, currentlyPlaying.durationMs);
+  if (result.status == 200)
+  {
+    Serial.println("Successfully got currently playing");
+    // polledTrack keeps its own copy, the payload slot is free again after this
+    uint8_t changes = handleCurrentlyPlaying(*result.payload);
 
-    if (currentlyPlaying.isPlaying)
+    // Next poll just after the song ends, or slowly while paused
+    if (songStartMillis != 0)
+    {
+      pollPolicy.playing(songStartMillis + songDuration);
+    }
+    else if (!polledTrack.hasTrack())
     {
-      // If we know at what millis the song started at, we can make a good guess
-      // at updating the progress bar more often than checking the API
-      songStartMillis = millis() - currentlyPlaying.progressMs;
-      songDuration = currentlyPlaying.durationMs;
+      pollPolicy.untimed();
     }
     else
     {
-      // Song doesn't seem to be playing, do not update the progress
-      songStartMillis = 0;
+      pollPolicy.paused();
+    }
+
+    // Only new art or new text fades, a pause, resume or seek never does
+    if (albumArtChanged || forceRedraw)
+    {
+      // Text is drawn together with the new art once it has been downloaded,
+      // the fade out overlaps the download
+      albumArtChanged = true;
+      requestAlbumArt();
+      beginRedrawFade();
+    }
+    else if (textNeedsUpdate)
+    {
+      redrawCurrentlyPlaying(false);
+    }
+
+    if (changes != 0)
+    {
+      Serial.print("Track changes: 0x");
+      Serial.println(changes, HEX);
     }
   }
+  else if (result.status == 204)
+  {
+    songStartMillis = 0;
+    Serial.println("Doesn't seem to be anything playing");
+    pollPolicy.idle();
+  }
+  else
+  {
+    Serial.print("Error: ");
+    Serial.println(result.status);
+    pollPolicy.failed();
+  }
 }
 
-void updateProgressBar()
+void handleImageResult(NetResult &result)
 {
-  if (songStartMillis != 0 && millis() > progressDueTime)
+  imageInFlight = false;
+
+  if (!sp_Display->isSameAlbum(result.arg))
   {
-    long songProgress = millis() - songStartMillis;
-    if (songProgress > songDuration)
+    // The album changed again while this one was downloading
+    albumArtRelease(result.art);
+    requestAlbumArt();
+    return;
+  }
+
+  if (result.ok)
+  {
+    pendingArt = result.art;
+    strcpy(pendingArtUrl, result.arg);
+    redrawCurrentlyPlaying(true);
+  }
+  else
+  {
+    Serial.println("failed to download image");
+    // Leave albumArtChanged set so the next poll tries again, but don't hold
+    // the text back (and bring the screen back from the fade out)
+    redrawCurrentlyPlaying(false);
+  }
+}
+
+// Call from the UI loop, handles everything the network task has finished
+void processNetworkResults()
+{
+  NetResult result;
+  while (takeNetResult(result))
+  {
+    switch (result.type)
     {
-      songProgress = songDuration;
+    case NET_POLL:
+      handlePollResult(result);
+      break;
+    case NET_SET_VOLUME:
+      onVolumeResult(result.value, result.ok);
+      break;
+    case NET_PLAY:
+    case NET_PAUSE:
+      onPlayStateResult(result.type == NET_PLAY, result.ok);
+      break;
+    case NET_LIKE:
+    case NET_UNLIKE:
+      onLikeResult(result.type == NET_LIKE, result.ok);
+      break;
+    case NET_FETCH_IMAGE:
+      handleImageResult(result);
+      break;
     }
-    sp_Display->displayTrackProgress(songProgress, songDuration);
-    progressDueTime = millis() + delayBetweenProgressUpdates;
   }
 }
 
+// Asks the network task for the currently playing song, the next poll is
+// scheduled by pollPolicy once the result is in
 void updateCurrentlyPlaying(boolean forceUpdate)
 {
-  // Skip polling if paused (e.g., during write operations)
-  if (pauseSpotifyPolling && !forceUpdate)
+  if (forceUpdate)
   {
-    return;
+    Serial.println("forcing an update");
+    forceRedraw = true;
   }
-  
-  if (forceUpdate || millis() > requestDueTime)
+
+  if (!pollInFlight)
   {
-    if (forceUpdate)
-    {
-      Serial.println("forcing an update");
-    }
     // Serial.print("Free Heap: ");
     // Serial.println(ESP.getFreeHeap());
 
     Serial.println("getting currently playing song:");
     // Check if music is playing currently on the account.
-    int status = spotify.getCurrentlyPlaying(handleCurrentlyPlaying, SPOTIFY_MARKET);
-    if (status == 200)
-    {
-      Serial.println("Successfully got currently playing");
-      if (albumArtChanged || forceUpdate || textNeedsUpdate)
-      {
-        // Smooth fade animation for synchronized text and image update
-        // Fade out to completely black before updating everything
-        sp_Display->fadeBacklightOut(600, 0); // Smooth fade out (600ms)
-        
-        // Reset progress bar for new song
-        sp_Display->resetProgressBar();
-        
-        // Update text if needed (always do this for new songs)
-        if (textNeedsUpdate || forceUpdate)
-        {
-          sp_Display->printCurrentlyPlayingToScreen(lastCurrentlyPlaying);
-          textNeedsUpdate = false;
-        }
-        
-        // Update image if album changed
-        if (albumArtChanged || forceUpdate)
-        {
-          sp_Display->clearImage();
-          int displayImageResult = sp_Display->displayImage();
-
-          if (displayImageResult)
-          {
-            albumArtChanged = false;
-          }
-          else
-          {
-            Serial.print("failed to display image: ");
-            Serial.println(displayImageResult);
-          }
-        }
-        
-        // Fade back in smoothly after both text and image are displayed
-        sp_Display->fadeBacklightIn(600); // Smooth fade in (600ms)
-      }
-    }
-    else if (status == 204)
+    pollInFlight = postNetCommand(NET_POLL);
+    if (pollInFlight)
     {
-      songStartMillis = 0;
-      Serial.println("Doesn't seem to be anything playing");
+      pollPolicy.sent();
     }
     else
     {
-      Serial.print("Error: ");
-      Serial.println(status);
+      pollPolicy.failed();
     }
-
-    requestDueTime = millis() + delayBetweenRequests;
   }
 }
+
+// The scheduler's poll task
+void pollCurrentlyPlaying()
+{
+  updateCurrentlyPlaying(false);
+}
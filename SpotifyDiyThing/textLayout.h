@@ -0,0 +1,244 @@
+// Word-wrapped text layout for the track info panel
+// Widths come straight from the glyph advances in the font tables, and the
+// line breaks, the ellipsis position and the line count all come out of one
+// walk over the text. Nothing is allocated, a TextBlock owns its text and its
+// line list, and the renderer just prints each line's bytes.
+//
+// This file is also compiled on the host by tools/textLayout, so it may only
+// use plain C++. GFXfont has to be declared before it is included.
+
+#ifndef TEXTLAYOUT_H
+#define TEXTLAYOUT_H
+
+#include <stdint.h>
+#include <string.h>
+
+#include "utf8.h"
+
+#define TEXT_LAYOUT_MAX_BYTES 256 // Longer text is cut (on a character boundary) before layout
+#define TEXT_LAYOUT_MAX_LINES 2
+#define TEXT_LAYOUT_ELLIPSIS "..."
+
+// Where the layout gets its widths from, so other font formats can plug in
+class GlyphMetrics
+{
+public:
+  virtual int advance(uint32_t codepoint) = 0;
+  virtual int lineHeight() = 0;
+};
+
+// Adafruit GFX fonts (Free_Fonts.h). Characters the font doesn't have take no
+// space, which is what TFT_eSPI does when it prints them.
+class GfxGlyphMetrics : public GlyphMetrics
+{
+public:
+  GfxGlyphMetrics(const GFXfont *font) : _font(font) {}
+
+  int advance(uint32_t codepoint) override
+  {
+    if (codepoint < _font->first || codepoint > _font->last)
+    {
+      return 0;
+    }
+    return _font->glyph[codepoint - _font->first].xAdvance;
+  }
+
+  int lineHeight() override
+  {
+    return _font->yAdvance;
+  }
+
+private:
+  const GFXfont *_font;
+};
+
+// Width of length bytes of text
+int measureText(GlyphMetrics &metrics, const char *text, int length)
+{
+  int width = 0;
+  for (int i = 0; i < length;)
+  {
+    int bytes;
+    width += metrics.advance(utf8Decode(text + i, bytes));
+    i += bytes;
+  }
+  return width;
+}
+
+struct TextLine
+{
+  uint16_t start;  // Byte offset into TextBlock::text
+  uint16_t length; // Bytes, trailing spaces not included
+  int16_t width;   // Pixels, ellipsis included
+  bool ellipsis;   // Print TEXT_LAYOUT_ELLIPSIS after the line
+};
+
+struct TextBlock
+{
+  char text[TEXT_LAYOUT_MAX_BYTES];
+  TextLine lines[TEXT_LAYOUT_MAX_LINES];
+  int lineCount;
+  int lineHeight;
+};
+
+// Copies text into the block, cutting it short on a character boundary
+void textBlockSet(TextBlock &block, const char *text)
+{
+  size_t length = strlen(text);
+  if (length >= TEXT_LAYOUT_MAX_BYTES)
+  {
+    length = TEXT_LAYOUT_MAX_BYTES - 1;
+    while (length > 0 && (text[length] & 0xC0) == 0x80)
+    {
+      length--;
+    }
+  }
+  memcpy(block.text, text, length);
+  block.text[length] = '\0';
+  block.lineCount = 0;
+}
+
+// Breaks block.text into at most maxLines lines of maxWidth pixels. Lines
+// break after the last space that fits, a word wider than a whole line is
+// split where it runs out of room. If the text doesn't fit, the last line is
+// cut where it still has room for the ellipsis, back at a word boundary
+// unless that wastes more than 30% of the line.
+//
+// Every character is measured once: the last place the ellipsis would still
+// fit is tracked both for the line and for the word being read, so a word
+// that wraps brings its own cut point along to the next line.
+void layoutText(TextBlock &block, GlyphMetrics &metrics, int maxWidth, int maxLines)
+{
+  if (maxLines > TEXT_LAYOUT_MAX_LINES)
+  {
+    maxLines = TEXT_LAYOUT_MAX_LINES;
+  }
+  block.lineCount = 0;
+  block.lineHeight = metrics.lineHeight();
+
+  const char *text = block.text;
+  int spaceWidth = metrics.advance(' ');
+  int ellipsisWidth = metrics.advance('.') * (sizeof(TEXT_LAYOUT_ELLIPSIS) - 1);
+  int fitLimit = maxWidth - ellipsisWidth;
+
+  int lineStart = 0;
+  int width = 0;
+  int lastSpace = -1;      // Last space on the line
+  int lastSpaceWidth = 0;  // Line width in front of it
+  int fitSpace = -1;       // Last space the ellipsis still fits in front of
+  int fitSpaceWidth = 0;
+  int fitEnd = 0;          // Last character end the ellipsis still fits after
+  int fitWidth = 0;
+  int wordStart = 0;       // Same again, relative to the start of the current word
+  int wordStartWidth = 0;
+  int wordFitEnd = 0;
+  int wordFitWidth = 0;
+
+  int pos = 0;
+  while (text[pos] != '\0')
+  {
+    int length;
+    uint32_t codepoint = utf8Decode(text + pos, length);
+
+    if (codepoint == ' ')
+    {
+      // Spaces never wrap, they hang off the end of the line
+      lastSpace = pos;
+      lastSpaceWidth = width;
+      if (width <= fitLimit)
+      {
+        fitSpace = pos;
+        fitSpaceWidth = width;
+      }
+      width += spaceWidth;
+      pos += length;
+      wordStart = pos;
+      wordStartWidth = width;
+      wordFitEnd = pos;
+      wordFitWidth = 0;
+      continue;
+    }
+
+    int advance = metrics.advance(codepoint);
+    if (width + advance > maxWidth && pos > lineStart)
+    {
+      TextLine &line = block.lines[block.lineCount++];
+      line.start = lineStart;
+
+      if (block.lineCount == maxLines)
+      {
+        bool atSpace = fitSpace > lineStart && fitSpaceWidth * 10 >= fitWidth * 7;
+        line.length = (atSpace ? fitSpace : fitEnd) - lineStart;
+        line.width = (atSpace ? fitSpaceWidth : fitWidth) + ellipsisWidth;
+        line.ellipsis = true;
+        return;
+      }
+
+      if (lastSpace > lineStart)
+      {
+        // Wrap at the last space, the word so far moves down
+        line.length = lastSpace - lineStart;
+        line.width = lastSpaceWidth;
+        lineStart = wordStart;
+        width -= wordStartWidth;
+        fitEnd = wordFitEnd;
+        fitWidth = wordFitWidth;
+      }
+      else
+      {
+        // One word wider than the line, split it here
+        line.length = pos - lineStart;
+        line.width = width;
+        lineStart = pos;
+        width = 0;
+        fitEnd = pos;
+        fitWidth = 0;
+      }
+      line.ellipsis = false;
+      while (line.length > 0 && text[line.start + line.length - 1] == ' ')
+      {
+        line.length--;
+        line.width -= spaceWidth;
+      }
+
+      lastSpace = -1;
+      fitSpace = -1;
+      wordStart = lineStart;
+      wordStartWidth = 0;
+      wordFitEnd = fitEnd;
+      wordFitWidth = fitWidth;
+      // The word moved down may already be too wide with this character,
+      // so look at it again against the new line
+      continue;
+    }
+
+    width += advance;
+    pos += length;
+    if (width <= fitLimit)
+    {
+      fitEnd = pos;
+      fitWidth = width;
+    }
+    if (width - wordStartWidth <= fitLimit)
+    {
+      wordFitEnd = pos;
+      wordFitWidth = width - wordStartWidth;
+    }
+  }
+
+  if (pos > lineStart)
+  {
+    TextLine &line = block.lines[block.lineCount++];
+    line.start = lineStart;
+    line.length = pos - lineStart;
+    line.width = width;
+    line.ellipsis = false;
+    while (line.length > 0 && text[line.start + line.length - 1] == ' ')
+    {
+      line.length--;
+      line.width -= spaceWidth;
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,176 @@
+// MM:SS time labels
+// The ten digits and the colon are drawn once into a small sprite (the
+// atlas) in the label font. A label then only pushes the cells whose
+// character changed, so a normal tick is one or two digit blits with no
+// font work and no heap allocation. Cells go out through a display list.
+
+#include <TFT_eSPI.h>
+
+#define TIME_LABEL_MAX_CHARS 7 // "999:59" and the terminator
+
+// Formats milliseconds as MM:SS (minutes can run past 99) into buffer
+void formatTime(long milliseconds, char *buffer, size_t size)
+{
+  if (milliseconds < 0)
+  {
+    milliseconds = 0;
+  }
+  long totalSeconds = milliseconds / 1000;
+  snprintf(buffer, size, "%02ld:%02ld", totalSeconds / 60, totalSeconds % 60);
+}
+
+class DigitAtlas
+{
+public:
+  DigitAtlas(TFT_eSPI *display, DisplayList *list) : _sprite(display), _list(list) {}
+
+  // baseline is where the glyph baseline sits inside a cell of the given height
+  bool begin(const GFXfont *font, uint16_t color, uint16_t background, int baseline, int height)
+  {
+    _sprite.setFreeFont(font);
+    _baseline = baseline;
+    _height = height;
+
+    // Digits share one cell width so a label never shifts sideways
+    _digitWidth = 0;
+    char glyph[2] = "0";
+    for (char c = '0'; c <= '9'; c++)
+    {
+      glyph[0] = c;
+      int width = _sprite.textWidth(glyph);
+      if (width > _digitWidth)
+      {
+        _digitWidth = width;
+      }
+    }
+    _colonWidth = _sprite.textWidth(":");
+
+    if (_sprite.createSprite(_digitWidth * 10 + _colonWidth, _height) == nullptr)
+    {
+      Serial.println("Not enough memory for the digit atlas");
+      return false;
+    }
+
+    _sprite.fillSprite(background);
+    _sprite.setTextColor(color, background);
+    for (char c = '0'; c <= '9'; c++)
+    {
+      glyph[0] = c;
+      // Centred in the cell, like a tabular figure
+      int x = (c - '0') * _digitWidth + (_digitWidth - _sprite.textWidth(glyph)) / 2;
+      _sprite.setCursor(x, _baseline);
+      _sprite.print(c);
+    }
+    _sprite.setCursor(_digitWidth * 10, _baseline);
+    _sprite.print(':');
+    return true;
+  }
+
+  bool ready()
+  {
+    return _sprite.created();
+  }
+
+  int cellWidth(char c)
+  {
+    return c == ':' ? _colonWidth : _digitWidth;
+  }
+
+  int textWidth(const char *text)
+  {
+    int width = 0;
+    while (*text)
+    {
+      width += cellWidth(*text++);
+    }
+    return width;
+  }
+
+  int height()
+  {
+    return _height;
+  }
+
+  // Pushes one character, y is the top of the cell
+  void draw(char c, int x, int y)
+  {
+    int sourceX = c == ':' ? _digitWidth * 10 : (c - '0') * _digitWidth;
+    _list->pushSprite(&_sprite, x, y, sourceX, 0, cellWidth(c), _height);
+  }
+
+private:
+  TFT_eSprite _sprite;
+  DisplayList *_list;
+  int _digitWidth = 0;
+  int _colonWidth = 0;
+  int _baseline = 0;
+  int _height = 0;
+};
+
+class TimeLabel
+{
+public:
+  TimeLabel(DisplayList *list, DigitAtlas *atlas) : _list(list), _atlas(atlas) {}
+
+  // y is the top of the label, right aligned labels end at x
+  void begin(int x, int y, bool alignRight, uint16_t background)
+  {
+    _x = x;
+    _y = y;
+    _alignRight = alignRight;
+    _background = background;
+    _shown[0] = '\0';
+    _shownWidth = 0;
+  }
+
+  // The next show() clears the old label and draws every cell
+  void reset()
+  {
+    _shown[0] = '\0';
+  }
+
+  void show(long milliseconds)
+  {
+    if (!_atlas->ready())
+    {
+      return;
+    }
+
+    char text[TIME_LABEL_MAX_CHARS];
+    formatTime(milliseconds, text, sizeof(text));
+
+    int width = _atlas->textWidth(text);
+    int left = _alignRight ? _x - width : _x;
+    bool sameLayout = strlen(text) == strlen(_shown);
+
+    if (!sameLayout && _shownWidth > 0)
+    {
+      // New track, or minutes gained or lost a digit, clear what was there before
+      int oldLeft = _alignRight ? _x - _shownWidth : _x;
+      _list->fill(oldLeft, _y, _shownWidth, _atlas->height(), _background);
+    }
+
+    int cellX = left;
+    for (int i = 0; text[i] != '\0'; i++)
+    {
+      if (!sameLayout || text[i] != _shown[i])
+      {
+        _atlas->draw(text[i], cellX, _y);
+      }
+      cellX += _atlas->cellWidth(text[i]);
+    }
+
+    strcpy(_shown, text);
+    _shownWidth = width;
+  }
+
+private:
+  DisplayList *_list;
+  DigitAtlas *_atlas;
+  int _x = 0;
+  int _y = 0;
+  bool _alignRight = false;
+  uint16_t _background = 0;
+  char _shown[TIME_LABEL_MAX_CHARS];
+  int _shownWidth = 0;
+};
@@ -0,0 +1,572 @@
+// TLS client with session resumption
+// WiFiClientSecure always does a full handshake, and on the ESP32 that handshake
+// is most of the time a new HTTPS connection takes. This client drives mbedTLS
+// directly so it can offer the session from the last connection to the same host
+// (session ticket or session ID), turning a reconnect into an abbreviated handshake.
+
+#include <lwip/sockets.h>
+
+#include "mbedtls/version.h"
+#include "mbedtls/ssl.h"
+#include "mbedtls/entropy.h"
+#include "mbedtls/ctr_drbg.h"
+#include "mbedtls/net_sockets.h"
+#include "mbedtls/x509_crt.h"
+
+#define TLS_CONNECT_TIMEOUT_MS 5000
+#define TLS_HANDSHAKE_TIMEOUT_MS 10000
+#define TLS_IO_TIMEOUT_MS 5000
+
+// Uncomment to also keep the sessions in RTC memory, so they survive a restart
+// #define TLS_SESSION_RTC_CACHE
+#define TLS_RTC_SESSION_SLOTS 3
+#define TLS_RTC_SESSION_BYTES 1800 // Sessions that don't fit are only kept in RAM
+
+// How many handshakes were resumed and how many were full. Unknown counts the
+// ones this mbedTLS version gives no way to tell apart.
+struct TlsHandshakeStats
+{
+  unsigned long resumed;
+  unsigned long full;
+  unsigned long unknown;
+};
+TlsHandshakeStats tlsHandshakeStats = {0, 0, 0};
+
+#if MBEDTLS_VERSION_NUMBER >= 0x03000000 && MBEDTLS_VERSION_NUMBER < 0x03040000
+#warning "mbedTLS 3.0-3.3 has no public session ID accessors, TLS handshakes are counted as unknown"
+#endif
+
+enum TlsResumption
+{
+  TLS_FULL,
+  TLS_RESUMED,
+  TLS_RESUMPTION_UNKNOWN
+};
+
+mbedtls_entropy_context tlsEntropy;
+mbedtls_ctr_drbg_context tlsCtrDrbg;
+bool tlsRngReady = false;
+
+bool tlsRngSetup()
+{
+  if (tlsRngReady)
+  {
+    return true;
+  }
+  mbedtls_entropy_init(&tlsEntropy);
+  mbedtls_ctr_drbg_init(&tlsCtrDrbg);
+  if (mbedtls_ctr_drbg_seed(&tlsCtrDrbg, mbedtls_entropy_func, &tlsEntropy, NULL, 0) != 0)
+  {
+    Serial.println("TLS random number generator seeding failed");
+    return false;
+  }
+  tlsRngReady = true;
+  return true;
+}
+
+#ifdef TLS_SESSION_RTC_CACHE
+#define TLS_RTC_MAGIC 0x544C5331
+
+struct RtcTlsSession
+{
+  uint32_t magic;
+  uint32_t hostHash;
+  uint32_t length;
+  uint8_t data[TLS_RTC_SESSION_BYTES];
+};
+
+// Survives a software restart, not a power cycle
+RTC_NOINIT_ATTR RtcTlsSession rtcTlsSessions[TLS_RTC_SESSION_SLOTS];
+
+uint32_t tlsHostHash(const char *host)
+{
+  uint32_t hash = 2166136261UL; // FNV-1a
+  while (*host)
+  {
+    hash = (hash ^ (uint8_t)*host++) * 16777619UL;
+  }
+  return hash;
+}
+#endif
+
+class ResumableTlsClient : public Client
+{
+public:
+  ResumableTlsClient()
+  {
+    mbedtls_ssl_init(&_ssl);
+    mbedtls_ssl_config_init(&_conf);
+    mbedtls_x509_crt_init(&_ca);
+    mbedtls_ssl_session_init(&_session);
+  }
+
+  ~ResumableTlsClient()
+  {
+    stop();
+    mbedtls_ssl_session_free(&_session);
+    mbedtls_x509_crt_free(&_ca);
+    mbedtls_ssl_config_free(&_conf);
+  }
+
+  // Which RTC slot this connection's session is kept in (when enabled)
+  void setRtcSlot(int slot)
+  {
+    _rtcSlot = slot;
+  }
+
+  int connect(IPAddress ip, uint16_t port, const char *host, const char *caCert)
+  {
+    stop();
+    _host = host;
+
+    if (!setupConfig(caCert) || !openSocket(ip, port))
+    {
+      stop();
+      return 0;
+    }
+
+    if (mbedtls_ssl_setup(&_ssl, &_conf) != 0 || mbedtls_ssl_set_hostname(&_ssl, host) != 0)
+    {
+      stop();
+      return 0;
+    }
+    _sslSetup = true;
+    _net.fd = _fd;
+    mbedtls_ssl_set_bio(&_ssl, &_net, mbedtls_net_send, mbedtls_net_recv, NULL);
+
+#ifdef TLS_SESSION_RTC_CACHE
+    loadRtcSession();
+#endif
+    if (_haveSession)
+    {
+      mbedtls_ssl_set_session(&_ssl, &_session);
+    }
+
+    if (!handshake())
+    {
+      // The cached session may be the problem, start clean next time
+      forgetSession();
+      stop();
+      return 0;
+    }
+
+    _connected = true;
+    saveSession();
+    return 1;
+  }
+
+  int connect(IPAddress ip, uint16_t port)
+  {
+    return connect(ip, port, _host, _caCert);
+  }
+
+  int connect(const char *host, uint16_t port)
+  {
+    IPAddress address;
+    if (!WiFi.hostByName(host, address))
+    {
+      return 0;
+    }
+    return connect(address, port, host, _caCert);
+  }
+
+  size_t write(uint8_t b)
+  {
+    return write(&b, 1);
+  }
+
+  size_t write(const uint8_t *buf, size_t size)
+  {
+    if (!_connected)
+    {
+      return 0;
+    }
+
+    size_t written = 0;
+    unsigned long start = millis();
+    while (written < size)
+    {
+      int ret = mbedtls_ssl_write(&_ssl, buf + written, size - written);
+      if (ret > 0)
+      {
+        written += ret;
+        start = millis();
+      }
+      else if ((ret == MBEDTLS_ERR_SSL_WANT_WRITE || ret == MBEDTLS_ERR_SSL_WANT_READ) &&
+               millis() - start < TLS_IO_TIMEOUT_MS)
+      {
+        delay(1);
+      }
+      else
+      {
+        _connected = false;
+        break;
+      }
+    }
+    return written;
+  }
+
+  int available()
+  {
+    if (!_connected)
+    {
+      return _peeked >= 0 ? 1 : 0;
+    }
+
+    int pending = mbedtls_ssl_get_bytes_avail(&_ssl);
+    if (pending == 0)
+    {
+      // Lets mbedTLS pull in the next record without blocking
+      int ret = mbedtls_ssl_read(&_ssl, NULL, 0);
+      if (ret < 0 && ret != MBEDTLS_ERR_SSL_WANT_READ && ret != MBEDTLS_ERR_SSL_WANT_WRITE)
+      {
+        _connected = false;
+      }
+      pending = mbedtls_ssl_get_bytes_avail(&_ssl);
+    }
+    return pending + (_peeked >= 0 ? 1 : 0);
+  }
+
+  int read()
+  {
+    uint8_t b;
+    return read(&b, 1) == 1 ? b : -1;
+  }
+
+  int read(uint8_t *buf, size_t size)
+  {
+    if (size == 0)
+    {
+      return 0;
+    }
+
+    int copied = 0;
+    if (_peeked >= 0)
+    {
+      buf[0] = _peeked;
+      _peeked = -1;
+      copied = 1;
+      if (size == 1 || !_connected || mbedtls_ssl_get_bytes_avail(&_ssl) == 0)
+      {
+        return copied;
+      }
+    }
+    if (!_connected)
+    {
+      return copied > 0 ? copied : -1;
+    }
+
+    int ret = mbedtls_ssl_read(&_ssl, buf + copied, size - copied);
+    if (ret > 0)
+    {
+      return copied + ret;
+    }
+    if (ret != MBEDTLS_ERR_SSL_WANT_READ && ret != MBEDTLS_ERR_SSL_WANT_WRITE)
+    {
+      // 0 or PEER_CLOSE_NOTIFY: the server closed the connection
+      _connected = false;
+    }
+    return copied > 0 ? copied : -1;
+  }
+
+  int peek()
+  {
+    if (_peeked < 0 && available() > 0)
+    {
+      _peeked = read();
+    }
+    return _peeked;
+  }
+
+  void flush() {}
+
+  void stop()
+  {
+    if (_sslSetup)
+    {
+      if (_connected)
+      {
+        mbedtls_ssl_close_notify(&_ssl);
+      }
+      mbedtls_ssl_free(&_ssl);
+      mbedtls_ssl_init(&_ssl);
+      _sslSetup = false;
+    }
+    if (_fd >= 0)
+    {
+      close(_fd);
+      _fd = -1;
+    }
+    _connected = false;
+    _peeked = -1;
+  }
+
+  uint8_t connected()
+  {
+    if (_connected)
+    {
+      // Picks up a close from the server while we were idle
+      available();
+    }
+    return _connected || _peeked >= 0;
+  }
+
+  operator bool()
+  {
+    return connected();
+  }
+
+  bool lastHandshakeResumed()
+  {
+    return _lastResumed;
+  }
+
+private:
+  bool setupConfig(const char *caCert)
+  {
+    if (_configured && caCert == _caCert)
+    {
+      return true;
+    }
+    if (!tlsRngSetup())
+    {
+      return false;
+    }
+
+    mbedtls_ssl_config_free(&_conf);
+    mbedtls_ssl_config_init(&_conf);
+    mbedtls_x509_crt_free(&_ca);
+    mbedtls_x509_crt_init(&_ca);
+    _configured = false;
+
+    // The CA chain is parsed once per host rather than on every connect
+    if (mbedtls_x509_crt_parse(&_ca, (const unsigned char *)caCert, strlen(caCert) + 1) != 0)
+    {
+      Serial.println("Failed to parse CA certificate");
+      return false;
+    }
+
+    if (mbedtls_ssl_config_defaults(&_conf, MBEDTLS_SSL_IS_CLIENT, MBEDTLS_SSL_TRANSPORT_STREAM,
+                                    MBEDTLS_SSL_PRESET_DEFAULT) != 0)
+    {
+      return false;
+    }
+    mbedtls_ssl_conf_authmode(&_conf, MBEDTLS_SSL_VERIFY_REQUIRED);
+    mbedtls_ssl_conf_ca_chain(&_conf, &_ca, NULL);
+    mbedtls_ssl_conf_rng(&_conf, mbedtls_ctr_drbg_random, &tlsCtrDrbg);
+#if defined(MBEDTLS_SSL_SESSION_TICKETS)
+    mbedtls_ssl_conf_session_tickets(&_conf, MBEDTLS_SSL_SESSION_TICKETS_ENABLED);
+#endif
+
+    _caCert = caCert;
+    _configured = true;
+    return true;
+  }
+
+  bool openSocket(IPAddress ip, uint16_t port)
+  {
+    _fd = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (_fd < 0)
+    {
+      return false;
+    }
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = (uint32_t)ip;
+    addr.sin_port = htons(port);
+
+    // Non-blocking so both the connect and later reads can time out
+    fcntl(_fd, F_SETFL, fcntl(_fd, F_GETFL, 0) | O_NONBLOCK);
+
+    int res = ::connect(_fd, (struct sockaddr *)&addr, sizeof(addr));
+    if (res < 0 && errno != EINPROGRESS)
+    {
+      return false;
+    }
+
+    fd_set fdset;
+    FD_ZERO(&fdset);
+    FD_SET(_fd, &fdset);
+    struct timeval tv;
+    tv.tv_sec = TLS_CONNECT_TIMEOUT_MS / 1000;
+    tv.tv_usec = (TLS_CONNECT_TIMEOUT_MS % 1000) * 1000;
+    if (select(_fd + 1, NULL, &fdset, NULL, &tv) <= 0)
+    {
+      return false;
+    }
+
+    int sockErr = 0;
+    socklen_t errLen = sizeof(sockErr);
+    getsockopt(_fd, SOL_SOCKET, SO_ERROR, &sockErr, &errLen);
+    if (sockErr != 0)
+    {
+      return false;
+    }
+
+    int noDelay = 1;
+    setsockopt(_fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+    return true;
+  }
+
+  // Whether the handshake just done took up the session that was offered.
+  // mbedTLS only says so in private fields, so this compares the sessions:
+  // a resumed handshake keeps the master secret, a full one makes a new one.
+  TlsResumption sessionResumed()
+  {
+    if (!_haveSession)
+    {
+      return TLS_FULL;
+    }
+#if MBEDTLS_VERSION_NUMBER >= 0x03000000 && MBEDTLS_VERSION_NUMBER < 0x03040000
+    // The session is private and there are no accessors for it yet
+    return TLS_RESUMPTION_UNKNOWN;
+#else
+    mbedtls_ssl_session negotiated;
+    mbedtls_ssl_session_init(&negotiated);
+    bool resumed = false;
+    if (mbedtls_ssl_get_session(&_ssl, &negotiated) == 0)
+    {
+#if MBEDTLS_VERSION_NUMBER < 0x03000000
+      resumed = memcmp(negotiated.master, _session.master, sizeof(_session.master)) == 0;
+#else
+      // The master secret is private from 3.0, the ID isn't. A ticket
+      // resumption comes back with a new ID, so it counts as full here.
+      size_t idLength = mbedtls_ssl_session_get_id_len(&negotiated);
+      resumed = idLength != 0 && idLength == mbedtls_ssl_session_get_id_len(&_session) &&
+                memcmp(mbedtls_ssl_session_get_id(&negotiated), mbedtls_ssl_session_get_id(&_session), idLength) == 0;
+#endif
+    }
+    mbedtls_ssl_session_free(&negotiated);
+    return resumed ? TLS_RESUMED : TLS_FULL;
+#endif
+  }
+
+  bool handshake()
+  {
+    unsigned long start = millis();
+    while (true)
+    {
+      int ret = mbedtls_ssl_handshake(&_ssl);
+      if (ret == 0)
+      {
+        break;
+      }
+      if (ret == MBEDTLS_ERR_SSL_WANT_READ || ret == MBEDTLS_ERR_SSL_WANT_WRITE)
+      {
+        if (millis() - start > TLS_HANDSHAKE_TIMEOUT_MS)
+        {
+          Serial.println("TLS handshake timed out");
+          return false;
+        }
+        delay(1);
+        continue;
+      }
+      Serial.print("TLS handshake failed: -0x");
+      Serial.println(-ret, HEX);
+      return false;
+    }
+
+    TlsResumption resumption = sessionResumed();
+    _lastResumed = resumption == TLS_RESUMED;
+    if (resumption == TLS_RESUMED)
+    {
+      tlsHandshakeStats.resumed++;
+      Serial.print("Resumed");
+    }
+    else if (resumption == TLS_FULL)
+    {
+      tlsHandshakeStats.full++;
+      Serial.print("Full");
+    }
+    else
+    {
+      tlsHandshakeStats.unknown++;
+      Serial.print("Completed");
+    }
+    Serial.print(" TLS handshake with ");
+    Serial.print(_host);
+    Serial.print(" in ");
+    Serial.print(millis() - start);
+    Serial.println("ms");
+    return true;
+  }
+
+  void saveSession()
+  {
+    mbedtls_ssl_session_free(&_session);
+    mbedtls_ssl_session_init(&_session);
+    _haveSession = mbedtls_ssl_get_session(&_ssl, &_session) == 0;
+
+#ifdef TLS_SESSION_RTC_CACHE
+    if (!_haveSession || _rtcSlot < 0 || _rtcSlot >= TLS_RTC_SESSION_SLOTS)
+    {
+      return;
+    }
+    RtcTlsSession &slot = rtcTlsSessions[_rtcSlot];
+    size_t length = 0;
+    if (mbedtls_ssl_session_save(&_session, slot.data, sizeof(slot.data), &length) == 0)
+    {
+      slot.hostHash = tlsHostHash(_host);
+      slot.length = length;
+      slot.magic = TLS_RTC_MAGIC;
+    }
+    else
+    {
+      slot.magic = 0;
+    }
+#endif
+  }
+
+  void forgetSession()
+  {
+    mbedtls_ssl_session_free(&_session);
+    mbedtls_ssl_session_init(&_session);
+    _haveSession = false;
+#ifdef TLS_SESSION_RTC_CACHE
+    if (_rtcSlot >= 0 && _rtcSlot < TLS_RTC_SESSION_SLOTS)
+    {
+      rtcTlsSessions[_rtcSlot].magic = 0;
+    }
+#endif
+  }
+
+#ifdef TLS_SESSION_RTC_CACHE
+  // After a restart the RAM copy is gone, but the RTC one may still be there
+  void loadRtcSession()
+  {
+    if (_haveSession || _rtcSlot < 0 || _rtcSlot >= TLS_RTC_SESSION_SLOTS)
+    {
+      return;
+    }
+    RtcTlsSession &slot = rtcTlsSessions[_rtcSlot];
+    if (slot.magic != TLS_RTC_MAGIC || slot.hostHash != tlsHostHash(_host) || slot.length > sizeof(slot.data))
+    {
+      return;
+    }
+    _haveSession = mbedtls_ssl_session_load(&_session, slot.data, slot.length) == 0;
+    if (!_haveSession)
+    {
+      forgetSession();
+    }
+  }
+#endif
+
+  const char *_host = NULL;
+  const char *_caCert = NULL;
+  int _rtcSlot = -1;
+
+  int _fd = -1;
+  mbedtls_net_context _net;
+  mbedtls_ssl_context _ssl;
+  mbedtls_ssl_config _conf;
+  mbedtls_x509_crt _ca;
+  mbedtls_ssl_session _session;
+  bool _configured = false;
+  bool _sslSetup = false;
+  bool _haveSession = false;
+  bool _connected = false;
+  bool _lastResumed = false;
+  int _peeked = -1;
+};
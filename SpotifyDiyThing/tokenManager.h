@@ -0,0 +1,159 @@
+// Access token handling for all Spotify API requests
+// Owns the single access token used by every request, remembers when it
+// expires (expires_in from the token response) and refreshes it before
+// that happens, so normal requests never have to wait for a token fetch.
+
+#define TOKEN_REFRESH_MARGIN_MS 300000 // Refresh 5 minutes before the token expires
+#define TOKEN_RETRY_DELAY_MS 30000     // Wait this long before retrying a failed refresh
+
+class AccessTokenManager
+{
+public:
+  void begin(const char *clientId, const char *clientSecret)
+  {
+    _clientId = clientId;
+    _clientSecret = clientSecret;
+  }
+
+  // The refresh token buffer has to outlive the manager
+  void setRefreshToken(const char *refreshToken)
+  {
+    _refreshToken = refreshToken;
+    _accessToken[0] = '\0';
+  }
+
+  // Fetches a new access token from accounts.spotify.com (blocking)
+  bool refresh()
+  {
+    _lastAttempt = millis();
+    _attempted = true;
+
+    if (_refreshToken == NULL || _refreshToken[0] == '\0' || _clientId == NULL || _clientSecret == NULL)
+    {
+      Serial.println("Cannot refresh token: credentials not initialized");
+      return false;
+    }
+
+    char postBody[600];
+    snprintf(postBody, sizeof(postBody), "grant_type=refresh_token&refresh_token=%s&client_id=%s&client_secret=%s",
+             _refreshToken, _clientId, _clientSecret);
+
+    unsigned long requestedAt = millis();
+    int statusCode = spotifyConnections.beginRequest(HOST_ACCOUNTS, "POST", "/api/token", NULL,
+                                                     postBody, "application/x-www-form-urlencoded");
+    if (statusCode != 200)
+    {
+      Serial.print("Token request failed: ");
+      Serial.println(statusCode);
+      spotifyConnections.endRequest();
+      return false;
+    }
+
+    StaticJsonDocument<64> filter;
+    filter["access_token"] = true;
+    filter["expires_in"] = true;
+
+    DynamicJsonDocument doc(1024);
+    DeserializationError error = deserializeJson(doc, spotifyConnections.body(), DeserializationOption::Filter(filter));
+    spotifyConnections.endRequest();
+
+    const char *accessToken = doc["access_token"];
+    if (error || accessToken == NULL || strlen(accessToken) >= sizeof(_accessToken))
+    {
+      Serial.println("Failed to parse access token from response");
+      return false;
+    }
+
+    strcpy(_accessToken, accessToken);
+    // Usually 3600 seconds, measured from when we asked for it
+    long expiresIn = doc["expires_in"] | 3600L;
+    _lifetimeMs = expiresIn * 1000UL;
+    _refreshedAt = requestedAt;
+
+    Serial.print("Got access token, expires in (s): ");
+    Serial.println(expiresIn);
+    return true;
+  }
+
+  bool hasToken()
+  {
+    return _accessToken[0] != '\0';
+  }
+
+  bool isExpired()
+  {
+    return !hasToken() || millis() - _refreshedAt >= _lifetimeMs;
+  }
+
+  // True when we are inside the refresh margin before expiry
+  bool isExpiring()
+  {
+    return !hasToken() || millis() - _refreshedAt + TOKEN_REFRESH_MARGIN_MS >= _lifetimeMs;
+  }
+
+  // Call when idle, refreshes the token ahead of expiry so no request has to
+  void loop()
+  {
+    if (!isExpiring())
+    {
+      return;
+    }
+    if (_attempted && millis() - _lastAttempt < TOKEN_RETRY_DELAY_MS)
+    {
+      return; // Don't hammer the accounts server if it keeps failing
+    }
+    Serial.println("Access token expiring soon, refreshing in the background");
+    refresh();
+  }
+
+  const char *token()
+  {
+    // Only reached if the background refresh didn't happen in time
+    if (isExpired())
+    {
+      refresh();
+    }
+    return _accessToken;
+  }
+
+  // Sends a request with the access token, a 401 gets exactly one retry with a new token.
+  // Same contract as ConnectionManager::beginRequest, endRequest() must be called after.
+  int beginAuthorizedRequest(HostId host, const char *method, const char *path,
+                             const char *body = NULL, const char *contentType = NULL)
+  {
+    int statusCode = spotifyConnections.beginRequest(host, method, path, token(), body, contentType);
+    if (statusCode == 401)
+    {
+      spotifyConnections.endRequest();
+      Serial.println("Access token rejected, refreshing and retrying once");
+      if (!refresh())
+      {
+        return statusCode;
+      }
+      statusCode = spotifyConnections.beginRequest(host, method, path, _accessToken, body, contentType);
+    }
+    return statusCode;
+  }
+
+  // Request where only the status code matters
+  int authorizedRequest(HostId host, const char *method, const char *path,
+                        const char *body = NULL, const char *contentType = NULL)
+  {
+    int statusCode = beginAuthorizedRequest(host, method, path, body, contentType);
+    spotifyConnections.endRequest();
+    return statusCode;
+  }
+
+private:
+  const char *_clientId = NULL;
+  const char *_clientSecret = NULL;
+  const char *_refreshToken = NULL;
+
+  char _accessToken[400] = "";
+  unsigned long _refreshedAt = 0;
+  unsigned long _lifetimeMs = 0;
+  unsigned long _lastAttempt = 0;
+  bool _attempted = false;
+};
+
+AccessTokenManager accessTokens;
@@ -0,0 +1,270 @@
+// The track the display shows, owned by the UI side
+// A TrackState keeps its own copy of everything it needs from a poll, so
+// nothing points into a response buffer that has since been freed. Strings
+// are interned into one fixed pool: each field is an offset, and text that
+// is already in the pool (an episode's show is both its artist and its
+// album) is stored once.
+//
+// Each poll is diffed against the shown state field by field. The change
+// mask says which parts of the screen need redrawing, so a pause or a
+// progress jump only touches the progress bar.
+
+#define TRACK_STATE_POOL_SIZE 2048
+#define TRACK_PROGRESS_JUMP_MS 3000 // Further from the predicted progress than this is a seek
+
+enum TrackChange : uint8_t
+{
+  TRACK_CHANGED_TRACK = 0x01,   // A different song (URI)
+  TRACK_CHANGED_TITLE = 0x02,
+  TRACK_CHANGED_ARTISTS = 0x04,
+  TRACK_CHANGED_ALBUM = 0x08,
+  TRACK_CHANGED_ART = 0x10,
+  TRACK_CHANGED_PLAY_STATE = 0x20,
+  TRACK_CHANGED_PROGRESS = 0x40, // Seeked, or a new duration
+  TRACK_CHANGED_TEXT = TRACK_CHANGED_TITLE | TRACK_CHANGED_ARTISTS | TRACK_CHANGED_ALBUM,
+  TRACK_CHANGED_ALL = 0x7F
+};
+
+struct TrackImage
+{
+  uint16_t url;
+  int width;
+  int height;
+};
+
+class TrackState
+{
+public:
+  void clear()
+  {
+    _pool[0] = '\0'; // Offset 0 is the empty string
+    _used = 1;
+    _trackName = _trackUri = _albumName = _albumUri = _contextUri = 0;
+    _numArtists = 0;
+    _numImages = 0;
+    _episode = false;
+    _isPlaying = false;
+    _progressMs = 0;
+    _durationMs = 0;
+    _receivedAt = 0;
+  }
+
+  // Copies what the display uses out of a parsed response
+  void set(PlayingPayload &payload)
+  {
+    clear();
+    _trackName = intern(payload.trackName);
+    _trackUri = intern(payload.trackUri);
+    _albumName = intern(payload.albumName);
+    _albumUri = intern(payload.albumUri);
+    _contextUri = intern(payload.contextUri);
+    _episode = payload.episode;
+
+    _numArtists = payload.numArtists;
+    for (int i = 0; i < _numArtists; i++)
+    {
+      _artistNames[i] = intern(payload.artists[i].name);
+      _artistUris[i] = intern(payload.artists[i].uri);
+    }
+    _numImages = payload.numImages;
+    for (int i = 0; i < _numImages; i++)
+    {
+      _images[i].url = intern(payload.images[i].url);
+      _images[i].width = payload.images[i].width;
+      _images[i].height = payload.images[i].height;
+    }
+
+    _isPlaying = payload.isPlaying;
+    _progressMs = payload.progressMs;
+    _durationMs = payload.durationMs;
+    _receivedAt = millis();
+  }
+
+  // What is different in this (newer) state from the one that was shown
+  uint8_t diff(TrackState &shown)
+  {
+    uint8_t changes = 0;
+    if (!same(_trackUri, shown, shown._trackUri))
+    {
+      changes |= TRACK_CHANGED_TRACK;
+    }
+    if (!same(_trackName, shown, shown._trackName))
+    {
+      changes |= TRACK_CHANGED_TITLE;
+    }
+    if (_numArtists != shown._numArtists || _episode != shown._episode)
+    {
+      changes |= TRACK_CHANGED_ARTISTS;
+    }
+    for (int i = 0; i < _numArtists && !(changes & TRACK_CHANGED_ARTISTS); i++)
+    {
+      if (!same(_artistNames[i], shown, shown._artistNames[i]))
+      {
+        changes |= TRACK_CHANGED_ARTISTS;
+      }
+    }
+    if (!same(_albumName, shown, shown._albumName))
+    {
+      changes |= TRACK_CHANGED_ALBUM;
+    }
+    if (_numImages != shown._numImages)
+    {
+      changes |= TRACK_CHANGED_ART;
+    }
+    for (int i = 0; i < _numImages && !(changes & TRACK_CHANGED_ART); i++)
+    {
+      if (!same(_images[i].url, shown, shown._images[i].url))
+      {
+        changes |= TRACK_CHANGED_ART;
+      }
+    }
+    if (_isPlaying != shown._isPlaying)
+    {
+      changes |= TRACK_CHANGED_PLAY_STATE;
+    }
+
+    // Progress moves on by itself while playing, only a seek counts
+    long predicted = shown._progressMs + (shown._isPlaying ? (long)(_receivedAt - shown._receivedAt) : 0);
+    if (_durationMs != shown._durationMs || labs(_progressMs - predicted) > TRACK_PROGRESS_JUMP_MS)
+    {
+      changes |= TRACK_CHANGED_PROGRESS;
+    }
+    return changes;
+  }
+
+  // Points current's strings into this state, which has to outlive it
+  void toCurrentlyPlaying(CurrentlyPlaying &current)
+  {
+    current.trackName = str(_trackName);
+    current.trackUri = _trackUri != 0 ? str(_trackUri) : NULL;
+    current.albumName = str(_albumName);
+    current.albumUri = str(_albumUri);
+    current.contextUri = _contextUri != 0 ? str(_contextUri) : NULL;
+    current.isPlaying = _isPlaying;
+    current.progressMs = _progressMs;
+    current.durationMs = _durationMs;
+    current.currentlyPlayingType = _episode ? SpotifyPlayingType::episode : SpotifyPlayingType::track;
+
+    if (_episode)
+    {
+      current.numArtists = 1;
+      current.artists[0].artistName = str(_albumName);
+      current.artists[0].artistUri = str(_albumUri);
+    }
+    else
+    {
+      current.numArtists = _numArtists;
+      for (int i = 0; i < _numArtists; i++)
+      {
+        current.artists[i].artistName = str(_artistNames[i]);
+        current.artists[i].artistUri = str(_artistUris[i]);
+      }
+    }
+
+    current.numImages = _numImages;
+    for (int i = 0; i < _numImages; i++)
+    {
+      current.albumImages[i].url = str(_images[i].url);
+      current.albumImages[i].width = _images[i].width;
+      current.albumImages[i].height = _images[i].height;
+    }
+  }
+
+  bool hasTrack()
+  {
+    return _trackUri != 0;
+  }
+
+  const char *trackUri()
+  {
+    return str(_trackUri);
+  }
+
+  bool isPlaying()
+  {
+    return _isPlaying;
+  }
+
+  long progressMs()
+  {
+    return _progressMs;
+  }
+
+  long durationMs()
+  {
+    return _durationMs;
+  }
+
+  // Pool bytes in use, out of TRACK_STATE_POOL_SIZE
+  size_t poolUsed()
+  {
+    return _used;
+  }
+
+private:
+  const char *str(uint16_t offset)
+  {
+    return _pool + offset;
+  }
+
+  bool same(uint16_t offset, TrackState &other, uint16_t otherOffset)
+  {
+    return strcmp(str(offset), other.str(otherOffset)) == 0;
+  }
+
+  // Offset of text in the pool, added if it isn't there yet. Text that
+  // doesn't fit is cut on a character boundary.
+  uint16_t intern(const char *text)
+  {
+    if (text[0] == '\0')
+    {
+      return 0;
+    }
+    for (size_t offset = 1; offset < _used; offset += strlen(_pool + offset) + 1)
+    {
+      if (strcmp(_pool + offset, text) == 0)
+      {
+        return offset;
+      }
+    }
+
+    size_t length = strlen(text);
+    if (_used + length + 1 > TRACK_STATE_POOL_SIZE)
+    {
+      if (_used + 1 >= TRACK_STATE_POOL_SIZE)
+      {
+        return 0;
+      }
+      length = TRACK_STATE_POOL_SIZE - _used - 1;
+      while (length > 0 && (text[length] & 0xC0) == 0x80)
+      {
+        length--;
+      }
+    }
+    uint16_t offset = _used;
+    memcpy(_pool + offset, text, length);
+    _pool[offset + length] = '\0';
+    _used += length + 1;
+    return offset;
+  }
+
+  char _pool[TRACK_STATE_POOL_SIZE];
+  size_t _used = 1;
+
+  uint16_t _trackName = 0;
+  uint16_t _trackUri = 0;
+  uint16_t _albumName = 0; // The show for an episode
+  uint16_t _albumUri = 0;
+  uint16_t _contextUri = 0;
+  uint16_t _artistNames[SPOTIFY_MAX_NUM_ARTISTS];
+  uint16_t _artistUris[SPOTIFY_MAX_NUM_ARTISTS];
+  int _numArtists = 0;
+  TrackImage _images[SPOTIFY_NUM_ALBUM_IMAGES];
+  int _numImages = 0;
+  bool _episode = false;
+
+  bool _isPlaying = false;
+  long _progressMs = 0;
+  long _durationMs = 0;
+  unsigned long _receivedAt = 0; // millis() when the poll came in
+};
@@ -0,0 +1,36 @@
+// UTF-8 helpers shared by the text layout and the transliteration
+//
+// Plain C++, also compiled on the host by the tools in tools/.
+
+#ifndef UTF8_H
+#define UTF8_H
+
+#include <stdint.h>
+
+// Decodes the UTF-8 sequence at text, length is set to the bytes it used.
+// Broken sequences come back as one byte of 0xFFFD.
+uint32_t utf8Decode(const char *text, int &length)
+{
+  uint8_t c = text[0];
+  int extra = c < 0x80 ? 0 : (c & 0xE0) == 0xC0 ? 1 : (c & 0xF0) == 0xE0 ? 2 : (c & 0xF8) == 0xF0 ? 3 : -1;
+  if (extra < 0)
+  {
+    length = 1;
+    return 0xFFFD;
+  }
+
+  uint32_t codepoint = extra == 0 ? c : c & (0x3F >> extra);
+  for (int i = 1; i <= extra; i++)
+  {
+    if ((text[i] & 0xC0) != 0x80)
+    {
+      length = 1;
+      return 0xFFFD;
+    }
+    codepoint = (codepoint << 6) | (text[i] & 0x3F);
+  }
+  length = extra + 1;
+  return codepoint;
+}
+
+#endif
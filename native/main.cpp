@@ -0,0 +1,222 @@
+// Runs the sketch on the host (pio run -e native), against a stand-in for the
+// Spotify servers (mockSpotify.h) and with the display drawn into memory.
+//
+//   .pio/build/native/program --seconds 20 --turn 6@4000 --click 8000
+//
+//   --spiffs DIR        folder used as SPIFFS (native/spiffs). The fonts in
+//                       data/ are copied in, and a config with made up
+//                       credentials is written if there is none
+//   --payloads A,B,...  currently playing responses to play in order
+//                       (tools/currentlyPlaying/payloads/track.json,episode.json)
+//   --images DIR        album art served for i.scdn.co (native/images)
+//   --seconds N         how long loop() runs (10)
+//   --png PATH          where the screen is saved at the end (native/screen.png)
+//   --turn STEPS@MS     turns the encoder that many steps, anticlockwise if
+//                       negative, MS after setup() finished
+//   --click MS          presses the encoder button for 100ms
+//
+// Run it from the repo root. At the end the panel traffic and the sketch's
+// own loop stats are printed and the screen saved.
+
+#include <Arduino.h>
+#include "shims/nativeHost.h"
+
+#include "../SpotifyDiyThing/SpotifyDiyThing.ino"
+
+#include "mockSpotify.h"
+
+#include <sys/stat.h>
+
+#define NATIVE_STEP_MS 5 // Encoder edges this far apart get past the ISR's debounce
+#define NATIVE_CLICK_MS 100
+
+static bool copyFile(const std::string &from, const std::string &to)
+{
+  FILE *in = fopen(from.c_str(), "rb");
+  if (in == NULL)
+  {
+    return false;
+  }
+  FILE *out = fopen(to.c_str(), "wb");
+  if (out == NULL)
+  {
+    fclose(in);
+    return false;
+  }
+  char buffer[4096];
+  size_t n;
+  while ((n = fread(buffer, 1, sizeof(buffer), in)) > 0)
+  {
+    fwrite(buffer, 1, n, out);
+  }
+  fclose(in);
+  return fclose(out) == 0;
+}
+
+// Fonts from data/ (as uploadfs would) and a config so setup() doesn't wait
+// for the WiFi portal or the refresh token page
+static void prepareSpiffs(const std::string &root)
+{
+  mkdir(root.c_str(), 0755);
+  DIR *dir = opendir("data");
+  if (dir != NULL)
+  {
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL)
+    {
+      struct stat info;
+      std::string to = root + "/" + entry->d_name;
+      if (entry->d_name[0] != '.' && stat(to.c_str(), &info) != 0)
+      {
+        copyFile(std::string("data/") + entry->d_name, to);
+      }
+    }
+    closedir(dir);
+  }
+
+  std::string config = root + SPOTIFY_CONFIG_JSON;
+  struct stat info;
+  if (stat(config.c_str(), &info) != 0)
+  {
+    FILE *f = fopen(config.c_str(), "w");
+    if (f != NULL)
+    {
+      fputs("{\"refreshToken\":\"native-refresh-token\",\"clientId\":\"native-client-id\","
+            "\"clientSecret\":\"native-client-secret\"}",
+            f);
+      fclose(f);
+    }
+  }
+}
+
+// One quadrature edge at a time, only one pin changes per step
+static void scheduleTurn(int steps, unsigned long at)
+{
+  static const int clockwise[4] = {0, 1, 3, 2}; // [CLK][DT] states in order
+  static int position = 3;                      // Both pins start high
+  for (int i = 0; i < abs(steps); i++)
+  {
+    position = (position + (steps > 0 ? 1 : 3)) % 4;
+    int state = clockwise[position];
+    nativeAfter(at + i * NATIVE_STEP_MS, [state]()
+    {
+      nativeSetPin(ENCODER_CLK, state >> 1);
+      nativeSetPin(ENCODER_DT, state & 1);
+    });
+  }
+}
+
+static void scheduleClick(unsigned long at)
+{
+  nativeAfter(at, []() { nativeSetPin(ENCODER_SW, LOW); });
+  nativeAfter(at + NATIVE_CLICK_MS, []() { nativeSetPin(ENCODER_SW, HIGH); });
+}
+
+static std::vector<std::string> split(const std::string &list)
+{
+  std::vector<std::string> parts;
+  size_t start = 0;
+  while (start <= list.size())
+  {
+    size_t comma = list.find(',', start);
+    if (comma == std::string::npos)
+    {
+      comma = list.size();
+    }
+    if (comma > start)
+    {
+      parts.push_back(list.substr(start, comma - start));
+    }
+    start = comma + 1;
+  }
+  return parts;
+}
+
+int main(int argc, char **argv)
+{
+  std::string spiffs = "native/spiffs";
+  std::string payloads = "tools/currentlyPlaying/payloads/track.json,tools/currentlyPlaying/payloads/episode.json";
+  std::string images = "native/images";
+  std::string png = "native/screen.png";
+  unsigned long seconds = 10;
+  std::vector<std::pair<int, unsigned long>> turns;
+  std::vector<unsigned long> clicks;
+
+  for (int i = 1; i + 1 < argc; i += 2)
+  {
+    std::string option = argv[i];
+    std::string value = argv[i + 1];
+    if (option == "--spiffs")
+    {
+      spiffs = value;
+    }
+    else if (option == "--payloads")
+    {
+      payloads = value;
+    }
+    else if (option == "--images")
+    {
+      images = value;
+    }
+    else if (option == "--seconds")
+    {
+      seconds = strtoul(value.c_str(), NULL, 10);
+    }
+    else if (option == "--png")
+    {
+      png = value;
+    }
+    else if (option == "--turn" && value.find('@') != std::string::npos)
+    {
+      turns.push_back({atoi(value.c_str()), strtoul(value.c_str() + value.find('@') + 1, NULL, 10)});
+    }
+    else if (option == "--click")
+    {
+      clicks.push_back(strtoul(value.c_str(), NULL, 10));
+    }
+    else
+    {
+      fprintf(stderr, "Unknown option %s, see native/main.cpp\n", option.c_str());
+      return 1;
+    }
+  }
+
+  static MockSpotify mock;
+  uint16_t port = mock.begin(split(payloads), images);
+  if (port == 0)
+  {
+    fprintf(stderr, "Couldn't start the mock Spotify server\n");
+    return 1;
+  }
+  nativeServerBegin(port);
+  prepareSpiffs(spiffs);
+  nativeSpiffsBegin(spiffs.c_str());
+
+  setup();
+
+  for (auto &turn : turns)
+  {
+    scheduleTurn(turn.first, turn.second);
+  }
+  for (unsigned long click : clicks)
+  {
+    scheduleClick(click);
+  }
+
+  unsigned long endAt = millis() + seconds * 1000;
+  while (millis() < endAt)
+  {
+    loop();
+  }
+
+  printLoopStats();
+  tft.printNativeStats();
+  Serial.print("Mock server requests: ");
+  Serial.println(mock.requestCount());
+  Serial.print(tft.writePng(png.c_str()) ? "Screen saved to " : "Couldn't save the screen to ");
+  Serial.println(png.c_str());
+  Serial.flush();
+
+  // The network task and the timers are still running, don't wait for them
+  _exit(0);
+}
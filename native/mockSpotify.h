@@ -0,0 +1,306 @@
+// Stands in for api.spotify.com, accounts.spotify.com and i.scdn.co on a
+// loopback port, in plain HTTP/1.1 with keep-alive, one thread a connection.
+//
+// The currently playing payloads are played in order, from where the first
+// one was recorded: progress_ms moves with the clock while playing, and the
+// next payload starts when one reaches its duration_ms (30 seconds for ones
+// without, like ads). With none it's 204, nothing playing. Play and pause
+// change is_playing, the other player calls just succeed. Images are served from a
+// folder as <id>.jpg, or the first .jpg there for ids it doesn't have.
+
+#pragma once
+
+#include <arpa/inet.h>
+#include <dirent.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <mutex>
+#include <regex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define MOCK_DEFAULT_DURATION_MS 30000
+
+class MockSpotify
+{
+public:
+  // Loads the payloads and starts listening, returns the port or 0
+  uint16_t begin(const std::vector<std::string> &payloadFiles, const std::string &imageDir)
+  {
+    for (const std::string &path : payloadFiles)
+    {
+      std::string text;
+      if (!readFile(path, text))
+      {
+        fprintf(stderr, "Mock: can't read %s\n", path.c_str());
+        continue;
+      }
+      std::smatch duration;
+      long durationMs = std::regex_search(text, duration, std::regex("\"duration_ms\"\\s*:\\s*(\\d+)"))
+                            ? std::stol(duration[1])
+                            : MOCK_DEFAULT_DURATION_MS;
+      _payloads.push_back({text, durationMs});
+    }
+    _imageDir = imageDir;
+
+    // Starts where the first payload was recorded
+    std::smatch progress;
+    if (!_payloads.empty() &&
+        std::regex_search(_payloads[0].text, progress, std::regex("\"progress_ms\"\\s*:\\s*(\\d+)")))
+    {
+      _progressAt = std::stol(progress[1]);
+    }
+
+    int listener = socket(AF_INET, SOCK_STREAM, 0);
+    int on = 1;
+    setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+    struct sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t length = sizeof(address);
+    if (bind(listener, (struct sockaddr *)&address, length) != 0 || listen(listener, 8) != 0 ||
+        getsockname(listener, (struct sockaddr *)&address, &length) != 0)
+    {
+      close(listener);
+      return 0;
+    }
+
+    _startedAt = millis();
+    std::thread(&MockSpotify::acceptLoop, this, listener).detach();
+    return ntohs(address.sin_port);
+  }
+
+  int requestCount()
+  {
+    std::lock_guard<std::mutex> lock(_lock);
+    return _requests;
+  }
+
+private:
+  struct Payload
+  {
+    std::string text;
+    long durationMs;
+  };
+
+  struct Request
+  {
+    std::string method;
+    std::string path;
+  };
+
+  static bool readFile(const std::string &path, std::string &out)
+  {
+    FILE *f = fopen(path.c_str(), "rb");
+    if (f == NULL)
+    {
+      return false;
+    }
+    char buffer[4096];
+    size_t n;
+    while ((n = fread(buffer, 1, sizeof(buffer), f)) > 0)
+    {
+      out.append(buffer, n);
+    }
+    fclose(f);
+    return true;
+  }
+
+  void acceptLoop(int listener)
+  {
+    while (true)
+    {
+      int fd = accept(listener, NULL, NULL);
+      if (fd >= 0)
+      {
+        std::thread(&MockSpotify::serve, this, fd).detach();
+      }
+    }
+  }
+
+  // Requests on one connection until the client closes it
+  void serve(int fd)
+  {
+    std::string pending;
+    Request request;
+    while (readRequest(fd, pending, request))
+    {
+      int status;
+      std::string contentType = "application/json";
+      std::string body = respond(request, status, contentType);
+      fprintf(stderr, "Mock: %s %s -> %d\n", request.method.c_str(), request.path.c_str(), status);
+
+      char head[256];
+      snprintf(head, sizeof(head), "HTTP/1.1 %d %s\r\nContent-Type: %s\r\nContent-Length: %u\r\n\r\n", status,
+               status < 300 ? "OK" : "Not Found", contentType.c_str(), (unsigned int)body.size());
+      std::string response = head + body;
+      if (send(fd, response.data(), response.size(), MSG_NOSIGNAL) != (ssize_t)response.size())
+      {
+        break;
+      }
+    }
+    close(fd);
+  }
+
+  // Reads the head and the Content-Length body of the next request
+  bool readRequest(int fd, std::string &pending, Request &request)
+  {
+    size_t headEnd;
+    while ((headEnd = pending.find("\r\n\r\n")) == std::string::npos)
+    {
+      if (!receive(fd, pending))
+      {
+        return false;
+      }
+    }
+    std::string head = pending.substr(0, headEnd);
+    size_t bodyLength = 0;
+    std::smatch match;
+    if (std::regex_search(head, match, std::regex("Content-Length:\\s*(\\d+)", std::regex::icase)))
+    {
+      bodyLength = std::stoul(match[1]);
+    }
+    while (pending.size() < headEnd + 4 + bodyLength)
+    {
+      if (!receive(fd, pending))
+      {
+        return false;
+      }
+    }
+    pending.erase(0, headEnd + 4 + bodyLength);
+
+    size_t methodEnd = head.find(' ');
+    size_t pathEnd = head.find(' ', methodEnd + 1);
+    request.method = head.substr(0, methodEnd);
+    request.path = head.substr(methodEnd + 1, pathEnd - methodEnd - 1);
+    return true;
+  }
+
+  static bool receive(int fd, std::string &pending)
+  {
+    char buffer[2048];
+    ssize_t n = recv(fd, buffer, sizeof(buffer), 0);
+    if (n <= 0)
+    {
+      return false;
+    }
+    pending.append(buffer, n);
+    return true;
+  }
+
+  std::string respond(const Request &request, int &status, std::string &contentType)
+  {
+    std::lock_guard<std::mutex> lock(_lock);
+    _requests++;
+    const std::string &path = request.path;
+    status = 200;
+
+    if (path == "/api/token")
+    {
+      return "{\"access_token\":\"native-access-token\",\"token_type\":\"Bearer\",\"expires_in\":3600}";
+    }
+    if (path.rfind("/v1/me/player/currently-playing", 0) == 0)
+    {
+      status = _payloads.empty() ? 204 : 200;
+      return currentlyPlaying();
+    }
+    if (path == "/v1/me/player/play" || path == "/v1/me/player/pause")
+    {
+      long progress = progressMs();
+      _playing = path == "/v1/me/player/play";
+      _progressAt = progress;
+      _startedAt = millis();
+      status = 204;
+      return "";
+    }
+    if (path.rfind("/v1/me/player/volume", 0) == 0)
+    {
+      status = 204;
+      return "";
+    }
+    if (path.rfind("/v1/me/tracks", 0) == 0)
+    {
+      return "";
+    }
+    if (path == "/v1/me/player/queue")
+    {
+      return "{\"currently_playing\":null,\"queue\":[]}";
+    }
+    if (path.rfind("/image/", 0) == 0)
+    {
+      std::string image;
+      if (readImage(path.substr(7), image))
+      {
+        contentType = "image/jpeg";
+        return image;
+      }
+    }
+    status = 404;
+    return "{\"error\":{\"status\":404,\"message\":\"Not found\"}}";
+  }
+
+  long progressMs()
+  {
+    return _playing ? _progressAt + (long)(millis() - _startedAt) : _progressAt;
+  }
+
+  std::string currentlyPlaying()
+  {
+    if (_payloads.empty())
+    {
+      return "";
+    }
+    long progress = progressMs();
+    while (progress >= _payloads[_current].durationMs)
+    {
+      progress -= _payloads[_current].durationMs;
+      _current = (_current + 1) % _payloads.size();
+    }
+    _progressAt = progress;
+    _startedAt = millis();
+
+    std::string text = _payloads[_current].text;
+    text = std::regex_replace(text, std::regex("\"progress_ms\"\\s*:\\s*\\d+"),
+                              "\"progress_ms\": " + std::to_string(progress));
+    text = std::regex_replace(text, std::regex("\"is_playing\"\\s*:\\s*(true|false)"),
+                              std::string("\"is_playing\": ") + (_playing ? "true" : "false"));
+    return text;
+  }
+
+  bool readImage(const std::string &id, std::string &out)
+  {
+    if (readFile(_imageDir + "/" + id + ".jpg", out))
+    {
+      return true;
+    }
+    DIR *dir = opendir(_imageDir.c_str());
+    if (dir == NULL)
+    {
+      return false;
+    }
+    bool found = false;
+    struct dirent *entry;
+    while (!found && (entry = readdir(dir)) != NULL)
+    {
+      std::string name = entry->d_name;
+      if (name.size() > 4 && name.compare(name.size() - 4, 4, ".jpg") == 0)
+      {
+        found = readFile(_imageDir + "/" + name, out);
+      }
+    }
+    closedir(dir);
+    return found;
+  }
+
+  std::vector<Payload> _payloads;
+  std::string _imageDir;
+  std::mutex _lock;
+  size_t _current = 0;
+  bool _playing = true;
+  long _progressAt = 0;
+  unsigned long _startedAt = 0;
+  int _requests = 0;
+};
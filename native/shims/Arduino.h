@@ -0,0 +1,457 @@
+// Arduino core stand-in for the native build
+// Just enough of the ESP32 Arduino core for the sketch to build and run on
+// Linux: time, GPIO, Serial (stdout), String, and the Print/Stream/Client
+// classes the libraries build on. Pins keep a level that the host can set
+// (see nativeHost.h), which runs the attached interrupt like the pin would.
+
+#pragma once
+
+#include <cmath>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <string>
+
+using std::max;
+using std::min;
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define IRAM_ATTR
+#define RTC_DATA_ATTR
+#define RTC_NOINIT_ATTR
+#define PROGMEM
+#define F(string) (string)
+#define pgm_read_byte(address) (*(const uint8_t *)(address))
+#define pgm_read_word(address) (*(const uint16_t *)(address))
+#define pgm_read_dword(address) (*(const uint32_t *)(address))
+#define pgm_read_ptr(address) (*(void *const *)(address))
+#define memcpy_P memcpy
+#define strcpy_P strcpy
+
+#define LOW 0
+#define HIGH 1
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+#define INPUT_PULLDOWN 0x09
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+#define constrain(amount, low, high) ((amount) < (low) ? (low) : ((amount) > (high) ? (high) : (amount)))
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+void pinMode(uint8_t pin, uint8_t mode);
+int digitalRead(uint8_t pin);
+void digitalWrite(uint8_t pin, uint8_t level);
+void attachInterrupt(uint8_t pin, void (*isr)(), int mode);
+void detachInterrupt(uint8_t pin);
+void noInterrupts();
+void interrupts();
+inline uint8_t digitalPinToInterrupt(uint8_t pin) { return pin; }
+
+long random(long max);
+long random(long min, long max);
+long map(long x, long inMin, long inMax, long outMin, long outMax);
+
+// Backlight PWM, the duty is only remembered
+double ledcSetup(uint8_t channel, double frequency, uint8_t resolution);
+void ledcAttachPin(uint8_t pin, uint8_t channel);
+void ledcWrite(uint8_t channel, uint32_t duty);
+uint32_t ledcRead(uint8_t channel);
+
+class String
+{
+public:
+  String() {}
+  String(const char *text) : _s(text != NULL ? text : "") {}
+  String(const std::string &text) : _s(text) {}
+  String(char c) : _s(1, c) {}
+  String(int value, unsigned char base = DEC) : _s(format(value, base)) {}
+  String(unsigned int value, unsigned char base = DEC) : _s(format(value, base)) {}
+  String(long value, unsigned char base = DEC) : _s(format(value, base)) {}
+  String(unsigned long value, unsigned char base = DEC) : _s(format(value, base)) {}
+  String(long long value, unsigned char base = DEC) : _s(format(value, base)) {}
+  String(unsigned long long value, unsigned char base = DEC) : _s(format(value, base)) {}
+  String(double value, unsigned int decimals = 2)
+  {
+    char buffer[64];
+    snprintf(buffer, sizeof(buffer), "%.*f", decimals, value);
+    _s = buffer;
+  }
+
+  const char *c_str() const { return _s.c_str(); }
+  unsigned int length() const { return _s.size(); }
+  bool reserve(unsigned int size)
+  {
+    _s.reserve(size);
+    return true;
+  }
+  char charAt(unsigned int index) const { return index < _s.size() ? _s[index] : 0; }
+  char operator[](unsigned int index) const { return charAt(index); }
+  char &operator[](unsigned int index) { return _s[index]; }
+
+  bool concat(const String &other)
+  {
+    _s += other._s;
+    return true;
+  }
+  bool concat(const char *text)
+  {
+    _s += text != NULL ? text : "";
+    return true;
+  }
+  bool concat(const char *text, unsigned int length)
+  {
+    _s.append(text, length);
+    return true;
+  }
+  bool concat(char c)
+  {
+    _s += c;
+    return true;
+  }
+  template <typename T>
+  String &operator+=(const T &value)
+  {
+    concat(String(value));
+    return *this;
+  }
+  template <typename T>
+  friend String operator+(const String &a, const T &b)
+  {
+    String sum = a;
+    sum += b;
+    return sum;
+  }
+  friend String operator+(const char *a, const String &b) { return String(a) + b; }
+
+  bool equals(const String &other) const { return _s == other._s; }
+  bool operator==(const String &other) const { return _s == other._s; }
+  bool operator==(const char *text) const { return _s == (text != NULL ? text : ""); }
+  bool operator!=(const String &other) const { return _s != other._s; }
+  bool operator!=(const char *text) const { return !(*this == text); }
+  bool operator<(const String &other) const { return _s < other._s; }
+
+  int indexOf(char c, unsigned int from = 0) const { return found(_s.find(c, from)); }
+  int indexOf(const String &text, unsigned int from = 0) const { return found(_s.find(text._s, from)); }
+  int lastIndexOf(char c) const { return found(_s.rfind(c)); }
+  int lastIndexOf(char c, unsigned int from) const { return found(_s.rfind(c, from)); }
+  int lastIndexOf(const String &text) const { return found(_s.rfind(text._s)); }
+  bool startsWith(const String &prefix) const { return _s.compare(0, prefix._s.size(), prefix._s) == 0; }
+  bool endsWith(const String &suffix) const
+  {
+    return _s.size() >= suffix._s.size() && _s.compare(_s.size() - suffix._s.size(), suffix._s.size(), suffix._s) == 0;
+  }
+  String substring(unsigned int from) const { return from < _s.size() ? String(_s.substr(from)) : String(); }
+  String substring(unsigned int from, unsigned int to) const
+  {
+    if (from > to)
+    {
+      std::swap(from, to);
+    }
+    return from < _s.size() ? String(_s.substr(from, to - from)) : String();
+  }
+
+  void replace(const String &find, const String &replacement)
+  {
+    if (find._s.empty())
+    {
+      return;
+    }
+    for (size_t at = _s.find(find._s); at != std::string::npos; at = _s.find(find._s, at + replacement._s.size()))
+    {
+      _s.replace(at, find._s.size(), replacement._s);
+    }
+  }
+  void remove(unsigned int index) { _s.erase(std::min<size_t>(index, _s.size())); }
+  void remove(unsigned int index, unsigned int count) { _s.erase(std::min<size_t>(index, _s.size()), count); }
+  void trim()
+  {
+    size_t start = _s.find_first_not_of(" \t\r\n");
+    size_t end = _s.find_last_not_of(" \t\r\n");
+    _s = start == std::string::npos ? std::string() : _s.substr(start, end - start + 1);
+  }
+  void toLowerCase()
+  {
+    for (char &c : _s)
+    {
+      c = tolower((unsigned char)c);
+    }
+  }
+  void toUpperCase()
+  {
+    for (char &c : _s)
+    {
+      c = toupper((unsigned char)c);
+    }
+  }
+  long toInt() const { return atol(_s.c_str()); }
+  float toFloat() const { return atof(_s.c_str()); }
+
+private:
+  static int found(size_t at) { return at == std::string::npos ? -1 : (int)at; }
+
+  template <typename T>
+  static std::string format(T value, unsigned char base)
+  {
+    if (base == DEC)
+    {
+      return std::to_string(value);
+    }
+    bool negative = value < 0;
+    unsigned long long magnitude = negative ? -(long long)value : (unsigned long long)value;
+    std::string digits;
+    do
+    {
+      digits.insert(digits.begin(), "0123456789ABCDEF"[magnitude % base]);
+      magnitude /= base;
+    } while (magnitude > 0);
+    return negative ? "-" + digits : digits;
+  }
+
+  std::string _s;
+};
+
+class Print;
+
+class Printable
+{
+public:
+  virtual ~Printable() {}
+  virtual size_t printTo(Print &p) const = 0;
+};
+
+class Print
+{
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t *buffer, size_t size)
+  {
+    size_t written = 0;
+    while (size-- > 0 && write(*buffer++) == 1)
+    {
+      written++;
+    }
+    return written;
+  }
+  size_t write(const char *text) { return text != NULL ? write((const uint8_t *)text, strlen(text)) : 0; }
+  size_t write(const char *buffer, size_t size) { return write((const uint8_t *)buffer, size); }
+  virtual int availableForWrite() { return 0; }
+  virtual void flush() {}
+
+  size_t print(const char *text) { return write(text); }
+  size_t print(const String &text) { return write(text.c_str(), text.length()); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(unsigned char value, int base = DEC) { return print(String((unsigned int)value, base)); }
+  size_t print(int value, int base = DEC) { return print(String(value, base)); }
+  size_t print(unsigned int value, int base = DEC) { return print(String(value, base)); }
+  size_t print(long value, int base = DEC) { return print(String(value, base)); }
+  size_t print(unsigned long value, int base = DEC) { return print(String(value, base)); }
+  size_t print(long long value, int base = DEC) { return print(String(value, base)); }
+  size_t print(unsigned long long value, int base = DEC) { return print(String(value, base)); }
+  size_t print(double value, int decimals = 2) { return print(String(value, decimals)); }
+  size_t print(const Printable &printable) { return printable.printTo(*this); }
+
+  size_t println() { return write("\r\n"); }
+  template <typename T>
+  size_t println(const T &value)
+  {
+    size_t written = print(value);
+    return written + println();
+  }
+  template <typename T>
+  size_t println(const T &value, int format)
+  {
+    size_t written = print(value, format);
+    return written + println();
+  }
+
+  size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)))
+  {
+    char buffer[256];
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    if (length < (int)sizeof(buffer))
+    {
+      return write(buffer, length);
+    }
+    std::string text(length + 1, '\0');
+    va_start(args, format);
+    vsnprintf(&text[0], text.size(), format, args);
+    va_end(args);
+    return write(text.c_str(), length);
+  }
+};
+
+class Stream : public Print
+{
+public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+
+  void setTimeout(unsigned long timeout) { _timeout = timeout; }
+  unsigned long getTimeout() { return _timeout; }
+
+  virtual size_t readBytes(char *buffer, size_t length)
+  {
+    size_t count = 0;
+    while (count < length)
+    {
+      int c = timedRead();
+      if (c < 0)
+      {
+        break;
+      }
+      buffer[count++] = (char)c;
+    }
+    return count;
+  }
+  size_t readBytes(uint8_t *buffer, size_t length) { return readBytes((char *)buffer, length); }
+
+  String readStringUntil(char terminator)
+  {
+    String text;
+    int c;
+    while ((c = timedRead()) >= 0 && c != terminator)
+    {
+      text += (char)c;
+    }
+    return text;
+  }
+  String readString()
+  {
+    String text;
+    int c;
+    while ((c = timedRead()) >= 0)
+    {
+      text += (char)c;
+    }
+    return text;
+  }
+
+  bool find(const char *target)
+  {
+    size_t matched = 0;
+    size_t length = strlen(target);
+    int c;
+    while (matched < length && (c = timedRead()) >= 0)
+    {
+      matched = c == target[matched] ? matched + 1 : (c == target[0] ? 1 : 0);
+    }
+    return matched == length;
+  }
+
+protected:
+  int timedRead()
+  {
+    unsigned long start = millis();
+    do
+    {
+      int c = read();
+      if (c >= 0)
+      {
+        return c;
+      }
+      delay(1);
+    } while (millis() - start < _timeout);
+    return -1;
+  }
+
+  unsigned long _timeout = 1000;
+};
+
+class IPAddress : public Printable
+{
+public:
+  IPAddress() {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : _address(a | (b << 8) | (c << 16) | ((uint32_t)d << 24)) {}
+  IPAddress(uint32_t address) : _address(address) {}
+
+  // Network byte order, like the ESP32 core
+  operator uint32_t() const { return _address; }
+  uint8_t operator[](int index) const { return (_address >> (index * 8)) & 0xFF; }
+  bool operator==(const IPAddress &other) const { return _address == other._address; }
+  bool operator!=(const IPAddress &other) const { return _address != other._address; }
+
+  String toString() const
+  {
+    char text[16];
+    snprintf(text, sizeof(text), "%u.%u.%u.%u", (*this)[0], (*this)[1], (*this)[2], (*this)[3]);
+    return String(text);
+  }
+
+  size_t printTo(Print &p) const { return p.print(toString()); }
+
+private:
+  uint32_t _address = 0;
+};
+
+class Client : public Stream
+{
+public:
+  virtual int connect(IPAddress ip, uint16_t port) = 0;
+  virtual int connect(const char *host, uint16_t port) = 0;
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t *buffer, size_t size) = 0;
+  virtual int read(uint8_t *buffer, size_t size) = 0;
+  virtual void stop() = 0;
+  virtual uint8_t connected() = 0;
+  virtual operator bool() = 0;
+  using Print::write;
+  using Stream::read;
+};
+
+// stdout, one write at a time so the two tasks' lines don't mix mid-write
+class HardwareSerial : public Stream
+{
+public:
+  void begin(unsigned long baud) {}
+  void end() {}
+  size_t write(uint8_t c) { return write(&c, 1); }
+  size_t write(const uint8_t *buffer, size_t size);
+  int available() { return 0; }
+  int read() { return -1; }
+  int peek() { return -1; }
+  void flush();
+  operator bool() { return true; }
+  using Print::write;
+};
+
+extern HardwareSerial Serial;
+
+// Heap numbers come from the host allocator: what the sketch has taken since
+// the first call, out of an ESP32's usual free heap, so the differences it
+// logs still mean something
+class EspClass
+{
+public:
+  uint32_t getFreeHeap();
+  uint32_t getMinFreeHeap();
+  uint32_t getMaxAllocHeap();
+  uint32_t getHeapSize();
+  void restart();
+};
+
+extern EspClass ESP;
+
+#include "freertos/FreeRTOS.h"
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <Arduino.h>
+
+class MDNSResponder
+{
+public:
+  bool begin(const char *hostName) { return true; }
+  void end() {}
+  void addService(const char *service, const char *proto, uint16_t port) {}
+};
+
+extern MDNSResponder MDNS;
@@ -0,0 +1,87 @@
+// File system for the native build, backed by a host directory
+// Paths are taken relative to the directory given to nativeSpiffsBegin(), and
+// the folders a path names are made when a file is written, since SPIFFS
+// names are flat. The size limit of the real partition is not enforced.
+
+#pragma once
+
+#include <Arduino.h>
+
+#include <memory>
+
+namespace fs
+{
+
+#define FILE_READ "r"
+#define FILE_WRITE "w"
+#define FILE_APPEND "a"
+
+enum SeekMode
+{
+  SeekSet = 0,
+  SeekCur = 1,
+  SeekEnd = 2
+};
+
+struct FileImpl;
+
+class File : public Stream
+{
+public:
+  File() {}
+  File(std::shared_ptr<FileImpl> impl) : _impl(impl) {}
+
+  size_t write(uint8_t c) { return write(&c, 1); }
+  size_t write(const uint8_t *buffer, size_t size);
+  int available();
+  int read();
+  size_t read(uint8_t *buffer, size_t size);
+  size_t readBytes(char *buffer, size_t length) { return read((uint8_t *)buffer, length); }
+  int peek();
+  void flush();
+  bool seek(uint32_t position, SeekMode mode);
+  bool seek(uint32_t position) { return seek(position, SeekSet); }
+  size_t position() const;
+  size_t size() const;
+  void close();
+  operator bool() const;
+  const char *path() const;
+  const char *name() const;
+  bool isDirectory();
+  File openNextFile(const char *mode = FILE_READ);
+  void rewindDirectory();
+
+  using Print::write;
+
+private:
+  std::shared_ptr<FileImpl> _impl;
+};
+
+class FS
+{
+public:
+  File open(const char *path, const char *mode = FILE_READ, bool create = false);
+  File open(const String &path, const char *mode = FILE_READ, bool create = false)
+  {
+    return open(path.c_str(), mode, create);
+  }
+  bool exists(const char *path);
+  bool exists(const String &path) { return exists(path.c_str()); }
+  bool remove(const char *path);
+  bool remove(const String &path) { return remove(path.c_str()); }
+  bool rename(const char *pathFrom, const char *pathTo);
+  bool rename(const String &pathFrom, const String &pathTo) { return rename(pathFrom.c_str(), pathTo.c_str()); }
+  bool mkdir(const char *path);
+  bool mkdir(const String &path) { return mkdir(path.c_str()); }
+  bool rmdir(const char *path);
+  bool rmdir(const String &path) { return rmdir(path.c_str()); }
+};
+
+} // namespace fs
+
+using fs::File;
+using fs::FS;
+using fs::SeekCur;
+using fs::SeekEnd;
+using fs::SeekMode;
+using fs::SeekSet;
@@ -0,0 +1,195 @@
+// Generated by tools/gfxFonts/vlwToGfx.cpp from data/NotoSans-16.vlw, do not edit
+// Stand-in for TFT_eSPI's FreeSans9pt7b in the native build, same line height
+
+#pragma once
+
+const uint8_t FreeSans9pt7bBitmaps[] PROGMEM = {
+  0x49, 0x24, 0x92, 0x48, 0x00, 0x10, 0x99, 0x99, 0x00, 0x04, 0x40, 0x90, 0x02, 0x04, 0x43, 0xFE,
+  0x11, 0x02, 0x20, 0x48, 0x01, 0x02, 0x21, 0xFF, 0x08, 0x81, 0x10, 0x24, 0x00, 0x80, 0x08, 0x04,
+  0x0F, 0x0C, 0x44, 0x12, 0x09, 0x00, 0x80, 0x30, 0x0E, 0x01, 0x80, 0x20, 0x14, 0x0B, 0x04, 0xC6,
+  0x3C, 0x04, 0x02, 0x00, 0x70, 0x0C, 0x80, 0x88, 0x88, 0x88, 0x89, 0x0C, 0x90, 0x72, 0x00, 0x40,
+  0x04, 0xE0, 0x92, 0x09, 0x11, 0x11, 0x11, 0x10, 0x12, 0x00, 0xE0, 0x1C, 0x04, 0xC1, 0x08, 0x21,
+  0x06, 0x60, 0x58, 0x0E, 0x01, 0xC0, 0x48, 0x18, 0x92, 0x1A, 0x41, 0xCC, 0x18, 0x87, 0x0F, 0x30,
+  0xAA, 0x00, 0x00, 0x44, 0x42, 0x21, 0x08, 0x46, 0x21, 0x0C, 0x61, 0x08, 0x41, 0x08, 0x21, 0x00,
+  0x02, 0x10, 0x42, 0x08, 0x42, 0x18, 0x42, 0x10, 0x84, 0x42, 0x10, 0x88, 0x44, 0x00, 0x08, 0x04,
+  0x02, 0x0F, 0xE1, 0x80, 0xE0, 0x90, 0x44, 0x00, 0x00, 0x04, 0x01, 0x00, 0x40, 0x10, 0x04, 0x1F,
+  0xF0, 0x40, 0x10, 0x04, 0x01, 0x00, 0x40, 0x00, 0x6D, 0xA0, 0x78, 0x00, 0x48, 0x02, 0x08, 0x10,
+  0x20, 0x81, 0x02, 0x08, 0x10, 0x20, 0x81, 0x02, 0x08, 0x10, 0x20, 0x3C, 0x31, 0x10, 0xD8, 0x28,
+  0x14, 0x0A, 0x05, 0x02, 0x81, 0x40, 0xA0, 0x58, 0x24, 0x33, 0x10, 0xF0, 0x08, 0xE4, 0x82, 0x08,
+  0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x80, 0x3C, 0x31, 0x30, 0xD0, 0x20, 0x10, 0x18, 0x08,
+  0x0C, 0x04, 0x04, 0x04, 0x06, 0x02, 0x02, 0x03, 0xFE, 0x1E, 0x0C, 0x46, 0x09, 0x02, 0x00, 0x80,
+  0x60, 0x10, 0x38, 0x01, 0x00, 0x20, 0x09, 0x02, 0x60, 0x8C, 0x41, 0xE0, 0x03, 0x00, 0xC0, 0x70,
+  0x14, 0x09, 0x02, 0x41, 0x10, 0xC4, 0x21, 0x10, 0x47, 0xFC, 0x04, 0x01, 0x00, 0x40, 0x10, 0x3F,
+  0x10, 0x18, 0x08, 0x04, 0x03, 0xE1, 0x8C, 0x02, 0x01, 0x00, 0x80, 0x48, 0x24, 0x11, 0x18, 0x78,
+  0x0E, 0x18, 0x08, 0x08, 0x04, 0x02, 0xE3, 0x89, 0x82, 0xC1, 0x40, 0xA0, 0x48, 0x24, 0x11, 0x10,
+  0x70, 0x7F, 0x80, 0x20, 0x08, 0x04, 0x01, 0x00, 0xC0, 0x20, 0x08, 0x04, 0x01, 0x00, 0xC0, 0x20,
+  0x08, 0x04, 0x01, 0x00, 0x3C, 0x31, 0x10, 0x58, 0x2C, 0x12, 0x09, 0x88, 0x7C, 0x42, 0x60, 0xA0,
+  0x50, 0x2C, 0x13, 0x18, 0xF0, 0x3C, 0x33, 0x10, 0xD0, 0x28, 0x14, 0x0A, 0x05, 0x82, 0x43, 0x1E,
+  0x80, 0x40, 0x40, 0x20, 0x60, 0xE0, 0xC0, 0x00, 0x0C, 0x60, 0x00, 0x00, 0x05, 0xA4, 0x00, 0x00,
+  0x01, 0x83, 0x06, 0x06, 0x01, 0x80, 0x30, 0x06, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+  0x80, 0x60, 0x18, 0x06, 0x03, 0x0E, 0x38, 0xE0, 0x00, 0x1C, 0x62, 0x43, 0x41, 0x03, 0x02, 0x02,
+  0x04, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x18, 0x07, 0xE0, 0x10, 0x20, 0x40, 0x21, 0x00, 0x24,
+  0x00, 0x48, 0x38, 0x10, 0x90, 0xC2, 0x21, 0x84, 0x43, 0x10, 0x86, 0x21, 0x0C, 0x42, 0x18, 0x84,
+  0x49, 0x98, 0x91, 0xCE, 0x20, 0x00, 0x20, 0x00, 0x30, 0x00, 0x1F, 0x00, 0x06, 0x00, 0x60, 0x06,
+  0x00, 0xB0, 0x09, 0x00, 0x90, 0x11, 0x81, 0x08, 0x10, 0x82, 0x0C, 0x3F, 0xC2, 0x04, 0x40, 0x64,
+  0x02, 0x40, 0x20, 0x7E, 0x10, 0x44, 0x19, 0x02, 0x40, 0x90, 0x64, 0x11, 0xF8, 0x41, 0x10, 0x24,
+  0x09, 0x02, 0x40, 0x90, 0x67, 0xE0, 0x1F, 0x06, 0x31, 0x02, 0x20, 0x2C, 0x05, 0x80, 0x20, 0x04,
+  0x00, 0x80, 0x18, 0x03, 0x01, 0x20, 0x24, 0x08, 0x63, 0x07, 0xC0, 0x7E, 0x10, 0xC4, 0x09, 0x02,
+  0x40, 0x50, 0x14, 0x05, 0x01, 0x40, 0x50, 0x14, 0x05, 0x02, 0x40, 0x90, 0xC7, 0xE0, 0x7F, 0xA0,
+  0x10, 0x08, 0x04, 0x02, 0x01, 0x00, 0xFE, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0xFE, 0x7F,
+  0xA0, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00, 0xFE, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00,
+  0x1F, 0x06, 0x31, 0x83, 0x20, 0x24, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC3, 0xD8, 0x09, 0x01, 0x20,
+  0x26, 0x04, 0x61, 0x87, 0xC0, 0x40, 0x48, 0x09, 0x01, 0x20, 0x24, 0x04, 0x80, 0x90, 0x13, 0xFE,
+  0x40, 0x48, 0x09, 0x01, 0x20, 0x24, 0x04, 0x80, 0x90, 0x10, 0x49, 0x24, 0x92, 0x49, 0x24, 0x90,
+  0x01, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x68, 0x34, 0x13, 0x18,
+  0x78, 0x40, 0xC8, 0x31, 0x0C, 0x21, 0x04, 0x40, 0x90, 0x16, 0x03, 0xC0, 0x6C, 0x08, 0xC1, 0x08,
+  0x20, 0x84, 0x18, 0x81, 0x10, 0x10, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00, 0x80, 0x40,
+  0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0xFC, 0x40, 0x09, 0x80, 0x66, 0x01, 0x9C, 0x06, 0x50, 0x29,
+  0x40, 0xA5, 0x86, 0x92, 0x12, 0x48, 0x49, 0x13, 0x24, 0x48, 0x91, 0x22, 0x43, 0x09, 0x0C, 0x24,
+  0x30, 0x80, 0x40, 0x6C, 0x0D, 0x81, 0xA8, 0x35, 0x86, 0x90, 0xD3, 0x1A, 0x23, 0x42, 0x68, 0x4D,
+  0x05, 0xA0, 0xF4, 0x0E, 0x81, 0xD0, 0x18, 0x1F, 0x06, 0x31, 0x03, 0x20, 0x2C, 0x05, 0x00, 0xA0,
+  0x14, 0x02, 0x80, 0x50, 0x0B, 0x01, 0x20, 0x24, 0x0C, 0x63, 0x07, 0xC0, 0x7E, 0x10, 0x64, 0x09,
+  0x03, 0x40, 0xD0, 0x34, 0x09, 0x06, 0x7F, 0x10, 0x04, 0x01, 0x00, 0x40, 0x10, 0x04, 0x00, 0x1F,
+  0x06, 0x31, 0x03, 0x20, 0x2C, 0x05, 0x00, 0xA0, 0x14, 0x02, 0x80, 0x50, 0x0B, 0x01, 0x20, 0x24,
+  0x0C, 0x63, 0x07, 0xC0, 0x04, 0x00, 0x40, 0x00, 0x7E, 0x10, 0x44, 0x09, 0x02, 0x40, 0x90, 0x24,
+  0x09, 0x06, 0x7E, 0x10, 0x84, 0x31, 0x04, 0x41, 0x90, 0x24, 0x0C, 0x1F, 0x06, 0x30, 0x81, 0x30,
+  0x26, 0x00, 0x40, 0x06, 0x00, 0x78, 0x01, 0x80, 0x18, 0x01, 0x20, 0x26, 0x04, 0x61, 0x07, 0xC0,
+  0x7F, 0xE0, 0x80, 0x10, 0x02, 0x00, 0x40, 0x08, 0x01, 0x00, 0x20, 0x04, 0x00, 0x80, 0x10, 0x02,
+  0x00, 0x40, 0x08, 0x01, 0x00, 0x40, 0x50, 0x14, 0x05, 0x01, 0x40, 0x50, 0x14, 0x05, 0x01, 0x40,
+  0x50, 0x14, 0x05, 0x03, 0x40, 0x88, 0x61, 0xE0, 0x40, 0x24, 0x06, 0x40, 0x42, 0x04, 0x20, 0x42,
+  0x08, 0x30, 0x81, 0x08, 0x11, 0x01, 0x90, 0x09, 0x00, 0xA0, 0x0E, 0x00, 0x60, 0x06, 0x00, 0x40,
+  0x81, 0x20, 0xC0, 0x90, 0x70, 0xCC, 0x28, 0x42, 0x14, 0x21, 0x1A, 0x10, 0x88, 0x88, 0x44, 0x48,
+  0x12, 0x24, 0x0B, 0x12, 0x05, 0x05, 0x02, 0x83, 0x81, 0xC1, 0x80, 0x40, 0xC0, 0x20, 0x20, 0x40,
+  0x44, 0x08, 0xC2, 0x08, 0xC1, 0x90, 0x16, 0x01, 0x80, 0x30, 0x0E, 0x01, 0x60, 0x64, 0x08, 0xC2,
+  0x08, 0xC0, 0x90, 0x18, 0x40, 0x68, 0x08, 0x83, 0x10, 0x41, 0x18, 0x22, 0x02, 0xC0, 0x50, 0x06,
+  0x00, 0x80, 0x10, 0x02, 0x00, 0x40, 0x08, 0x01, 0x00, 0x7F, 0xC0, 0x18, 0x02, 0x00, 0x80, 0x10,
+  0x04, 0x01, 0x80, 0x20, 0x0C, 0x01, 0x00, 0x40, 0x18, 0x02, 0x00, 0xC0, 0x1F, 0xF0, 0x74, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x47, 0x00, 0x40, 0x40, 0x40, 0x20, 0x20, 0x30, 0x10,
+  0x10, 0x18, 0x08, 0x08, 0x0C, 0x04, 0x04, 0x06, 0x02, 0xE2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+  0x22, 0x22, 0x2E, 0x00, 0x00, 0x30, 0x61, 0x42, 0x44, 0x91, 0x21, 0xFF, 0x00, 0x00, 0xC4, 0x20,
+  0x3C, 0x42, 0x82, 0x03, 0x3F, 0x43, 0x83, 0x83, 0x83, 0xC7, 0x79, 0xC0, 0x60, 0x30, 0x18, 0x0D,
+  0xC7, 0x13, 0x05, 0x82, 0xC1, 0x60, 0xB0, 0x58, 0x2C, 0x17, 0x13, 0x70, 0x1E, 0x10, 0x98, 0x68,
+  0x14, 0x02, 0x01, 0x00, 0x80, 0x60, 0x90, 0x87, 0x80, 0x01, 0x01, 0x01, 0x01, 0x3D, 0x63, 0xC1,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0xC1, 0x63, 0x3D, 0x1E, 0x18, 0x98, 0x68, 0x17, 0xFA, 0x01, 0x00,
+  0x80, 0x60, 0x18, 0x87, 0x80, 0x0C, 0x20, 0xC1, 0x02, 0x0F, 0x88, 0x10, 0x20, 0x40, 0x81, 0x02,
+  0x04, 0x08, 0x10, 0x3D, 0x63, 0xC1, 0x81, 0x81, 0x81, 0x81, 0x81, 0xC1, 0x63, 0x3D, 0x01, 0x03,
+  0x42, 0x3C, 0xC0, 0xC0, 0xC0, 0xC0, 0xDE, 0xE2, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+  0xC1, 0x40, 0x55, 0x55, 0x54, 0x10, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0xE0, 0xC0,
+  0x60, 0x30, 0x18, 0x0C, 0x26, 0x23, 0x21, 0xB0, 0xF0, 0x78, 0x32, 0x19, 0x8C, 0x46, 0x13, 0x0C,
+  0x55, 0x55, 0x55, 0x54, 0xDC, 0x79, 0xC5, 0x1B, 0x0C, 0x16, 0x08, 0x2C, 0x10, 0x58, 0x20, 0xB0,
+  0x41, 0x60, 0x82, 0xC1, 0x05, 0x82, 0x0B, 0x04, 0x10, 0xDE, 0xE2, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+  0xC1, 0xC1, 0xC1, 0xC1, 0x1E, 0x0C, 0x46, 0x09, 0x02, 0x40, 0xD0, 0x34, 0x0D, 0x02, 0x60, 0x8C,
+  0x41, 0xE0, 0xDC, 0x71, 0x30, 0x58, 0x2C, 0x16, 0x0B, 0x05, 0x82, 0xC1, 0x71, 0x37, 0x18, 0x0C,
+  0x06, 0x03, 0x00, 0x3D, 0x63, 0xC1, 0x81, 0x81, 0x81, 0x81, 0x81, 0xC1, 0x63, 0x3D, 0x01, 0x01,
+  0x01, 0x01, 0xDB, 0x8C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x00, 0x3C, 0x46, 0xC2, 0xC0, 0x60,
+  0x1C, 0x06, 0x02, 0x82, 0x42, 0x3C, 0x20, 0x82, 0x3E, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x30,
+  0x60, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0x43, 0x63, 0x3D, 0x41, 0x20, 0x90, 0x44,
+  0x42, 0x21, 0x10, 0x50, 0x28, 0x1C, 0x04, 0x02, 0x00, 0x43, 0x09, 0x0C, 0x24, 0x30, 0x88, 0xC4,
+  0x24, 0x90, 0x92, 0x42, 0x49, 0x06, 0x18, 0x18, 0x60, 0x61, 0x81, 0x86, 0x00, 0x41, 0x11, 0x88,
+  0x82, 0x81, 0xC0, 0x40, 0x70, 0x28, 0x22, 0x31, 0x90, 0x40, 0x41, 0x20, 0x90, 0x44, 0x42, 0x21,
+  0x10, 0x50, 0x28, 0x1C, 0x04, 0x02, 0x01, 0x01, 0x00, 0x81, 0x80, 0x7F, 0x01, 0x80, 0x80, 0x80,
+  0x40, 0x40, 0x60, 0x20, 0x20, 0x30, 0x1F, 0xE0, 0x00, 0x18, 0x60, 0x81, 0x02, 0x04, 0x08, 0x10,
+  0x41, 0x81, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x60, 0x60, 0x00, 0x55, 0x55, 0x55, 0x55, 0x40,
+  0x01, 0x02, 0x08, 0x20, 0xC3, 0x0C, 0x10, 0x40, 0xC4, 0x10, 0xC3, 0x0C, 0x20, 0x82, 0x10, 0x00,
+  0x30, 0x09, 0x89, 0x19, 0x41, 0xC0, 0x00,
+};
+
+const GFXglyph FreeSans9pt7bGlyphs[] PROGMEM = {
+  {    0,   0,   0,   5,    0,    0}, // 0x20
+  {    0,   3,  15,   5,    1,  -15}, // 0x21
+  {    6,   4,   5,   6,    1,  -15}, // 0x22
+  {    9,  11,  15,  11,    0,  -15}, // 0x23
+  {   30,   9,  19,  11,    1,  -17}, // 0x24
+  {   52,  12,  15,  14,    1,  -15}, // 0x25
+  {   75,  11,  15,  12,    1,  -15}, // 0x26
+  {   96,   2,   5,   4,    1,  -15}, // 0x27
+  {   98,   5,  22,   7,    1,  -17}, // 0x28
+  {  112,   5,  22,   7,    0,  -17}, // 0x29
+  {  126,   9,   9,   9,    0,  -15}, // 0x2A
+  {  137,  10,  12,  11,    0,  -12}, // 0x2B
+  {  152,   3,   5,   4,    0,   -2}, // 0x2C
+  {  154,   5,   2,   6,    0,   -7}, // 0x2D
+  {  156,   3,   2,   5,    1,   -2}, // 0x2E
+  {  157,   7,  16,   8,    0,  -15}, // 0x2F
+  {  171,   9,  15,  11,    1,  -15}, // 0x30
+  {  188,   6,  15,  11,    1,  -15}, // 0x31
+  {  200,   9,  15,  11,    1,  -15}, // 0x32
+  {  217,  10,  15,  11,    0,  -15}, // 0x33
+  {  236,  10,  15,  11,    0,  -15}, // 0x34
+  {  255,   9,  15,  11,    1,  -15}, // 0x35
+  {  272,   9,  15,  11,    1,  -15}, // 0x36
+  {  289,  10,  15,  11,    0,  -15}, // 0x37
+  {  308,   9,  15,  11,    1,  -15}, // 0x38
+  {  325,   9,  15,  11,    1,  -15}, // 0x39
+  {  342,   2,  11,   5,    1,  -11}, // 0x3A
+  {  345,   3,  14,   4,    0,  -11}, // 0x3B
+  {  351,   9,   9,  10,    0,  -11}, // 0x3C
+  {  362,   8,   6,  11,    1,   -9}, // 0x3D
+  {  368,   8,   9,  10,    1,  -11}, // 0x3E
+  {  377,   8,  15,   9,    0,  -15}, // 0x3F
+  {  392,  15,  19,  17,    1,  -15}, // 0x40
+  {  428,  12,  15,  12,    0,  -15}, // 0x41
+  {  451,  10,  15,  12,    1,  -15}, // 0x42
+  {  470,  11,  15,  13,    1,  -15}, // 0x43
+  {  491,  10,  15,  13,    1,  -15}, // 0x44
+  {  510,   9,  15,  11,    1,  -15}, // 0x45
+  {  527,   9,  15,  11,    1,  -15}, // 0x46
+  {  544,  11,  15,  13,    1,  -15}, // 0x47
+  {  565,  11,  15,  14,    1,  -15}, // 0x48
+  {  586,   3,  15,   6,    1,  -15}, // 0x49
+  {  592,   9,  15,  11,    0,  -15}, // 0x4A
+  {  609,  11,  15,  12,    1,  -15}, // 0x4B
+  {  630,   9,  15,  10,    1,  -15}, // 0x4C
+  {  647,  14,  15,  17,    1,  -15}, // 0x4D
+  {  674,  11,  15,  14,    1,  -15}, // 0x4E
+  {  695,  11,  15,  13,    1,  -15}, // 0x4F
+  {  716,  10,  15,  12,    1,  -15}, // 0x50
+  {  735,  11,  18,  13,    1,  -15}, // 0x51
+  {  760,  10,  15,  12,    1,  -15}, // 0x52
+  {  779,  11,  15,  12,    0,  -15}, // 0x53
+  {  800,  11,  15,  12,    0,  -15}, // 0x54
+  {  821,  10,  15,  13,    1,  -15}, // 0x55
+  {  840,  12,  15,  12,    0,  -15}, // 0x56
+  {  863,  17,  15,  17,    0,  -15}, // 0x57
+  {  895,  11,  15,  12,    0,  -15}, // 0x58
+  {  916,  11,  15,  12,    0,  -15}, // 0x59
+  {  937,  11,  15,  12,    0,  -15}, // 0x5A
+  {  958,   4,  21,   5,    1,  -17}, // 0x5B
+  {  969,   8,  16,   8,    0,  -15}, // 0x5C
+  {  985,   4,  21,   5,    0,  -17}, // 0x5D
+  {  996,   7,   8,   8,    0,  -15}, // 0x5E
+  { 1003,   9,   2,   9,    0,    0}, // 0x5F
+  { 1006,   4,   3,   6,    1,  -16}, // 0x60
+  { 1008,   8,  11,  11,    1,  -11}, // 0x61
+  { 1019,   9,  15,  11,    1,  -15}, // 0x62
+  { 1036,   9,  11,  10,    0,  -11}, // 0x63
+  { 1049,   8,  15,  11,    1,  -15}, // 0x64
+  { 1064,   9,  11,  10,    0,  -11}, // 0x65
+  { 1077,   7,  16,   7,    0,  -16}, // 0x66
+  { 1091,   8,  15,  11,    1,  -11}, // 0x67
+  { 1106,   8,  15,  11,    1,  -15}, // 0x68
+  { 1121,   2,  15,   5,    1,  -15}, // 0x69
+  { 1125,   4,  19,   5,   -1,  -15}, // 0x6A
+  { 1135,   9,  15,  10,    1,  -15}, // 0x6B
+  { 1152,   2,  15,   5,    1,  -15}, // 0x6C
+  { 1156,  15,  11,  17,    1,  -11}, // 0x6D
+  { 1177,   8,  11,  11,    1,  -11}, // 0x6E
+  { 1188,  10,  11,  11,    0,  -11}, // 0x6F
+  { 1202,   9,  15,  11,    1,  -11}, // 0x70
+  { 1219,   8,  15,  11,    1,  -11}, // 0x71
+  { 1234,   6,  11,   7,    1,  -11}, // 0x72
+  { 1243,   8,  11,  10,    1,  -11}, // 0x73
+  { 1254,   6,  14,   7,    0,  -14}, // 0x74
+  { 1265,   8,  11,  11,    1,  -11}, // 0x75
+  { 1276,   9,  11,  10,    0,  -11}, // 0x76
+  { 1289,  14,  11,  15,    0,  -11}, // 0x77
+  { 1309,   9,  11,  10,    0,  -11}, // 0x78
+  { 1322,   9,  15,   9,    0,  -11}, // 0x79
+  { 1339,   9,  11,  10,    0,  -11}, // 0x7A
+  { 1352,   7,  21,   7,    0,  -16}, // 0x7B
+  { 1371,   2,  17,   5,    1,  -15}, // 0x7C
+  { 1376,   6,  21,   7,    0,  -16}, // 0x7D
+  { 1392,  11,   5,  13,    1,   -8}, // 0x7E
+};
+
+const GFXfont FreeSans9pt7b PROGMEM = {(uint8_t *)FreeSans9pt7bBitmaps, (GFXglyph *)FreeSans9pt7bGlyphs, 0x20, 0x7E, 22};
@@ -0,0 +1,218 @@
+// Generated by tools/gfxFonts/vlwToGfx.cpp from data/NotoSans-20.vlw, do not edit
+// Stand-in for TFT_eSPI's FreeSansBold12pt7b in the native build, same line height
+
+#pragma once
+
+const uint8_t FreeSansBold12pt7bBitmaps[] PROGMEM = {
+  0x1C, 0xE3, 0x8E, 0x38, 0xE3, 0x0C, 0x71, 0xC0, 0x18, 0xF1, 0x80, 0x36, 0x36, 0x66, 0x6C, 0x6C,
+  0x40, 0x06, 0x60, 0x64, 0x06, 0xC3, 0xFF, 0x3F, 0xE0, 0xD8, 0x19, 0x81, 0x90, 0xFF, 0xCF, 0xFC,
+  0x32, 0x03, 0x60, 0x66, 0x06, 0xC0, 0x01, 0x00, 0x10, 0x01, 0x00, 0x78, 0x1F, 0xC3, 0xDE, 0x38,
+  0xE3, 0x80, 0x3C, 0x01, 0xF0, 0x0F, 0x80, 0x3C, 0x61, 0xC7, 0x1C, 0x73, 0xC7, 0xF8, 0x1E, 0x00,
+  0xC0, 0x08, 0x00, 0x3C, 0x03, 0xF0, 0x19, 0x98, 0xCD, 0x87, 0xDC, 0x1C, 0xC0, 0x0C, 0x00, 0xD8,
+  0x0F, 0xF0, 0xD9, 0x8E, 0xCC, 0x66, 0x60, 0x3F, 0x00, 0xF0, 0x07, 0x81, 0xFC, 0x1D, 0xC1, 0x9C,
+  0x19, 0xC1, 0xF8, 0x1E, 0x03, 0xE7, 0x7F, 0x7F, 0x7E, 0xE3, 0xEF, 0x3C, 0x7F, 0xE3, 0xEE, 0x66,
+  0x6C, 0xC4, 0x00, 0x02, 0x07, 0x0E, 0x1C, 0x18, 0x38, 0x30, 0x30, 0x70, 0x70, 0x70, 0x60, 0x60,
+  0x60, 0x60, 0x60, 0x70, 0x30, 0x38, 0x18, 0x00, 0x00, 0x08, 0x0C, 0x06, 0x06, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x06, 0x0E, 0x0E, 0x0C, 0x1C, 0x38, 0x70, 0x60, 0x00, 0x06, 0x01,
+  0x80, 0x41, 0xFE, 0x1F, 0x07, 0x83, 0xE0, 0xCC, 0x02, 0x00, 0x06, 0x00, 0xC0, 0x38, 0x07, 0x07,
+  0xFC, 0xFF, 0xBF, 0xF0, 0x60, 0x1C, 0x03, 0x80, 0x70, 0x00, 0x18, 0x63, 0x8C, 0x71, 0x80, 0x00,
+  0x01, 0xFB, 0xF0, 0x06, 0xF6, 0x00, 0xC0, 0x38, 0x06, 0x01, 0xC0, 0x30, 0x0E, 0x01, 0x80, 0x70,
+  0x0C, 0x03, 0x80, 0x60, 0x1C, 0x03, 0x00, 0xE0, 0x18, 0x02, 0x00, 0x07, 0x83, 0xF8, 0xF7, 0x1C,
+  0x73, 0x8E, 0xE1, 0xDC, 0x3B, 0x8E, 0x71, 0xCE, 0x39, 0xC7, 0x3D, 0xC3, 0xF0, 0x3C, 0x00, 0x06,
+  0x3E, 0x7E, 0xFE, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x38, 0x38, 0x38, 0x38, 0x07, 0xC0, 0xFE,
+  0x1E, 0xF1, 0xC7, 0x18, 0x70, 0x0E, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1C, 0x03, 0xC0, 0x7F,
+  0xE7, 0xFE, 0x0F, 0x87, 0xF8, 0xF7, 0x98, 0x70, 0x1E, 0x1F, 0x83, 0xE0, 0x7C, 0x01, 0xC0, 0x3B,
+  0x87, 0x7B, 0xE7, 0xF8, 0x7C, 0x00, 0x01, 0xE0, 0x78, 0x0F, 0x03, 0xE0, 0xFC, 0x3B, 0x8E, 0xE1,
+  0x9C, 0x73, 0xDF, 0xFB, 0xFF, 0x01, 0xC0, 0x70, 0x0E, 0x00, 0x1F, 0xE1, 0xFE, 0x1C, 0x03, 0x80,
+  0x3F, 0x03, 0xF8, 0x33, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x71, 0xC7, 0xF8, 0x3F, 0x81, 0xE0, 0x03,
+  0xC1, 0xF8, 0x7E, 0x1E, 0x03, 0xF8, 0xFF, 0x9E, 0xF3, 0x8E, 0x71, 0xCE, 0x39, 0xC7, 0x3D, 0xE3,
+  0xF8, 0x3C, 0x00, 0x7F, 0xEF, 0xF8, 0x07, 0x01, 0xC0, 0x38, 0x0E, 0x01, 0xC0, 0x70, 0x1C, 0x03,
+  0x80, 0xE0, 0x1C, 0x07, 0x01, 0xE0, 0x00, 0x0F, 0x83, 0xF8, 0xF7, 0x9C, 0x73, 0x8E, 0x7F, 0x87,
+  0xE1, 0xFC, 0x71, 0xCE, 0x39, 0xC7, 0x3F, 0xE7, 0xF8, 0x7C, 0x00, 0x1F, 0x0F, 0xE7, 0xB9, 0xC7,
+  0xE1, 0xF8, 0x7F, 0x3D, 0xFE, 0x3F, 0x80, 0xE0, 0x70, 0xF8, 0x7C, 0x1C, 0x00, 0x38, 0xE3, 0x80,
+  0x00, 0x00, 0x00, 0x63, 0xC6, 0x00, 0x18, 0x71, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x1C, 0x73,
+  0x84, 0x00, 0x00, 0x00, 0x20, 0x38, 0x7E, 0x7F, 0x1E, 0x0F, 0x81, 0xF8, 0x1F, 0x00, 0xC0, 0x00,
+  0x3F, 0xC7, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x9F, 0xE0, 0x20, 0x0E, 0x03, 0xE0, 0x7E, 0x03,
+  0xC3, 0xE3, 0xF1, 0xF0, 0xE0, 0x00, 0x00, 0x1E, 0x1F, 0xC7, 0x7B, 0x8E, 0x03, 0x81, 0xC1, 0xE0,
+  0x70, 0x38, 0x00, 0x00, 0x00, 0xC0, 0x70, 0x0C, 0x00, 0x01, 0xF8, 0x03, 0xFF, 0x03, 0x81, 0xC3,
+  0x80, 0x63, 0x8F, 0x11, 0x8F, 0xCD, 0x8C, 0xC6, 0xCE, 0x63, 0x66, 0x31, 0xE3, 0x19, 0xB3, 0x98,
+  0xD8, 0xCC, 0x4C, 0x7F, 0xE3, 0x39, 0xE1, 0x80, 0x00, 0xE0, 0x00, 0x3F, 0xC0, 0x07, 0xE0, 0x00,
+  0x00, 0xF0, 0x01, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x3F, 0x00, 0x76, 0x01, 0xCE, 0x07, 0x9C, 0x0F,
+  0xF8, 0x3F, 0xF0, 0x7F, 0xE1, 0xE1, 0xE3, 0x81, 0xCF, 0x03, 0x80, 0x3F, 0xC1, 0xFF, 0x0F, 0xFC,
+  0x70, 0xE3, 0x87, 0x1C, 0x71, 0xFF, 0x0F, 0xFC, 0x70, 0xE3, 0x87, 0x1C, 0x38, 0xFF, 0xCF, 0xFC,
+  0x7F, 0x80, 0x07, 0xC0, 0x7F, 0x87, 0xFC, 0x70, 0xF3, 0x83, 0xB8, 0x01, 0xC0, 0x0E, 0x00, 0x70,
+  0x03, 0x83, 0x9C, 0x3C, 0xFF, 0xC3, 0xFC, 0x0F, 0x80, 0x3F, 0x81, 0xFF, 0x0F, 0xF8, 0x70, 0xE3,
+  0x87, 0x1C, 0x39, 0xE1, 0xCE, 0x0E, 0x70, 0x73, 0x87, 0x1C, 0x78, 0xFF, 0x8F, 0xF8, 0x7F, 0x00,
+  0x3F, 0xF3, 0xFF, 0x3F, 0xE3, 0x80, 0x38, 0x03, 0x80, 0x7F, 0xC7, 0xFC, 0x70, 0x07, 0x00, 0x70,
+  0x07, 0xF8, 0xFF, 0xCF, 0xFC, 0x3F, 0xF3, 0xFE, 0x3F, 0xE3, 0x80, 0x38, 0x03, 0xFC, 0x7F, 0xC7,
+  0xFC, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0xE0, 0x0E, 0x00, 0x07, 0xE0, 0x7F, 0x87, 0xFE, 0x78,
+  0x73, 0x80, 0x3C, 0x01, 0xC7, 0xCE, 0x3E, 0x70, 0x73, 0x83, 0x9C, 0x1C, 0x7F, 0xE3, 0xFE, 0x07,
+  0xC0, 0x3C, 0x1C, 0xE0, 0x73, 0x83, 0xCE, 0x0E, 0x38, 0x38, 0xFF, 0xE7, 0xFF, 0x9F, 0xFE, 0x70,
+  0x71, 0xC1, 0xC7, 0x07, 0x1C, 0x1C, 0xE0, 0x73, 0x81, 0xC0, 0x1C, 0x73, 0x8E, 0x38, 0xE3, 0x9E,
+  0x71, 0xC7, 0x1C, 0x73, 0xC0, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x01, 0xE0, 0x0E, 0x00, 0x70, 0x03,
+  0x80, 0x1C, 0x00, 0xE0, 0x0F, 0x1C, 0x70, 0xFF, 0x83, 0xF8, 0x0F, 0x80, 0x3C, 0x3C, 0x70, 0xF0,
+  0xE3, 0xC1, 0xCF, 0x03, 0xBC, 0x07, 0xF0, 0x1F, 0xC0, 0x3F, 0xC0, 0x7F, 0x80, 0xF7, 0x01, 0xCF,
+  0x03, 0x8E, 0x0E, 0x1E, 0x1C, 0x1C, 0x00, 0x3C, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0E, 0x07, 0x81,
+  0xC0, 0x70, 0x1C, 0x07, 0x01, 0xFE, 0xFF, 0xBF, 0xE0, 0x3E, 0x07, 0x8F, 0x83, 0xE3, 0xE0, 0xF8,
+  0xF8, 0x7E, 0x3E, 0x1F, 0x8D, 0x8F, 0xC7, 0x73, 0x71, 0xDD, 0xDC, 0x73, 0x67, 0x1C, 0xF9, 0xC7,
+  0x3C, 0xE1, 0xCF, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x80, 0x3C, 0x1C, 0xF0, 0x73, 0xE3, 0xCF, 0x8E,
+  0x3E, 0x38, 0xFC, 0xE7, 0xF3, 0x9C, 0xEE, 0x73, 0xF1, 0xC7, 0xC7, 0x1F, 0x1C, 0x7C, 0xE0, 0xF3,
+  0x83, 0xC0, 0x07, 0xC0, 0x3F, 0xC1, 0xFF, 0x0F, 0x1E, 0x38, 0x39, 0xC0, 0xE7, 0x03, 0x9C, 0x0E,
+  0x70, 0x79, 0xC1, 0xC7, 0x0F, 0x0F, 0xF8, 0x3F, 0xC0, 0x3C, 0x00, 0x3F, 0xC1, 0xFF, 0x8F, 0xFC,
+  0x70, 0xE3, 0x87, 0x1C, 0x39, 0xFF, 0xCF, 0xFC, 0x7F, 0x83, 0x80, 0x1C, 0x00, 0xE0, 0x0E, 0x00,
+  0x70, 0x00, 0x07, 0xC0, 0x3F, 0xC1, 0xFF, 0x0F, 0x1E, 0x38, 0x39, 0xC0, 0xE7, 0x03, 0x9C, 0x0E,
+  0x70, 0x79, 0xC1, 0xC7, 0x0F, 0x0F, 0xF8, 0x3F, 0xC0, 0x3F, 0x00, 0x1E, 0x00, 0x30, 0x00, 0x00,
+  0x3F, 0xC1, 0xFF, 0x8F, 0xFC, 0x70, 0xE3, 0x87, 0x1C, 0x39, 0xFF, 0x8F, 0xF8, 0x7F, 0x83, 0x9E,
+  0x1C, 0x70, 0xE3, 0x8E, 0x1E, 0x70, 0x70, 0x07, 0xC0, 0xFF, 0x0F, 0xFC, 0x70, 0xE3, 0x80, 0x1E,
+  0x00, 0x7E, 0x00, 0xF8, 0x01, 0xE3, 0x07, 0x3C, 0x38, 0xF7, 0xC3, 0xFC, 0x0F, 0x80, 0x7F, 0xF3,
+  0xFF, 0x9F, 0xF8, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x1E, 0x00, 0xE0, 0x07, 0x00,
+  0x38, 0x01, 0xC0, 0x0E, 0x00, 0x3C, 0x38, 0xE0, 0xE3, 0x83, 0x8E, 0x0E, 0x38, 0x70, 0xE1, 0xC7,
+  0x07, 0x1C, 0x1C, 0x70, 0x71, 0xC3, 0xC7, 0x0E, 0x1F, 0xF8, 0x3F, 0xC0, 0x7C, 0x00, 0xF0, 0x79,
+  0xC1, 0xC7, 0x0F, 0x1C, 0x38, 0x70, 0xE1, 0xC7, 0x03, 0x9C, 0x0E, 0xE0, 0x3B, 0x80, 0xFC, 0x03,
+  0xF0, 0x0F, 0x80, 0x1E, 0x00, 0x70, 0x00, 0x71, 0xC3, 0xB8, 0xE3, 0x9C, 0xF1, 0xCE, 0x78, 0xE7,
+  0x3C, 0xE3, 0xBE, 0x71, 0xDF, 0x38, 0xED, 0xF8, 0x7E, 0xFC, 0x3E, 0x7C, 0x1F, 0x3E, 0x0F, 0x9F,
+  0x07, 0x8F, 0x03, 0xC3, 0x80, 0x1C, 0x3C, 0x3C, 0x70, 0x39, 0xE0, 0x77, 0x80, 0xFE, 0x00, 0xFC,
+  0x01, 0xF0, 0x03, 0xE0, 0x0F, 0xC0, 0x3F, 0x80, 0x73, 0x81, 0xE7, 0x07, 0x8F, 0x1E, 0x0E, 0x00,
+  0x70, 0x73, 0x87, 0x9C, 0x38, 0x73, 0x83, 0xBC, 0x1D, 0xC0, 0x7C, 0x03, 0xE0, 0x1E, 0x00, 0xE0,
+  0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x1F, 0xFC, 0x7F, 0xE1, 0xFF, 0x80, 0x3C, 0x00, 0xE0,
+  0x07, 0x00, 0x38, 0x01, 0xC0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x0F, 0xF8, 0x7F, 0xF1, 0xFF, 0x80,
+  0x00, 0x0F, 0x1F, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x70,
+  0x70, 0x70, 0x70, 0x78, 0x78, 0xE0, 0xE1, 0xC3, 0x87, 0x0E, 0x0E, 0x1C, 0x38, 0x70, 0xE0, 0xE1,
+  0xC3, 0x87, 0x06, 0x00, 0x07, 0x83, 0xC0, 0xE0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x83,
+  0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x1C, 0x0E, 0x0F, 0x07, 0x80, 0x00, 0x07, 0x03, 0x83, 0xC3,
+  0xB1, 0x99, 0xCC, 0xC6, 0x00, 0x1F, 0xE7, 0xF8, 0x07, 0x1C, 0x60, 0x1F, 0x0F, 0xE7, 0xB8, 0x07,
+  0x1F, 0x9F, 0xEF, 0x3B, 0x8E, 0xE7, 0xBF, 0xE7, 0xB8, 0x1C, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1F,
+  0xC1, 0xFE, 0x3D, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x79, 0xC7, 0xFC, 0x77, 0x80,
+  0x0F, 0x0F, 0xE7, 0xBD, 0xC7, 0x70, 0x38, 0x0E, 0x01, 0x8E, 0x77, 0x9F, 0xC1, 0xE0, 0x00, 0xE0,
+  0x0E, 0x00, 0xE0, 0x0E, 0x1E, 0xE3, 0xFE, 0x7B, 0xC7, 0x1C, 0x71, 0xCE, 0x1C, 0xE1, 0xCE, 0x3C,
+  0x73, 0x87, 0xF8, 0x3F, 0x80, 0x0F, 0x07, 0xF0, 0xEF, 0x38, 0xE7, 0xFC, 0xFF, 0xB8, 0x03, 0x80,
+  0x7B, 0x87, 0xF0, 0x78, 0x00, 0x07, 0x07, 0x87, 0x83, 0x87, 0xE3, 0xF0, 0xE0, 0x70, 0x38, 0x1C,
+  0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0x0F, 0x71, 0xFF, 0x3C, 0xF3, 0x8E, 0x38, 0xE3, 0x0E, 0x70,
+  0xE3, 0x8E, 0x3B, 0xE3, 0xFC, 0x1F, 0xC0, 0x1C, 0x77, 0x87, 0xF8, 0x3E, 0x00, 0x1C, 0x01, 0xC0,
+  0x1C, 0x01, 0xC0, 0x1F, 0xC1, 0xFE, 0x3D, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xE7, 0x0E, 0x71,
+  0xC7, 0x1C, 0x71, 0xC0, 0x18, 0xF1, 0x80, 0x38, 0xE3, 0x9C, 0x71, 0xC7, 0x1C, 0x73, 0x8E, 0x00,
+  0x03, 0x03, 0xC0, 0xC0, 0x00, 0x70, 0x38, 0x1C, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0xE0,
+  0x70, 0x38, 0x3C, 0x7C, 0x3C, 0x00, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xCF, 0x0E, 0xF0,
+  0xEF, 0x07, 0xF0, 0x3F, 0x01, 0xF8, 0x0F, 0xE0, 0x77, 0x07, 0x3C, 0x38, 0xE1, 0xC7, 0x00, 0x1C,
+  0xE3, 0x8E, 0x38, 0xE3, 0x9C, 0x71, 0xC7, 0x1C, 0x73, 0x8E, 0x00, 0x1F, 0xCF, 0x0F, 0xFF, 0xCF,
+  0x3C, 0xE7, 0x1C, 0x73, 0x8E, 0x39, 0xC7, 0x1C, 0xE3, 0x9C, 0x73, 0x8E, 0x71, 0xC7, 0x38, 0xE3,
+  0x9C, 0x71, 0xC0, 0x1F, 0xC3, 0xFE, 0x3C, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xE7, 0x0E, 0x71,
+  0xC7, 0x1C, 0x71, 0xC0, 0x0F, 0x07, 0xF0, 0xEF, 0x38, 0xE7, 0x1D, 0xC3, 0xB8, 0x73, 0x8E, 0x77,
+  0x8F, 0xE0, 0x78, 0x00, 0x1F, 0xC1, 0xFE, 0x3C, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8E,
+  0x7F, 0xC7, 0xFC, 0x77, 0x07, 0x00, 0x70, 0x07, 0x00, 0xE0, 0x00, 0x1E, 0xE7, 0xFD, 0xE7, 0x38,
+  0xE7, 0x1D, 0xC3, 0xB8, 0x77, 0x1C, 0x77, 0x8F, 0xF0, 0xFE, 0x01, 0xC0, 0x38, 0x0E, 0x01, 0xC0,
+  0x00, 0x0F, 0xC7, 0xE7, 0xE3, 0xC1, 0xC0, 0xE0, 0x70, 0x38, 0x38, 0x1C, 0x0E, 0x00, 0x1F, 0x0F,
+  0xE7, 0x39, 0xC0, 0x7C, 0x0F, 0xC0, 0xFB, 0x0E, 0xE7, 0x9F, 0xC3, 0xE0, 0x18, 0x1C, 0x38, 0x7E,
+  0x7E, 0x38, 0x38, 0x38, 0x70, 0x70, 0x70, 0x78, 0x7C, 0x38, 0x38, 0xEE, 0x1D, 0xC7, 0x38, 0xE7,
+  0x1C, 0xE3, 0x9C, 0x73, 0x8E, 0x73, 0x8F, 0xF0, 0xEE, 0x00, 0x71, 0xCE, 0x39, 0xCE, 0x39, 0xC3,
+  0x38, 0x6E, 0x0F, 0xC1, 0xF0, 0x3E, 0x07, 0x80, 0x70, 0x00, 0xE3, 0x1F, 0x9C, 0xEE, 0x73, 0xBB,
+  0xCC, 0xEF, 0x73, 0xFD, 0xCF, 0xBE, 0x1E, 0x78, 0x71, 0xC1, 0xC7, 0x06, 0x1C, 0x00, 0x38, 0xE1,
+  0xDE, 0x1D, 0xC1, 0xF8, 0x0F, 0x80, 0xF0, 0x1F, 0x01, 0xF8, 0x3B, 0x87, 0x38, 0x71, 0xC0, 0x38,
+  0xF3, 0x8E, 0x39, 0xE3, 0x9C, 0x1B, 0xC1, 0xF8, 0x1F, 0x81, 0xF0, 0x1F, 0x01, 0xE0, 0x1E, 0x01,
+  0xC0, 0x3C, 0x07, 0x80, 0x70, 0x00, 0x1F, 0xE7, 0xFC, 0x0F, 0x01, 0xC0, 0x70, 0x1E, 0x07, 0x81,
+  0xE0, 0x7C, 0x0F, 0xF9, 0xFE, 0x00, 0x00, 0x06, 0x0E, 0x1C, 0x1C, 0x18, 0x18, 0x18, 0x38, 0x70,
+  0xE0, 0x70, 0x70, 0x30, 0x70, 0x70, 0x70, 0x70, 0x30, 0x10, 0x00, 0x18, 0x84, 0x63, 0x18, 0xC4,
+  0x23, 0x18, 0xC6, 0x31, 0x08, 0xC0, 0x00, 0x18, 0x1C, 0x1C, 0x0C, 0x1C, 0x1C, 0x1C, 0x1C, 0x0E,
+  0x0E, 0x1E, 0x18, 0x38, 0x38, 0x38, 0x30, 0x70, 0xE0, 0xC0, 0x00, 0x00, 0x03, 0xC7, 0x7F, 0xE6,
+  0x7E, 0x61, 0xC0,
+};
+
+const GFXglyph FreeSansBold12pt7bGlyphs[] PROGMEM = {
+  {    0,   0,   0,   5,    0,    0}, // 0x20
+  {    0,   6,  14,   6,    0,  -14}, // 0x21
+  {   11,   8,   6,   7,    0,  -15}, // 0x22
+  {   17,  12,  14,  12,    0,  -14}, // 0x23
+  {   38,  12,  19,  12,    0,  -17}, // 0x24
+  {   67,  13,  14,  15,    1,  -14}, // 0x25
+  {   90,  12,  14,  13,    0,  -14}, // 0x26
+  {  111,   4,   6,   4,    1,  -15}, // 0x27
+  {  114,   8,  22,   7,    0,  -17}, // 0x28
+  {  136,   8,  22,   7,   -2,  -17}, // 0x29
+  {  158,  10,   9,   9,    0,  -14}, // 0x2A
+  {  170,  11,  11,  11,    0,  -12}, // 0x2B
+  {  186,   6,   7,   5,   -2,   -2}, // 0x2C
+  {  192,   7,   3,   9,    1,   -8}, // 0x2D
+  {  195,   4,   4,   6,    0,   -4}, // 0x2E
+  {  197,  11,  16,   8,   -2,  -14}, // 0x2F
+  {  219,  11,  14,  12,    0,  -14}, // 0x30
+  {  239,   8,  14,  12,    2,  -14}, // 0x31
+  {  253,  12,  14,  12,   -1,  -14}, // 0x32
+  {  274,  11,  14,  12,    0,  -14}, // 0x33
+  {  294,  11,  14,  12,    0,  -14}, // 0x34
+  {  314,  12,  14,  12,    0,  -14}, // 0x35
+  {  335,  11,  14,  12,    0,  -14}, // 0x36
+  {  355,  11,  14,  12,    1,  -14}, // 0x37
+  {  375,  11,  14,  12,    0,  -14}, // 0x38
+  {  395,  10,  14,  12,    1,  -14}, // 0x39
+  {  413,   6,  11,   6,    0,  -11}, // 0x3A
+  {  422,   6,  15,   6,   -1,  -11}, // 0x3B
+  {  434,  10,  11,  10,    0,  -12}, // 0x3C
+  {  448,  11,   7,  12,    0,  -10}, // 0x3D
+  {  458,  10,  10,  10,    0,  -11}, // 0x3E
+  {  471,  10,  14,  10,    1,  -14}, // 0x3F
+  {  489,  17,  18,  18,    0,  -14}, // 0x40
+  {  528,  15,  14,  14,   -2,  -14}, // 0x41
+  {  555,  13,  14,  13,    0,  -14}, // 0x42
+  {  578,  13,  14,  13,    0,  -14}, // 0x43
+  {  601,  13,  14,  13,    0,  -14}, // 0x44
+  {  624,  12,  14,  11,    0,  -14}, // 0x45
+  {  645,  12,  14,  11,    0,  -14}, // 0x46
+  {  666,  13,  14,  14,    0,  -14}, // 0x47
+  {  689,  14,  14,  14,    0,  -14}, // 0x48
+  {  714,   6,  14,   6,    0,  -14}, // 0x49
+  {  725,  13,  14,  11,   -1,  -14}, // 0x4A
+  {  748,  15,  14,  13,    0,  -14}, // 0x4B
+  {  775,  10,  14,  11,    0,  -14}, // 0x4C
+  {  793,  18,  14,  17,    0,  -14}, // 0x4D
+  {  825,  14,  14,  14,    0,  -14}, // 0x4E
+  {  850,  14,  14,  14,    0,  -14}, // 0x4F
+  {  875,  13,  14,  13,    0,  -14}, // 0x50
+  {  898,  14,  17,  14,    0,  -14}, // 0x51
+  {  928,  13,  14,  13,    0,  -14}, // 0x52
+  {  951,  13,  14,  13,    0,  -14}, // 0x53
+  {  974,  13,  14,  13,    1,  -14}, // 0x54
+  {  997,  14,  14,  13,    0,  -14}, // 0x55
+  { 1022,  14,  14,  13,    1,  -14}, // 0x56
+  { 1047,  17,  14,  17,    1,  -14}, // 0x57
+  { 1077,  15,  14,  13,   -1,  -14}, // 0x58
+  { 1104,  13,  14,  13,    1,  -14}, // 0x59
+  { 1127,  14,  14,  12,   -1,  -14}, // 0x5A
+  { 1152,   8,  21,   6,   -1,  -18}, // 0x5B
+  { 1173,   7,  16,   9,    1,  -14}, // 0x5C
+  { 1187,   9,  21,   6,   -2,  -18}, // 0x5D
+  { 1211,   9,   8,   9,    0,  -15}, // 0x5E
+  { 1220,  10,   3,   9,   -2,   -1}, // 0x5F
+  { 1224,   5,   4,   7,    2,  -16}, // 0x60
+  { 1227,  10,  11,  11,    0,  -11}, // 0x61
+  { 1241,  12,  15,  11,   -1,  -15}, // 0x62
+  { 1264,  10,  11,  11,    0,  -11}, // 0x63
+  { 1278,  12,  15,  11,    0,  -15}, // 0x64
+  { 1301,  11,  11,  11,    0,  -11}, // 0x65
+  { 1317,   9,  15,   7,    0,  -15}, // 0x66
+  { 1334,  12,  15,  12,   -1,  -11}, // 0x67
+  { 1357,  12,  15,  11,   -1,  -15}, // 0x68
+  { 1380,   6,  15,   6,    0,  -15}, // 0x69
+  { 1392,   9,  19,   6,   -3,  -15}, // 0x6A
+  { 1414,  13,  15,  11,   -1,  -15}, // 0x6B
+  { 1439,   6,  15,   6,    0,  -15}, // 0x6C
+  { 1451,  17,  11,  17,   -1,  -11}, // 0x6D
+  { 1475,  12,  11,  11,   -1,  -11}, // 0x6E
+  { 1492,  11,  11,  11,    0,  -11}, // 0x6F
+  { 1508,  12,  15,  11,   -1,  -11}, // 0x70
+  { 1531,  11,  15,  11,    0,  -11}, // 0x71
+  { 1552,   9,  12,   8,   -1,  -12}, // 0x72
+  { 1566,  10,  11,  10,    0,  -11}, // 0x73
+  { 1580,   8,  14,   7,    0,  -14}, // 0x74
+  { 1594,  11,  11,  11,    0,  -11}, // 0x75
+  { 1610,  11,  11,  10,    0,  -11}, // 0x76
+  { 1626,  14,  11,  15,    1,  -11}, // 0x77
+  { 1646,  12,  11,  10,   -1,  -11}, // 0x78
+  { 1663,  12,  15,  10,   -1,  -11}, // 0x79
+  { 1686,  11,  11,  10,   -1,  -11}, // 0x7A
+  { 1702,   8,  21,   7,    0,  -17}, // 0x7B
+  { 1723,   5,  17,   5,    0,  -14}, // 0x7C
+  { 1734,   8,  21,   7,   -1,  -17}, // 0x7D
+  { 1755,  12,   5,  13,    0,   -9}, // 0x7E
+};
+
+const GFXfont FreeSansBold12pt7b PROGMEM = {(uint8_t *)FreeSansBold12pt7bBitmaps, (GFXglyph *)FreeSansBold12pt7bGlyphs, 0x20, 0x7E, 29};
@@ -0,0 +1,316 @@
+// Generated by tools/gfxFonts/vlwToGfx.cpp from data/NotoSans-28.vlw, do not edit
+// Stand-in for TFT_eSPI's FreeSansBold18pt7b in the native build, same line height
+
+#pragma once
+
+const uint8_t FreeSansBold18pt7bBitmaps[] PROGMEM = {
+  0x0F, 0x0F, 0x87, 0xC3, 0xC1, 0xE0, 0xF0, 0x78, 0x38, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0x81, 0xC0,
+  0x00, 0x00, 0x78, 0x7C, 0x1E, 0x0E, 0x00, 0x73, 0xB9, 0xDC, 0xEE, 0x67, 0x73, 0x39, 0x9C, 0x8C,
+  0x00, 0xC6, 0x00, 0xE7, 0x00, 0x73, 0x80, 0x31, 0x80, 0x39, 0xC0, 0x1C, 0xE0, 0x7F, 0xFC, 0x7F,
+  0xFE, 0x07, 0x38, 0x03, 0x18, 0x03, 0x9C, 0x01, 0xCE, 0x0F, 0xFF, 0xC7, 0xFF, 0xE0, 0x73, 0x80,
+  0x31, 0x80, 0x39, 0xC0, 0x1C, 0xE0, 0x0C, 0x60, 0x0E, 0x70, 0x00, 0x00, 0x30, 0x00, 0x70, 0x00,
+  0x60, 0x01, 0xF0, 0x07, 0xFC, 0x0F, 0xFE, 0x1F, 0x3E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x00, 0x1F,
+  0x00, 0x0F, 0x80, 0x0F, 0xE0, 0x03, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3C, 0x78, 0x3C, 0x78,
+  0x3C, 0x7C, 0xF8, 0x3F, 0xF8, 0x1F, 0xF0, 0x0F, 0xC0, 0x03, 0x00, 0x07, 0x00, 0x02, 0x00, 0x1E,
+  0x00, 0x1F, 0x80, 0x1C, 0xE1, 0x0E, 0x71, 0xC6, 0x39, 0xC7, 0x1C, 0xC1, 0xDE, 0xE0, 0xFE, 0xE0,
+  0x3E, 0xE0, 0x00, 0xE0, 0x00, 0x60, 0x00, 0x77, 0xC0, 0x77, 0xF0, 0x77, 0x38, 0x73, 0x8C, 0x31,
+  0xC6, 0x38, 0xE7, 0x18, 0x77, 0x80, 0x3F, 0x80, 0x07, 0x80, 0x01, 0xF0, 0x03, 0xFC, 0x01, 0xFF,
+  0x01, 0xE7, 0x80, 0xE3, 0xC0, 0x71, 0xE0, 0x39, 0xE0, 0x1F, 0xF0, 0x0F, 0xE0, 0x07, 0xE0, 0x07,
+  0xF1, 0xC7, 0xF8, 0xF7, 0xDE, 0x73, 0xCF, 0xFB, 0xE3, 0xF9, 0xF0, 0xFC, 0x7C, 0xFC, 0x3F, 0xFF,
+  0x0F, 0xFF, 0x83, 0xF1, 0xE0, 0x3B, 0x9C, 0xE7, 0x39, 0x8C, 0x00, 0x80, 0x70, 0x3C, 0x1E, 0x0F,
+  0x07, 0x81, 0xC0, 0xF0, 0x38, 0x0E, 0x07, 0x81, 0xC0, 0x70, 0x1C, 0x07, 0x03, 0xC0, 0xF0, 0x3C,
+  0x0F, 0x03, 0xC0, 0x70, 0x1C, 0x07, 0x01, 0xC0, 0x38, 0x0F, 0x01, 0xC0, 0x20, 0x00, 0x00, 0x04,
+  0x00, 0xC0, 0x1C, 0x03, 0xC0, 0x38, 0x07, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0,
+  0x1C, 0x03, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x70, 0x0E, 0x03, 0xC0, 0x70, 0x1E, 0x03, 0x80, 0xF0,
+  0x3C, 0x0F, 0x01, 0xC0, 0x30, 0x00, 0x00, 0x03, 0x80, 0x18, 0x00, 0xC0, 0xC6, 0x27, 0xFF, 0x3F,
+  0xF8, 0x3F, 0x01, 0xE0, 0x1F, 0x81, 0xCC, 0x1C, 0x70, 0x41, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x03,
+  0x80, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x0F, 0xFF, 0x9F, 0xFF, 0x3F, 0xFE, 0x7F, 0xFC, 0x0F, 0x00,
+  0x1E, 0x00, 0x3C, 0x00, 0x78, 0x01, 0xE0, 0x01, 0xC0, 0x00, 0x1C, 0x38, 0x71, 0xE3, 0xC7, 0x1C,
+  0x38, 0x00, 0x00, 0x3F, 0xDF, 0xEF, 0xE0, 0x01, 0xE7, 0x9E, 0x70, 0x00, 0x1C, 0x00, 0x38, 0x00,
+  0xE0, 0x01, 0xC0, 0x07, 0x00, 0x0E, 0x00, 0x38, 0x00, 0x70, 0x01, 0xE0, 0x03, 0x80, 0x0F, 0x00,
+  0x1C, 0x00, 0x78, 0x00, 0xE0, 0x03, 0xC0, 0x07, 0x00, 0x1E, 0x00, 0x38, 0x00, 0xF0, 0x01, 0xC0,
+  0x07, 0x80, 0x06, 0x00, 0x00, 0x03, 0xE0, 0x1F, 0xE0, 0x7F, 0xE1, 0xF3, 0xE3, 0xC3, 0xCF, 0x87,
+  0x9E, 0x0F, 0x3C, 0x1E, 0x78, 0x3C, 0xF0, 0x7B, 0xE0, 0xF7, 0x83, 0xEF, 0x07, 0x9E, 0x0F, 0x3C,
+  0x1E, 0x78, 0x78, 0x79, 0xF0, 0xFF, 0xC0, 0xFF, 0x00, 0xF8, 0x00, 0x00, 0xC1, 0xF3, 0xF9, 0xFE,
+  0xFF, 0xB9, 0xE0, 0x78, 0x3E, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x07, 0xC1, 0xE0, 0x78, 0x1E,
+  0x07, 0x81, 0xE0, 0xF8, 0x01, 0xF8, 0x01, 0xFF, 0x01, 0xFF, 0x81, 0xF3, 0xE1, 0xF0, 0xF0, 0xF0,
+  0x78, 0x78, 0x3C, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x3E, 0x00, 0x3E, 0x00,
+  0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x3F, 0xFF, 0x1F, 0xFF, 0x8F, 0xFF, 0x80, 0x03,
+  0xF0, 0x0F, 0xFC, 0x1F, 0xFE, 0x1F, 0x3E, 0x3E, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x3C, 0x03,
+  0xF8, 0x07, 0xF0, 0x07, 0xF8, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x3C, 0xF0, 0x3C, 0xF8, 0x7C, 0x7C,
+  0xF8, 0x7F, 0xF8, 0x3F, 0xF0, 0x0F, 0xC0, 0x00, 0x3E, 0x00, 0xFC, 0x01, 0xF0, 0x07, 0xE0, 0x1F,
+  0xC0, 0x7F, 0x80, 0xFF, 0x03, 0xFE, 0x0F, 0x78, 0x3C, 0xF0, 0x71, 0xE1, 0xE3, 0xC7, 0x8F, 0x8F,
+  0xFF, 0xFF, 0xFF, 0x7F, 0xFE, 0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x0F, 0x80, 0x0F, 0xFF, 0x0F,
+  0xFE, 0x0F, 0xFE, 0x0F, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1F, 0xF0, 0x3F, 0xF8, 0x3F,
+  0xFC, 0x1C, 0x7C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x78, 0x3C, 0x78, 0x7C, 0x7C, 0xF8, 0x3F,
+  0xF8, 0x1F, 0xF0, 0x0F, 0xC0, 0x00, 0xF8, 0x0F, 0xC0, 0x7F, 0x03, 0xF0, 0x1F, 0x00, 0xF8, 0x03,
+  0xC0, 0x1F, 0xF8, 0x7F, 0xF1, 0xFF, 0xEF, 0xC7, 0xBE, 0x1F, 0xF0, 0x7F, 0xC1, 0xFF, 0x07, 0xBC,
+  0x3E, 0x79, 0xF1, 0xFF, 0xC3, 0xFE, 0x03, 0xE0, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x00, 0x3C,
+  0x00, 0x3C, 0x00, 0x78, 0x00, 0xF8, 0x00, 0xF0, 0x01, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0xC0,
+  0x07, 0x80, 0x0F, 0x80, 0x0F, 0x00, 0x1F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x78, 0x00,
+  0x01, 0xF0, 0x07, 0xFC, 0x0F, 0xFE, 0x1F, 0x3E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x3E,
+  0x0F, 0xFC, 0x0F, 0xF8, 0x1F, 0xF0, 0x3F, 0xF8, 0x7C, 0x3C, 0x78, 0x3C, 0x78, 0x3C, 0x78, 0x7C,
+  0x7C, 0xF8, 0x7F, 0xF8, 0x3F, 0xF0, 0x0F, 0xC0, 0x03, 0xE0, 0x1F, 0xE0, 0x7F, 0xE1, 0xF3, 0xC7,
+  0xC3, 0xCF, 0x07, 0x9E, 0x0F, 0x3C, 0x1E, 0x78, 0x3C, 0xF8, 0xF9, 0xFF, 0xF1, 0xFF, 0xC1, 0xF7,
+  0x80, 0x1F, 0x00, 0x3C, 0x00, 0xF0, 0x0F, 0xE0, 0x7F, 0x80, 0xFC, 0x01, 0xE0, 0x00, 0x1C, 0x1E,
+  0x1E, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x78, 0x78, 0x70, 0x07, 0x07, 0xC3,
+  0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0xF0, 0x70, 0x38, 0x3C,
+  0x1C, 0x1E, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x03, 0x80, 0x7E, 0x0F, 0xF8, 0xFF, 0x87,
+  0xF0, 0x1F, 0x00, 0xFE, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFC, 0x00, 0xE0, 0x00, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0xF7, 0xFF, 0x9F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0xFF, 0xF3,
+  0xFF, 0xC0, 0x10, 0x00, 0xF0, 0x03, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xE0, 0x0F, 0x80, 0xFE,
+  0x1F, 0xF9, 0xFF, 0x07, 0xF0, 0x1E, 0x00, 0x40, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x7F, 0xC3, 0xFF,
+  0x1F, 0x3E, 0x78, 0x79, 0xE1, 0xE0, 0x0F, 0x80, 0x7C, 0x03, 0xE0, 0x1F, 0x00, 0xF8, 0x03, 0xC0,
+  0x0E, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0xF8, 0x03, 0xE0, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0xF0, 0x01, 0xE0, 0x78, 0x07, 0x80, 0x1C, 0x0F, 0x00, 0x0C,
+  0x0E, 0x00, 0x0E, 0x1C, 0x3F, 0x86, 0x38, 0x7F, 0xC6, 0x38, 0xF1, 0xC6, 0x30, 0xE3, 0x86, 0x71,
+  0xC3, 0x86, 0x71, 0xC3, 0x86, 0x61, 0xC3, 0x8E, 0x63, 0xC7, 0x0E, 0xE3, 0x87, 0x0C, 0xE3, 0xCF,
+  0x1C, 0xE3, 0xFF, 0x38, 0x61, 0xFF, 0xF0, 0x70, 0xF3, 0xE0, 0x70, 0x00, 0x00, 0x78, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0x1F, 0xBC, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1E, 0x00, 0x07,
+  0xC0, 0x00, 0xFC, 0x00, 0x3F, 0x80, 0x07, 0xF0, 0x01, 0xFE, 0x00, 0x3D, 0xC0, 0x0F, 0x3C, 0x01,
+  0xE7, 0x80, 0x78, 0xF0, 0x0F, 0x1E, 0x03, 0xC3, 0xC0, 0xF8, 0x78, 0x1F, 0xFF, 0x87, 0xFF, 0xF0,
+  0xFF, 0xFE, 0x3E, 0x03, 0xC7, 0x80, 0x79, 0xF0, 0x0F, 0xBE, 0x01, 0xF0, 0x0F, 0xF8, 0x07, 0xFF,
+  0x81, 0xFF, 0xF0, 0x7C, 0x7E, 0x1E, 0x0F, 0x87, 0x81, 0xE3, 0xE0, 0xF8, 0xF8, 0x7E, 0x3F, 0xFF,
+  0x0F, 0xFF, 0x83, 0xFF, 0xC0, 0xF0, 0x78, 0x7C, 0x0F, 0x1F, 0x03, 0xC7, 0x81, 0xF1, 0xE0, 0x7C,
+  0x7C, 0x7E, 0x1F, 0xFF, 0x8F, 0xFF, 0xC3, 0xFF, 0x80, 0x01, 0xF8, 0x03, 0xFE, 0x03, 0xFF, 0x83,
+  0xF7, 0xE3, 0xE0, 0xF1, 0xE0, 0x7D, 0xF0, 0x1E, 0xF0, 0x00, 0x78, 0x00, 0x7C, 0x00, 0x3E, 0x00,
+  0x1F, 0x00, 0x0F, 0x00, 0x07, 0xC0, 0xF3, 0xE0, 0x78, 0xF0, 0x7C, 0x7E, 0xFC, 0x1F, 0xFE, 0x07,
+  0xFC, 0x01, 0xF8, 0x00, 0x0F, 0xF0, 0x07, 0xFF, 0x01, 0xFF, 0xE0, 0x7C, 0xFC, 0x1E, 0x0F, 0x07,
+  0x83, 0xE3, 0xE0, 0x78, 0xF8, 0x1E, 0x3C, 0x07, 0x8F, 0x01, 0xE3, 0xC0, 0xF8, 0xF0, 0x3E, 0x7C,
+  0x0F, 0x1F, 0x07, 0xC7, 0x81, 0xF1, 0xE0, 0xF8, 0x7C, 0xFC, 0x1F, 0xFE, 0x0F, 0xFF, 0x03, 0xFF,
+  0x00, 0x0F, 0xFF, 0x8F, 0xFF, 0xC7, 0xFF, 0xC3, 0xE0, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0xF8, 0x00,
+  0x7C, 0x00, 0x3F, 0xFC, 0x1F, 0xFE, 0x0F, 0xFF, 0x07, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x01, 0xE0,
+  0x00, 0xF0, 0x00, 0x7C, 0x00, 0x3F, 0xFE, 0x3F, 0xFF, 0x1F, 0xFF, 0x00, 0x0F, 0xFF, 0x0F, 0xFF,
+  0x87, 0xFF, 0xC3, 0xE0, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F,
+  0xFE, 0x0F, 0xFF, 0x07, 0xFF, 0x87, 0xC0, 0x03, 0xE0, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0x78, 0x00,
+  0x3C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF8, 0x01, 0xFF, 0x80, 0xFF, 0xF0, 0x7E, 0x7C,
+  0x3E, 0x0F, 0x8F, 0x01, 0xE7, 0xC0, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x1E, 0x1F, 0xCF, 0x87, 0xF3,
+  0xE3, 0xFC, 0xF8, 0x0F, 0x3E, 0x07, 0xC7, 0x81, 0xF1, 0xE0, 0x7C, 0x7E, 0x7E, 0x0F, 0xFF, 0x81,
+  0xFF, 0xC0, 0x1F, 0x80, 0x0F, 0x01, 0xE1, 0xF0, 0x1E, 0x1F, 0x01, 0xE1, 0xE0, 0x1E, 0x1E, 0x03,
+  0xE1, 0xE0, 0x3E, 0x3E, 0x03, 0xC3, 0xE0, 0x3C, 0x3F, 0xFF, 0xC3, 0xFF, 0xFC, 0x3F, 0xFF, 0xC3,
+  0xC0, 0x7C, 0x7C, 0x07, 0x87, 0xC0, 0x78, 0x78, 0x07, 0x87, 0x80, 0x78, 0x78, 0x0F, 0x87, 0x80,
+  0xF8, 0xF8, 0x0F, 0x0F, 0x80, 0xF0, 0x0F, 0x07, 0x87, 0xC3, 0xE1, 0xE0, 0xF0, 0x78, 0x3C, 0x3E,
+  0x1F, 0x0F, 0x07, 0x83, 0xC1, 0xE1, 0xF0, 0xF8, 0x78, 0x3C, 0x1E, 0x0F, 0x00, 0x00, 0x0F, 0x80,
+  0x07, 0x80, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x1E,
+  0x00, 0x0F, 0x00, 0x07, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x01, 0xE1, 0xE0, 0xF0, 0xF8, 0xF8, 0x7E,
+  0xF8, 0x1F, 0xFC, 0x07, 0xFC, 0x01, 0xF8, 0x00, 0x0F, 0x03, 0xE1, 0xF0, 0x7C, 0x1F, 0x0F, 0x81,
+  0xE1, 0xF0, 0x1E, 0x3E, 0x01, 0xE7, 0xE0, 0x3E, 0xFC, 0x03, 0xEF, 0x80, 0x3F, 0xF0, 0x03, 0xFE,
+  0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x00, 0x7F, 0xF8, 0x07, 0xEF, 0x80, 0x7C, 0x7C, 0x07, 0x87, 0xC0,
+  0x78, 0x3E, 0x07, 0x83, 0xE0, 0xF8, 0x1E, 0x0F, 0x81, 0xF0, 0x0F, 0x00, 0x7C, 0x01, 0xF0, 0x07,
+  0x80, 0x1E, 0x00, 0x78, 0x03, 0xE0, 0x0F, 0x80, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x7C,
+  0x01, 0xF0, 0x07, 0x80, 0x1E, 0x00, 0x7C, 0x01, 0xFF, 0xEF, 0xFF, 0xBF, 0xFE, 0x0F, 0x80, 0x3F,
+  0x0F, 0xC0, 0x1F, 0x87, 0xF0, 0x1F, 0xC3, 0xF8, 0x0F, 0xE1, 0xFC, 0x0F, 0xE0, 0xFE, 0x07, 0xF0,
+  0xFF, 0x07, 0xF8, 0x7B, 0x83, 0xBC, 0x3D, 0xE3, 0xDE, 0x1E, 0xF1, 0xDF, 0x0F, 0x79, 0xEF, 0x07,
+  0x9C, 0xE7, 0x87, 0xCE, 0xF3, 0xC3, 0xE7, 0xF1, 0xE1, 0xE3, 0xF9, 0xF0, 0xF1, 0xF8, 0xF8, 0x78,
+  0xFC, 0x78, 0x3C, 0x3C, 0x3C, 0x3E, 0x1E, 0x1E, 0x1F, 0x0E, 0x1F, 0x00, 0x0F, 0x01, 0xE1, 0xF0,
+  0x1E, 0x1F, 0x81, 0xE1, 0xF8, 0x1E, 0x1F, 0xC3, 0xE1, 0xFC, 0x3E, 0x3F, 0xC3, 0xC3, 0xFE, 0x3C,
+  0x3D, 0xE3, 0xC3, 0xCF, 0x3C, 0x3C, 0xF7, 0xC3, 0xC7, 0x7C, 0x7C, 0x7F, 0x87, 0xC7, 0xF8, 0x78,
+  0x3F, 0x87, 0x83, 0xF8, 0x78, 0x1F, 0x87, 0x81, 0xF8, 0xF8, 0x1F, 0x0F, 0x80, 0xF0, 0x01, 0xF8,
+  0x01, 0xFF, 0x80, 0xFF, 0xF0, 0x7E, 0xFC, 0x3E, 0x0F, 0x8F, 0x01, 0xE7, 0xC0, 0x79, 0xE0, 0x1E,
+  0x78, 0x07, 0xBE, 0x01, 0xEF, 0x80, 0x7B, 0xE0, 0x3E, 0xF8, 0x0F, 0x3E, 0x03, 0xCF, 0x81, 0xF1,
+  0xE0, 0xF8, 0x7E, 0xFC, 0x0F, 0xFE, 0x01, 0xFF, 0x00, 0x3F, 0x00, 0x0F, 0xFC, 0x07, 0xFF, 0x81,
+  0xFF, 0xF0, 0x7C, 0x7E, 0x1E, 0x07, 0x87, 0x81, 0xE3, 0xE0, 0x78, 0xF8, 0x1E, 0x3C, 0x0F, 0x8F,
+  0x8F, 0xE3, 0xFF, 0xF0, 0xFF, 0xF8, 0x7F, 0xF0, 0x1F, 0x00, 0x07, 0x80, 0x01, 0xE0, 0x00, 0x78,
+  0x00, 0x1E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0x01, 0xF8, 0x01, 0xFF, 0x80, 0xFF, 0xF0, 0x7E,
+  0xFC, 0x3E, 0x0F, 0x8F, 0x01, 0xE7, 0xC0, 0x79, 0xE0, 0x1E, 0x78, 0x07, 0xBE, 0x01, 0xEF, 0x80,
+  0x7B, 0xE0, 0x3E, 0xF8, 0x0F, 0x3E, 0x03, 0xCF, 0x81, 0xF1, 0xE0, 0xF8, 0x7E, 0xFC, 0x0F, 0xFF,
+  0x01, 0xFF, 0x80, 0x3F, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0x00, 0x01, 0x80, 0x00, 0x00, 0x0F, 0xFC,
+  0x07, 0xFF, 0x81, 0xFF, 0xF0, 0x7C, 0x7E, 0x1E, 0x07, 0x87, 0x81, 0xE3, 0xE0, 0x78, 0xF8, 0x1E,
+  0x3C, 0x0F, 0x8F, 0x8F, 0xC3, 0xFF, 0xE0, 0xFF, 0xF0, 0x7F, 0xF8, 0x1F, 0x1E, 0x07, 0x87, 0xC1,
+  0xE1, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x8F, 0x83, 0xE3, 0xE0, 0x78, 0x01, 0xF8, 0x01, 0xFF, 0x80,
+  0xFF, 0xF0, 0x7E, 0x7E, 0x1E, 0x0F, 0x87, 0x81, 0xE1, 0xE0, 0x00, 0x7C, 0x00, 0x1F, 0xE0, 0x03,
+  0xFE, 0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0x3E, 0x1C, 0x07, 0x87, 0x81, 0xE1, 0xE0, 0x78, 0x7E,
+  0x7E, 0x0F, 0xFF, 0x01, 0xFF, 0x80, 0x1F, 0x80, 0x7F, 0xFF, 0x9F, 0xFF, 0xE7, 0xFF, 0xF8, 0x0F,
+  0x80, 0x01, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x7C,
+  0x00, 0x1F, 0x00, 0x07, 0x80, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x0F, 0x80, 0x03, 0xE0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x3E, 0x07, 0x8F, 0x81, 0xE3, 0xC0, 0x78, 0xF0, 0x1E, 0x3C, 0x0F,
+  0x8F, 0x03, 0xE7, 0xC0, 0xF1, 0xF0, 0x3C, 0x78, 0x0F, 0x1E, 0x03, 0xC7, 0x81, 0xF1, 0xE0, 0x7C,
+  0xF8, 0x1E, 0x3E, 0x07, 0x8F, 0x83, 0xE3, 0xE0, 0xF8, 0x7C, 0xFC, 0x1F, 0xFE, 0x03, 0xFF, 0x00,
+  0x3F, 0x00, 0x7C, 0x03, 0xEF, 0x80, 0xF9, 0xF0, 0x1F, 0x1E, 0x07, 0xC3, 0xC0, 0xF8, 0x78, 0x3E,
+  0x0F, 0x07, 0xC1, 0xF0, 0xF0, 0x3E, 0x3E, 0x03, 0xC7, 0x80, 0x79, 0xF0, 0x0F, 0x3C, 0x01, 0xEF,
+  0x80, 0x3D, 0xE0, 0x07, 0xFC, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x07,
+  0xC0, 0x00, 0xF0, 0x38, 0x1E, 0xF8, 0x7C, 0x3E, 0xF8, 0x7C, 0x3C, 0xF8, 0xFC, 0x3C, 0xF8, 0xFC,
+  0x7C, 0x78, 0xFC, 0x78, 0x79, 0xFC, 0x78, 0x79, 0xFC, 0xF0, 0x79, 0xFC, 0xF0, 0x7B, 0xDC, 0xF0,
+  0x7B, 0x9D, 0xE0, 0x7F, 0x9D, 0xE0, 0x7F, 0x9F, 0xE0, 0x7F, 0x1F, 0xC0, 0x7F, 0x1F, 0xC0, 0x7F,
+  0x1F, 0xC0, 0x7E, 0x1F, 0x80, 0x7E, 0x1F, 0x80, 0x7C, 0x1F, 0x00, 0x7C, 0x1F, 0x00, 0x0F, 0x81,
+  0xF8, 0x3E, 0x0F, 0x81, 0xF0, 0xF8, 0x07, 0x8F, 0x80, 0x3E, 0x7C, 0x01, 0xF7, 0xC0, 0x07, 0xFC,
+  0x00, 0x3F, 0xE0, 0x00, 0xFE, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0xE0,
+  0x03, 0xFF, 0x00, 0x1F, 0x7C, 0x01, 0xF3, 0xE0, 0x1F, 0x0F, 0x00, 0xF8, 0x7C, 0x0F, 0x83, 0xE0,
+  0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x9E, 0x07, 0xC7, 0x81, 0xE1, 0xF0, 0xF8, 0x3C, 0x7C, 0x0F, 0x1E,
+  0x03, 0xCF, 0x80, 0xFB, 0xC0, 0x1F, 0xE0, 0x07, 0xF8, 0x01, 0xFC, 0x00, 0x3E, 0x00, 0x0F, 0x80,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x78, 0x00,
+  0x0F, 0xFF, 0xE1, 0xFF, 0xF8, 0x7F, 0xFF, 0x00, 0x07, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F,
+  0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x1E, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x1F,
+  0x00, 0x07, 0xC0, 0x00, 0xF0, 0x00, 0x3E, 0x00, 0x0F, 0xFF, 0xE1, 0xFF, 0xFC, 0x3F, 0xFF, 0x00,
+  0x07, 0xE0, 0xFC, 0x3F, 0x07, 0xC0, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x03, 0xE0, 0x78, 0x0F,
+  0x01, 0xE0, 0x3C, 0x07, 0x81, 0xF0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x1F, 0x03,
+  0xC0, 0x78, 0x0F, 0xC1, 0xF8, 0x3E, 0x00, 0x78, 0x1E, 0x07, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0,
+  0xF8, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xE0, 0x78, 0x1E,
+  0x07, 0x80, 0xE0, 0x0F, 0xC1, 0xF8, 0x3F, 0x01, 0xE0, 0x3C, 0x0F, 0x81, 0xE0, 0x3C, 0x07, 0x80,
+  0xF0, 0x1E, 0x07, 0xC0, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x7C, 0x0F, 0x01, 0xE0,
+  0x3C, 0x07, 0x80, 0xF0, 0x3E, 0x0F, 0x83, 0xF0, 0x7E, 0x00, 0x03, 0xC0, 0x3C, 0x07, 0xC0, 0xFC,
+  0x0F, 0xE1, 0xEE, 0x1C, 0xE3, 0x8E, 0x38, 0xE7, 0x07, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0xFF, 0xE0,
+  0x00, 0x78, 0x3C, 0x1C, 0x0E, 0x07, 0xE0, 0x7F, 0xC3, 0xFF, 0x8F, 0x1E, 0x38, 0x78, 0x01, 0xE1,
+  0xFF, 0x9F, 0xFE, 0x7C, 0x7B, 0xE3, 0xEF, 0x0F, 0xBE, 0x7C, 0xFF, 0xF1, 0xFF, 0xC3, 0xEF, 0x00,
+  0x07, 0x80, 0x0F, 0x80, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x1F, 0x78, 0x1F, 0xFC,
+  0x1F, 0xFE, 0x1F, 0x3E, 0x1E, 0x1E, 0x1E, 0x1E, 0x3E, 0x1E, 0x3C, 0x1E, 0x3C, 0x1E, 0x3C, 0x1E,
+  0x3C, 0x3E, 0x3E, 0x7C, 0x7F, 0xFC, 0x7B, 0xF8, 0x79, 0xE0, 0x07, 0xE0, 0x3F, 0xC1, 0xFF, 0x8F,
+  0x9E, 0x7C, 0x3D, 0xE0, 0xF7, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x87, 0x9F, 0x3C, 0x3F,
+  0xF0, 0xFF, 0x80, 0xF8, 0x00, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x03, 0xE0, 0x01, 0xE0,
+  0x00, 0xF0, 0x1E, 0x78, 0x3F, 0xFC, 0x3F, 0xFE, 0x1F, 0x3E, 0x1F, 0x0F, 0x0F, 0x07, 0x87, 0x83,
+  0xC3, 0xC1, 0xE1, 0xE1, 0xF0, 0xF0, 0xF0, 0x78, 0x78, 0x3E, 0x7C, 0x1F, 0xFE, 0x07, 0xFF, 0x01,
+  0xE7, 0x80, 0x03, 0xE0, 0x1F, 0xE0, 0x7F, 0xE1, 0xF3, 0xE3, 0xC3, 0xCF, 0x07, 0x9F, 0xFF, 0x3F,
+  0xFE, 0x7F, 0xFC, 0xF0, 0x01, 0xE0, 0x03, 0xE3, 0x83, 0xFF, 0x83, 0xFE, 0x03, 0xF0, 0x00, 0x01,
+  0xF0, 0x3F, 0x07, 0xF0, 0xF8, 0x0F, 0x00, 0xF0, 0x7F, 0xC7, 0xFC, 0x7F, 0xC1, 0xE0, 0x1E, 0x01,
+  0xE0, 0x3E, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x7C, 0x07, 0x80, 0x78, 0x00, 0x03,
+  0xEF, 0x03, 0xFF, 0x83, 0xFF, 0xC3, 0xE7, 0xE3, 0xE1, 0xF1, 0xE0, 0xF0, 0xF0, 0x78, 0x78, 0x3C,
+  0x3C, 0x1E, 0x1E, 0x0F, 0x0F, 0x0F, 0x87, 0xCF, 0x83, 0xFF, 0xC0, 0xFF, 0xE0, 0x3E, 0xF0, 0x00,
+  0xF8, 0x20, 0x78, 0x1C, 0x7C, 0x1F, 0xFC, 0x07, 0xFC, 0x01, 0xF8, 0x00, 0x0F, 0x80, 0x0F, 0x00,
+  0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x1F, 0x78, 0x1F, 0xFC, 0x1F, 0xFE, 0x1F, 0x3E,
+  0x1E, 0x1E, 0x3E, 0x1E, 0x3C, 0x1E, 0x3C, 0x1E, 0x3C, 0x3E, 0x3C, 0x3C, 0x3C, 0x3C, 0x7C, 0x3C,
+  0x78, 0x3C, 0x78, 0x3C, 0x78, 0x7C, 0x0E, 0x1F, 0x1F, 0x0E, 0x00, 0x00, 0x1E, 0x3E, 0x3C, 0x3C,
+  0x3C, 0x3C, 0x3C, 0x7C, 0x78, 0x78, 0x78, 0x78, 0x78, 0xF8, 0xF0, 0x00, 0xE0, 0x1F, 0x01, 0xF0,
+  0x0E, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x1E, 0x03, 0xE0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C,
+  0x07, 0xC0, 0x78, 0x07, 0x80, 0x78, 0x07, 0x80, 0xF8, 0x0F, 0x80, 0xF0, 0x0F, 0x01, 0xF0, 0xFE,
+  0x0F, 0xE0, 0xF8, 0x00, 0x07, 0x80, 0x07, 0xC0, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0x78,
+  0x00, 0x7C, 0x7C, 0x3C, 0x7C, 0x1E, 0x7C, 0x0F, 0x7C, 0x07, 0xFC, 0x03, 0xFC, 0x03, 0xFE, 0x01,
+  0xFF, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x3C, 0xF0, 0x1E, 0x7C, 0x1F, 0x1E, 0x0F, 0x0F, 0x87, 0x83,
+  0xC0, 0x0F, 0x0F, 0x1F, 0x1E, 0x1E, 0x1E, 0x1E, 0x3E, 0x3E, 0x3C, 0x3C, 0x3C, 0x3C, 0x7C, 0x78,
+  0x78, 0x78, 0x78, 0x78, 0xF8, 0xF0, 0x1E, 0x78, 0x78, 0x1F, 0xFD, 0xFC, 0x1F, 0xFF, 0xFE, 0x1F,
+  0x3F, 0xBE, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x3E, 0x1E, 0x1E, 0x3C, 0x3E, 0x1E, 0x3C, 0x3C,
+  0x1E, 0x3C, 0x3C, 0x3E, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x7C, 0x3C, 0x3C, 0x78, 0x7C, 0x3C,
+  0x78, 0x78, 0x3C, 0x1E, 0x78, 0x1F, 0xFC, 0x1F, 0xFE, 0x1F, 0x3E, 0x1E, 0x1E, 0x3E, 0x1E, 0x3C,
+  0x1E, 0x3C, 0x1E, 0x3C, 0x3E, 0x3C, 0x3C, 0x3C, 0x3C, 0x7C, 0x3C, 0x78, 0x3C, 0x78, 0x3C, 0x78,
+  0x7C, 0x03, 0xE0, 0x1F, 0xF0, 0x7F, 0xE1, 0xF3, 0xE7, 0xC3, 0xCF, 0x07, 0x9E, 0x0F, 0x3C, 0x1E,
+  0x78, 0x3C, 0xF0, 0x79, 0xE1, 0xF3, 0xE7, 0xC3, 0xFF, 0x03, 0xFC, 0x03, 0xE0, 0x00, 0x0F, 0x3C,
+  0x07, 0xFF, 0x03, 0xFF, 0xC1, 0xF3, 0xE0, 0xF0, 0xF0, 0x78, 0x78, 0x7C, 0x3C, 0x3C, 0x1E, 0x1E,
+  0x0F, 0x0F, 0x07, 0x87, 0x87, 0xC3, 0xE7, 0xC3, 0xFF, 0xE1, 0xFF, 0xE0, 0xF3, 0xC0, 0x78, 0x00,
+  0x3C, 0x00, 0x1E, 0x00, 0x1F, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x00, 0x07, 0x9E, 0x1F, 0xDE, 0x3F,
+  0xFE, 0x3E, 0x7C, 0x7C, 0x3C, 0x78, 0x3C, 0x78, 0x3C, 0x78, 0x3C, 0x78, 0x7C, 0x78, 0x78, 0x78,
+  0x78, 0x7C, 0xF8, 0x7F, 0xF8, 0x3F, 0xF8, 0x1E, 0xF8, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+  0xF0, 0x00, 0xF0, 0x01, 0xF0, 0x1E, 0x71, 0xFF, 0x1F, 0xF1, 0xFE, 0x1F, 0x01, 0xE0, 0x3E, 0x03,
+  0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x7C, 0x07, 0x80, 0x78, 0x00, 0x07, 0xC0, 0x7F, 0xC3,
+  0xFF, 0x8F, 0x1E, 0x78, 0x79, 0xF0, 0x03, 0xF8, 0x07, 0xF8, 0x07, 0xF0, 0x03, 0xCF, 0x0F, 0x3C,
+  0x3C, 0x7F, 0xF0, 0xFF, 0x81, 0xF8, 0x00, 0x0E, 0x03, 0xC0, 0xF0, 0x7C, 0x7F, 0xDF, 0xF7, 0xF8,
+  0x78, 0x1E, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC1, 0xF0, 0x3F, 0x0F, 0xC1, 0xE0, 0x3E,
+  0x1E, 0x3C, 0x1E, 0x3C, 0x1E, 0x3C, 0x3E, 0x3C, 0x3C, 0x7C, 0x3C, 0x78, 0x3C, 0x78, 0x3C, 0x78,
+  0x7C, 0x78, 0x78, 0x78, 0x78, 0x7C, 0xF8, 0x7F, 0xF8, 0x3F, 0xF8, 0x1E, 0x78, 0xF8, 0x7F, 0xE1,
+  0xE7, 0x8F, 0x9E, 0x3C, 0x78, 0xF1, 0xE7, 0x87, 0x9E, 0x1E, 0xF0, 0x3B, 0xC0, 0xFE, 0x03, 0xF8,
+  0x0F, 0xC0, 0x3F, 0x00, 0xF8, 0x01, 0xE0, 0x00, 0x70, 0xF1, 0xE7, 0x0F, 0x1E, 0x71, 0xF1, 0xE7,
+  0x1F, 0x3C, 0x71, 0xF3, 0xC7, 0x3F, 0x38, 0x73, 0xF7, 0x87, 0x77, 0x78, 0x7F, 0x7F, 0x07, 0xE3,
+  0xF0, 0x7E, 0x3E, 0x07, 0xE3, 0xE0, 0x7C, 0x3E, 0x07, 0xC3, 0xC0, 0x78, 0x3C, 0x00, 0x0F, 0x0F,
+  0x07, 0x8F, 0x83, 0xE7, 0x80, 0xF7, 0x80, 0x7F, 0xC0, 0x1F, 0xC0, 0x0F, 0xC0, 0x07, 0xE0, 0x07,
+  0xF0, 0x03, 0xF8, 0x03, 0xFE, 0x03, 0xEF, 0x01, 0xE7, 0x81, 0xE1, 0xE1, 0xF0, 0xF0, 0x3E, 0x1F,
+  0x1F, 0x0F, 0x07, 0x8F, 0x83, 0xC7, 0x81, 0xE7, 0xC0, 0xF3, 0xC0, 0x79, 0xE0, 0x3D, 0xE0, 0x0F,
+  0xF0, 0x07, 0xF0, 0x03, 0xF8, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x7C, 0x00, 0x1E, 0x00, 0x1E, 0x00,
+  0x0F, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x0F, 0x80, 0x07, 0x80, 0x00, 0x1F, 0xFE, 0x3F, 0xFC, 0x7F,
+  0xF0, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0x78, 0x01,
+  0xF0, 0x07, 0xFF, 0x8F, 0xFF, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x38, 0x0F, 0x03, 0xC0, 0xF0, 0x1E,
+  0x03, 0xC0, 0x78, 0x0E, 0x01, 0xC0, 0x78, 0x1F, 0x07, 0xC0, 0xF0, 0x3E, 0x01, 0xE0, 0x3C, 0x07,
+  0x80, 0xF0, 0x1E, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xE0, 0x1C, 0x03, 0x80, 0x10, 0x00, 0x0C, 0x18,
+  0x30, 0x61, 0xC3, 0x86, 0x0C, 0x18, 0x30, 0xE1, 0xC3, 0x86, 0x0C, 0x18, 0x30, 0xE1, 0xC3, 0x06,
+  0x0C, 0x18, 0x20, 0x04, 0x00, 0xC0, 0x3C, 0x03, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x3C, 0x07, 0x80,
+  0xF0, 0x1E, 0x03, 0xC0, 0x3C, 0x03, 0x81, 0xF0, 0x7C, 0x0F, 0x01, 0xC0, 0x38, 0x0F, 0x01, 0xE0,
+  0x3C, 0x07, 0x81, 0xE0, 0x78, 0x0E, 0x01, 0x80, 0x00, 0x00, 0x00, 0x3E, 0x0E, 0x7F, 0x0E, 0x7F,
+  0xDE, 0xF3, 0xFC, 0xE1, 0xFC, 0x00, 0x70,
+};
+
+const GFXglyph FreeSansBold18pt7bGlyphs[] PROGMEM = {
+  {    0,   0,   0,   7,    0,    0}, // 0x20
+  {    0,   9,  20,   8,    0,  -20}, // 0x21
+  {   23,   9,   8,   9,    1,  -21}, // 0x22
+  {   32,  17,  20,  16,    0,  -20}, // 0x23
+  {   75,  16,  26,  16,    0,  -23}, // 0x24
+  {  127,  17,  20,  21,    2,  -20}, // 0x25
+  {  170,  17,  20,  19,    0,  -20}, // 0x26
+  {  213,   5,   8,   5,    1,  -21}, // 0x27
+  {  218,  10,  29,  10,    1,  -22}, // 0x28
+  {  255,  11,  29,  10,   -2,  -22}, // 0x29
+  {  295,  13,  13,  13,    1,  -20}, // 0x2A
+  {  317,  15,  15,  15,    0,  -16}, // 0x2B
+  {  346,   7,   9,   7,   -2,   -3}, // 0x2C
+  {  354,   9,   4,  12,    1,  -11}, // 0x2D
+  {  359,   6,   5,   9,    0,   -5}, // 0x2E
+  {  363,  15,  22,  10,   -3,  -20}, // 0x2F
+  {  405,  15,  20,  16,    1,  -20}, // 0x30
+  {  443,  10,  20,  16,    3,  -20}, // 0x31
+  {  468,  17,  20,  16,   -1,  -20}, // 0x32
+  {  511,  16,  20,  16,    0,  -20}, // 0x33
+  {  551,  15,  20,  16,    0,  -20}, // 0x34
+  {  589,  16,  20,  16,    0,  -20}, // 0x35
+  {  629,  14,  20,  16,    1,  -20}, // 0x36
+  {  664,  16,  20,  16,    1,  -20}, // 0x37
+  {  704,  16,  20,  16,    0,  -20}, // 0x38
+  {  744,  15,  20,  16,    1,  -20}, // 0x39
+  {  782,   8,  15,   9,    0,  -15}, // 0x3A
+  {  797,   9,  21,   8,   -2,  -15}, // 0x3B
+  {  821,  14,  15,  14,    0,  -16}, // 0x3C
+  {  848,  14,  10,  16,    1,  -14}, // 0x3D
+  {  866,  14,  14,  14,    0,  -15}, // 0x3E
+  {  891,  14,  20,  14,    1,  -20}, // 0x3F
+  {  926,  24,  26,  25,    0,  -20}, // 0x40
+  { 1004,  19,  20,  19,   -2,  -20}, // 0x41
+  { 1052,  18,  20,  18,    0,  -20}, // 0x42
+  { 1097,  17,  20,  18,    1,  -20}, // 0x43
+  { 1140,  18,  20,  18,    0,  -20}, // 0x44
+  { 1185,  17,  20,  16,    0,  -20}, // 0x45
+  { 1228,  17,  20,  15,    0,  -20}, // 0x46
+  { 1271,  18,  20,  19,    1,  -20}, // 0x47
+  { 1316,  20,  20,  20,    0,  -20}, // 0x48
+  { 1366,   9,  20,   9,    0,  -20}, // 0x49
+  { 1389,  17,  20,  16,   -1,  -20}, // 0x4A
+  { 1432,  20,  20,  18,    0,  -20}, // 0x4B
+  { 1482,  14,  20,  15,    0,  -20}, // 0x4C
+  { 1517,  25,  20,  24,    0,  -20}, // 0x4D
+  { 1580,  20,  20,  20,    0,  -20}, // 0x4E
+  { 1630,  18,  20,  19,    1,  -20}, // 0x4F
+  { 1675,  18,  20,  18,    0,  -20}, // 0x50
+  { 1720,  18,  24,  19,    1,  -20}, // 0x51
+  { 1774,  18,  20,  18,    0,  -20}, // 0x52
+  { 1819,  18,  20,  17,    0,  -20}, // 0x53
+  { 1864,  18,  20,  17,    1,  -20}, // 0x54
+  { 1909,  18,  20,  18,    1,  -20}, // 0x55
+  { 1954,  19,  20,  18,    1,  -20}, // 0x56
+  { 2002,  24,  20,  24,    2,  -20}, // 0x57
+  { 2062,  21,  20,  18,   -2,  -20}, // 0x58
+  { 2115,  18,  20,  17,    2,  -20}, // 0x59
+  { 2160,  19,  20,  17,   -1,  -20}, // 0x5A
+  { 2208,  11,  28,   8,   -1,  -23}, // 0x5B
+  { 2247,  10,  22,  12,    1,  -20}, // 0x5C
+  { 2275,  11,  28,   8,   -2,  -23}, // 0x5D
+  { 2314,  12,  10,  13,    0,  -20}, // 0x5E
+  { 2329,  13,   4,  13,   -2,   -1}, // 0x5F
+  { 2336,   8,   5,  10,    2,  -22}, // 0x60
+  { 2341,  14,  15,  15,    0,  -15}, // 0x61
+  { 2368,  16,  21,  16,   -1,  -21}, // 0x62
+  { 2410,  14,  15,  15,    0,  -15}, // 0x63
+  { 2437,  17,  21,  16,    0,  -21}, // 0x64
+  { 2482,  15,  15,  15,    0,  -15}, // 0x65
+  { 2511,  12,  21,  10,    0,  -21}, // 0x66
+  { 2543,  17,  21,  16,   -1,  -15}, // 0x67
+  { 2588,  16,  21,  16,   -1,  -21}, // 0x68
+  { 2630,   8,  21,   8,    0,  -21}, // 0x69
+  { 2651,  12,  27,   8,   -4,  -21}, // 0x6A
+  { 2692,  17,  21,  15,   -1,  -21}, // 0x6B
+  { 2737,   8,  21,   8,    0,  -21}, // 0x6C
+  { 2758,  24,  15,  24,   -1,  -15}, // 0x6D
+  { 2803,  16,  15,  16,   -1,  -15}, // 0x6E
+  { 2833,  15,  15,  16,    0,  -15}, // 0x6F
+  { 2862,  17,  21,  16,   -2,  -15}, // 0x70
+  { 2907,  16,  21,  16,    0,  -15}, // 0x71
+  { 2949,  12,  15,  11,   -1,  -15}, // 0x72
+  { 2972,  14,  15,  14,    0,  -15}, // 0x73
+  { 2999,  10,  19,  10,    0,  -19}, // 0x74
+  { 3023,  16,  15,  16,    0,  -15}, // 0x75
+  { 3053,  14,  15,  14,    1,  -15}, // 0x76
+  { 3080,  20,  15,  20,    1,  -15}, // 0x77
+  { 3118,  17,  15,  14,   -2,  -15}, // 0x78
+  { 3150,  17,  21,  14,   -1,  -15}, // 0x79
+  { 3195,  15,  15,  14,   -1,  -15}, // 0x7A
+  { 3224,  11,  27,   9,    0,  -22}, // 0x7B
+  { 3262,   7,  24,   7,    0,  -20}, // 0x7C
+  { 3283,  11,  27,   9,   -2,  -22}, // 0x7D
+  { 3321,  16,   7,  18,    1,  -12}, // 0x7E
+};
+
+const GFXfont FreeSansBold18pt7b PROGMEM = {(uint8_t *)FreeSansBold18pt7bBitmaps, (GFXglyph *)FreeSansBold18pt7bGlyphs, 0x20, 0x7E, 42};
@@ -0,0 +1,23 @@
+// GFX font structures, as in TFT_eSPI's Fonts/GFXFF/gfxfont.h
+
+#pragma once
+
+#include <stdint.h>
+
+typedef struct
+{
+  uint32_t bitmapOffset; // Offset into the bitmap
+  uint8_t width, height; // Bitmap size in pixels
+  uint8_t xAdvance;      // Distance to the next character
+  int8_t xOffset;        // From the cursor to the top left of the bitmap
+  int8_t yOffset;
+} GFXglyph;
+
+typedef struct
+{
+  uint8_t *bitmap;  // Glyph bitmaps, run together
+  GFXglyph *glyph;  // Glyph array
+  uint16_t first;   // First and last character
+  uint16_t last;
+  uint8_t yAdvance; // Line height
+} GFXfont;
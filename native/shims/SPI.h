@@ -0,0 +1,30 @@
+#pragma once
+
+#include <Arduino.h>
+
+#define SPI_MODE0 0
+#define MSBFIRST 1
+#define VSPI 3
+#define HSPI 2
+
+class SPISettings
+{
+public:
+  SPISettings() {}
+  SPISettings(uint32_t clock, uint8_t bitOrder, uint8_t dataMode) {}
+};
+
+// Nothing on the other end, transfers read back zeros
+class SPIClass
+{
+public:
+  SPIClass(uint8_t bus = HSPI) {}
+  void begin(int8_t sck = -1, int8_t miso = -1, int8_t mosi = -1, int8_t ss = -1) {}
+  void end() {}
+  void beginTransaction(SPISettings settings) {}
+  void endTransaction() {}
+  uint8_t transfer(uint8_t data) { return 0; }
+  uint16_t transfer16(uint16_t data) { return 0; }
+};
+
+extern SPIClass SPI;
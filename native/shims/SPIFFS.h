@@ -0,0 +1,16 @@
+#pragma once
+
+#include "FS.h"
+
+class SPIFFSFS : public fs::FS
+{
+public:
+  bool begin(bool formatOnFail = false, const char *basePath = "/spiffs", uint8_t maxOpenFiles = 10,
+             const char *partitionLabel = NULL);
+  bool format();
+  size_t totalBytes();
+  size_t usedBytes();
+  void end() {}
+};
+
+extern SPIFFSFS SPIFFS;
@@ -0,0 +1,77 @@
+// SpotifyArduino for the native build
+// The sketch makes its own requests (connectionManager.h and friends), so
+// only the types and the calls it still makes are here. Token requests go
+// nowhere: a host run needs a refresh token in its config file.
+
+#pragma once
+
+#include <Arduino.h>
+
+#define SPOTIFY_HOST "api.spotify.com"
+#define SPOTIFY_ACCOUNTS_HOST "accounts.spotify.com"
+
+#ifndef SPOTIFY_MAX_NUM_ARTISTS
+#define SPOTIFY_MAX_NUM_ARTISTS 5
+#endif
+
+#ifndef SPOTIFY_NUM_ALBUM_IMAGES
+#define SPOTIFY_NUM_ALBUM_IMAGES 3
+#endif
+
+enum SpotifyPlayingType
+{
+  track,
+  episode,
+  other
+};
+
+struct SpotifyImage
+{
+  int height;
+  int width;
+  const char *url;
+};
+
+struct SpotifyArtist
+{
+  const char *artistName;
+  const char *artistUri;
+};
+
+struct CurrentlyPlaying
+{
+  SpotifyArtist artists[SPOTIFY_MAX_NUM_ARTISTS];
+  int numArtists;
+  const char *albumName;
+  const char *albumUri;
+  const char *trackName;
+  const char *trackUri;
+  SpotifyImage albumImages[SPOTIFY_NUM_ALBUM_IMAGES];
+  int numImages;
+  bool isPlaying;
+  long progressMs;
+  long durationMs;
+  const char *contextUri;
+  SpotifyPlayingType currentlyPlayingType;
+};
+
+class SpotifyArduino
+{
+public:
+  SpotifyArduino(Client &client, const char *clientId, const char *clientSecret, const char *refreshToken = "")
+      : _client(&client)
+  {
+  }
+
+  void lateInit(const char *clientId, const char *clientSecret, const char *refreshToken = "") {}
+  void setRefreshToken(const char *refreshToken) {}
+  bool refreshAccessToken() { return false; }
+  bool checkAndRefreshAccessToken() { return false; }
+  const char *requestAccessTokens(const char *code, const char *redirectUrl) { return NULL; }
+
+  bool autoTokenRefresh = true;
+  int currentlyPlayingBufferSize = 10000;
+
+private:
+  Client *_client;
+};
@@ -0,0 +1,5 @@
+#pragma once
+
+// Nothing checks them on the host, the stand-in server isn't TLS
+static const char *spotify_server_cert = "";
+static const char *spotify_image_server_cert = "";
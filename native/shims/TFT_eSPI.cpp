@@ -0,0 +1,596 @@
+// TFT_eSPI stand-in for the native build (see TFT_eSPI.h)
+
+#include <TFT_eSPI.h>
+
+static uint16_t swapped(uint16_t color)
+{
+  return (color >> 8) | (color << 8);
+}
+
+TFT_eSPI::TFT_eSPI(int16_t width, int16_t height) : _width(width), _height(height)
+{
+  if (width > 0 && height > 0)
+  {
+    _frame = (uint16_t *)calloc(width * height, sizeof(uint16_t));
+  }
+}
+
+TFT_eSPI::~TFT_eSPI()
+{
+  free(_frame);
+}
+
+void TFT_eSPI::init(uint8_t tabColor)
+{
+  resetNativeStats();
+}
+
+// The framebuffer keeps the orientation drawn in, so a rotation that turns
+// the panel sideways just swaps the sides
+void TFT_eSPI::setRotation(uint8_t rotation)
+{
+  bool landscape = (rotation & 1) != (_rotation & 1);
+  _rotation = rotation & 3;
+  if (landscape)
+  {
+    int16_t width = _width;
+    _width = _height;
+    _height = width;
+  }
+}
+
+void TFT_eSPI::beginDraw()
+{
+  if (!_inTransaction)
+  {
+    _inTransaction = true;
+    _transactions++;
+  }
+}
+
+void TFT_eSPI::endDraw()
+{
+  if (!_locked)
+  {
+    _inTransaction = false;
+  }
+}
+
+void TFT_eSPI::startWrite()
+{
+  beginDraw();
+  _locked = true;
+}
+
+void TFT_eSPI::endWrite()
+{
+  _locked = false;
+  endDraw();
+}
+
+void TFT_eSPI::countWindow(long pixels)
+{
+  _windows++;
+  _pixels += pixels;
+}
+
+bool TFT_eSPI::clip(int32_t &x, int32_t &y, int32_t &w, int32_t &h)
+{
+  if (x < 0)
+  {
+    w += x;
+    x = 0;
+  }
+  if (y < 0)
+  {
+    h += y;
+    y = 0;
+  }
+  if (x + w > _width)
+  {
+    w = _width - x;
+  }
+  if (y + h > _height)
+  {
+    h = _height - y;
+  }
+  return w > 0 && h > 0;
+}
+
+void TFT_eSPI::drawPixel(int32_t x, int32_t y, uint32_t color)
+{
+  fillRect(x, y, 1, 1, color);
+}
+
+void TFT_eSPI::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+{
+  if (!clip(x, y, w, h))
+  {
+    return;
+  }
+  beginDraw();
+  countWindow(w * h);
+  for (int32_t row = y; row < y + h; row++)
+  {
+    uint16_t *line = _frame + row * _width;
+    for (int32_t column = x; column < x + w; column++)
+    {
+      line[column] = color;
+    }
+  }
+  endDraw();
+}
+
+void TFT_eSPI::drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+{
+  startWrite();
+  drawFastHLine(x, y, w, color);
+  drawFastHLine(x, y + h - 1, w, color);
+  drawFastVLine(x, y + 1, h - 2, color);
+  drawFastVLine(x + w - 1, y + 1, h - 2, color);
+  endWrite();
+}
+
+uint16_t TFT_eSPI::readPixel(int32_t x, int32_t y)
+{
+  if (x < 0 || y < 0 || x >= _width || y >= _height)
+  {
+    return 0;
+  }
+  return _frame[y * _width + x];
+}
+
+void TFT_eSPI::setAddrWindow(int32_t x, int32_t y, int32_t w, int32_t h)
+{
+  beginDraw();
+  _windows++;
+  _windowX = x;
+  _windowY = y;
+  _windowW = w;
+  _windowH = h;
+  _windowPosition = 0;
+  endDraw();
+}
+
+// The next pixel of the address window, which wraps like the panel's does
+void TFT_eSPI::writeWindow(uint16_t color)
+{
+  if (_windowW <= 0 || _windowH <= 0)
+  {
+    return;
+  }
+  int32_t x = _windowX + _windowPosition % _windowW;
+  int32_t y = _windowY + _windowPosition / _windowW;
+  _windowPosition = (_windowPosition + 1) % ((long)_windowW * _windowH);
+  if (x >= 0 && y >= 0 && x < _width && y < _height)
+  {
+    _frame[y * _width + x] = color;
+  }
+}
+
+void TFT_eSPI::pushBlock(uint16_t color, uint32_t length)
+{
+  beginDraw();
+  _pixels += length;
+  while (length--)
+  {
+    writeWindow(color);
+  }
+  endDraw();
+}
+
+void TFT_eSPI::pushPixels(const void *data, uint32_t length)
+{
+  const uint16_t *pixels = (const uint16_t *)data;
+  beginDraw();
+  _pixels += length;
+  for (uint32_t i = 0; i < length; i++)
+  {
+    writeWindow(_swapBytes ? pixels[i] : swapped(pixels[i]));
+  }
+  endDraw();
+}
+
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data)
+{
+  pushImage(x, y, w, h, (const uint16_t *)data);
+}
+
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data)
+{
+  int32_t left = x;
+  int32_t top = y;
+  int32_t width = w;
+  if (!clip(x, y, w, h))
+  {
+    return;
+  }
+  beginDraw();
+  countWindow(w * h);
+  for (int32_t row = 0; row < h; row++)
+  {
+    const uint16_t *source = data + (y - top + row) * width + (x - left);
+    uint16_t *line = _frame + (y + row) * _width + x;
+    for (int32_t column = 0; column < w; column++)
+    {
+      line[column] = _swapBytes ? source[column] : swapped(source[column]);
+    }
+  }
+  endDraw();
+}
+
+// The same sum TFT_eSPI does, so blended colours match the device's
+uint16_t TFT_eSPI::alphaBlend(uint8_t alpha, uint16_t foreground, uint16_t background)
+{
+  uint32_t redBlue = background & 0xF81F;
+  redBlue += ((foreground & 0xF81F) - redBlue) * (alpha >> 2) >> 6;
+  uint32_t green = background & 0x07E0;
+  green += ((foreground & 0x07E0) - green) * alpha >> 8;
+  return (redBlue & 0xF81F) | (green & 0x07E0);
+}
+
+// Foreground pixels only, a run at a time, with the cursor on the baseline
+void TFT_eSPI::drawGlyph(int32_t x, int32_t y, uint8_t c)
+{
+  const GFXglyph *glyph = &_gfxFont->glyph[c - _gfxFont->first];
+  const uint8_t *bitmap = _gfxFont->bitmap + glyph->bitmapOffset;
+  int32_t size = _textSize;
+  uint8_t bits = 0;
+  uint8_t bit = 0;
+
+  startWrite();
+  for (int32_t row = 0; row < glyph->height; row++)
+  {
+    int32_t run = 0;
+    for (int32_t column = 0; column < glyph->width; column++)
+    {
+      if (bit == 0)
+      {
+        bits = *bitmap++;
+        bit = 0x80;
+      }
+      if (bits & bit)
+      {
+        run++;
+      }
+      else if (run > 0)
+      {
+        fillRect(x + (glyph->xOffset + column - run) * size, y + (glyph->yOffset + row) * size, run * size, size,
+                 textcolor);
+        run = 0;
+      }
+      bit >>= 1;
+    }
+    if (run > 0)
+    {
+      fillRect(x + (glyph->xOffset + glyph->width - run) * size, y + (glyph->yOffset + row) * size, run * size,
+               size, textcolor);
+    }
+  }
+  endWrite();
+}
+
+size_t TFT_eSPI::write(uint8_t c)
+{
+  if (_gfxFont == NULL)
+  {
+    // The GLCD font isn't drawn, its cells are still stepped over
+    if (c == '\n')
+    {
+      _cursorX = 0;
+      _cursorY += 8 * _textSize;
+    }
+    else if (c != '\r')
+    {
+      _cursorX += 6 * _textSize;
+    }
+    return 1;
+  }
+
+  if (c == '\n')
+  {
+    _cursorX = 0;
+    _cursorY += _textSize * _gfxFont->yAdvance;
+    return 1;
+  }
+  if (c < _gfxFont->first || c > _gfxFont->last)
+  {
+    return 1;
+  }
+  const GFXglyph *glyph = &_gfxFont->glyph[c - _gfxFont->first];
+  if (glyph->width > 0 && glyph->height > 0)
+  {
+    if (_wrapX && _cursorX + _textSize * (glyph->xOffset + glyph->width) > _width)
+    {
+      _cursorX = 0;
+      _cursorY += _textSize * _gfxFont->yAdvance;
+    }
+    if (_wrapY && _cursorY >= _height)
+    {
+      _cursorY = 0;
+    }
+    drawGlyph(_cursorX, _cursorY, c);
+  }
+  _cursorX += glyph->xAdvance * _textSize;
+  return 1;
+}
+
+// As TFT_eSPI measures it: the last character counts its ink, not its advance
+int16_t TFT_eSPI::textWidth(const char *text)
+{
+  if (_gfxFont == NULL)
+  {
+    return strlen(text) * 6 * _textSize;
+  }
+  int16_t width = 0;
+  for (const char *c = text; *c != '\0'; c++)
+  {
+    uint8_t code = *c;
+    if (code < _gfxFont->first || code > _gfxFont->last)
+    {
+      continue;
+    }
+    const GFXglyph *glyph = &_gfxFont->glyph[code - _gfxFont->first];
+    width += c[1] != '\0' ? glyph->xAdvance : glyph->xOffset + glyph->width;
+  }
+  return width * _textSize;
+}
+
+int16_t TFT_eSPI::fontHeight()
+{
+  return (_gfxFont != NULL ? _gfxFont->yAdvance : 8) * _textSize;
+}
+
+void TFT_eSPI::printNativeStats()
+{
+  Serial.print("Panel: ");
+  Serial.print(_transactions);
+  Serial.print(" transactions, ");
+  Serial.print(_windows);
+  Serial.print(" address windows, ");
+  Serial.print((unsigned long)_pixels);
+  Serial.println(" pixels");
+}
+
+void TFT_eSPI::resetNativeStats()
+{
+  _transactions = 0;
+  _windows = 0;
+  _pixels = 0;
+}
+
+// PNG with stored (uncompressed) deflate blocks, which needs no zlib
+static uint32_t crcTable[256];
+
+static uint32_t crc32(uint32_t crc, const uint8_t *data, size_t length)
+{
+  if (crcTable[1] == 0)
+  {
+    for (uint32_t n = 0; n < 256; n++)
+    {
+      uint32_t c = n;
+      for (int k = 0; k < 8; k++)
+      {
+        c = c & 1 ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+      }
+      crcTable[n] = c;
+    }
+  }
+  crc = ~crc;
+  while (length--)
+  {
+    crc = crcTable[(crc ^ *data++) & 0xFF] ^ (crc >> 8);
+  }
+  return ~crc;
+}
+
+static void putBigEndian(std::string &out, uint32_t value)
+{
+  out += (char)(value >> 24);
+  out += (char)(value >> 16);
+  out += (char)(value >> 8);
+  out += (char)value;
+}
+
+static void writeChunk(FILE *file, const char *type, const std::string &data)
+{
+  std::string chunk;
+  putBigEndian(chunk, data.size());
+  chunk += type;
+  chunk += data;
+  putBigEndian(chunk, crc32(0, (const uint8_t *)chunk.data() + 4, chunk.size() - 4));
+  fwrite(chunk.data(), 1, chunk.size(), file);
+}
+
+bool TFT_eSPI::writePng(const char *path)
+{
+  FILE *file = fopen(path, "wb");
+  if (file == NULL)
+  {
+    return false;
+  }
+
+  std::string header;
+  putBigEndian(header, _width);
+  putBigEndian(header, _height);
+  header += std::string("\x08\x02\x00\x00\x00", 5); // 8 bit RGB, no interlace
+
+  // Each row starts with filter type 0, then RGB565 widened to RGB888
+  std::string raw;
+  for (int32_t y = 0; y < _height; y++)
+  {
+    raw += '\0';
+    for (int32_t x = 0; x < _width; x++)
+    {
+      uint16_t color = _frame[y * _width + x];
+      uint8_t red = (color >> 11) & 0x1F;
+      uint8_t green = (color >> 5) & 0x3F;
+      uint8_t blue = color & 0x1F;
+      raw += (char)((red << 3) | (red >> 2));
+      raw += (char)((green << 2) | (green >> 4));
+      raw += (char)((blue << 3) | (blue >> 2));
+    }
+  }
+
+  std::string zlib("\x78\x01", 2);
+  uint32_t adlerA = 1;
+  uint32_t adlerB = 0;
+  for (uint8_t c : raw)
+  {
+    adlerA = (adlerA + c) % 65521;
+    adlerB = (adlerB + adlerA) % 65521;
+  }
+  for (size_t offset = 0; offset < raw.size(); offset += 65535)
+  {
+    uint16_t length = std::min(raw.size() - offset, (size_t)65535);
+    zlib += (char)(offset + length == raw.size() ? 1 : 0);
+    zlib += (char)(length & 0xFF);
+    zlib += (char)(length >> 8);
+    zlib += (char)(~length & 0xFF);
+    zlib += (char)((~length >> 8) & 0xFF);
+    zlib.append(raw, offset, length);
+  }
+  putBigEndian(zlib, (adlerB << 16) | adlerA);
+
+  fwrite("\x89PNG\r\n\x1a\n", 1, 8, file);
+  writeChunk(file, "IHDR", header);
+  writeChunk(file, "IDAT", zlib);
+  writeChunk(file, "IEND", "");
+  return fclose(file) == 0;
+}
+
+void *TFT_eSprite::createSprite(int16_t width, int16_t height, uint8_t frames)
+{
+  deleteSprite();
+  if (width <= 0 || height <= 0)
+  {
+    return NULL;
+  }
+  _pixels = (uint16_t *)calloc(width * height, sizeof(uint16_t));
+  if (_pixels != NULL)
+  {
+    _width = width;
+    _height = height;
+    if (_bits == 4)
+    {
+      createPalette();
+    }
+  }
+  return _pixels;
+}
+
+void TFT_eSprite::deleteSprite()
+{
+  free(_pixels);
+  _pixels = NULL;
+  _width = 0;
+  _height = 0;
+}
+
+// Without a palette a 4 bit sprite gets TFT_eSPI's default one
+void TFT_eSprite::createPalette(const uint16_t *palette, uint8_t colors)
+{
+  static const uint16_t defaultPalette[16] = {TFT_BLACK,  TFT_BROWN,  TFT_RED,    TFT_ORANGE, TFT_YELLOW, TFT_GREEN,
+                                              TFT_BLUE,   TFT_PURPLE, TFT_DARKGREY, TFT_WHITE,  TFT_CYAN,   TFT_MAGENTA,
+                                              TFT_MAROON, TFT_DARKGREEN, TFT_NAVY, TFT_PINK};
+  for (int i = 0; i < 16; i++)
+  {
+    _palette[i] = palette != NULL && i < colors ? palette[i] : defaultPalette[i];
+  }
+}
+
+uint16_t TFT_eSprite::store(uint32_t color)
+{
+  if (_bits == 4)
+  {
+    return color & 0x0F;
+  }
+  if (_bits == 8)
+  {
+    return ((color & 0xE000) >> 8) | ((color & 0x0700) >> 6) | ((color & 0x0018) >> 3);
+  }
+  return color;
+}
+
+uint16_t TFT_eSprite::colorAt(int32_t x, int32_t y)
+{
+  uint16_t value = _pixels[y * _width + x];
+  if (_bits == 4)
+  {
+    return _palette[value];
+  }
+  if (_bits == 8)
+  {
+    // RGB332 back to RGB565 the way TFT_eSPI widens it
+    return ((value & 0xE0) << 8 | (value & 0xC0) << 5) | ((value & 0x1C) << 6 | (value & 0x1C) << 3) |
+           ((value & 0x03) << 3 | (value & 0x03) << 1 | (value & 0x03) >> 1);
+  }
+  return value;
+}
+
+void TFT_eSprite::drawPixel(int32_t x, int32_t y, uint32_t color)
+{
+  if (_pixels != NULL && x >= 0 && y >= 0 && x < _width && y < _height)
+  {
+    _pixels[y * _width + x] = store(color);
+  }
+}
+
+void TFT_eSprite::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+{
+  if (_pixels == NULL || !clip(x, y, w, h))
+  {
+    return;
+  }
+  uint16_t value = store(color);
+  for (int32_t row = y; row < y + h; row++)
+  {
+    for (int32_t column = x; column < x + w; column++)
+    {
+      _pixels[row * _width + column] = value;
+    }
+  }
+}
+
+uint16_t TFT_eSprite::readPixel(int32_t x, int32_t y)
+{
+  if (_pixels == NULL || x < 0 || y < 0 || x >= _width || y >= _height)
+  {
+    return 0;
+  }
+  return colorAt(x, y);
+}
+
+void TFT_eSprite::pushSprite(int32_t x, int32_t y)
+{
+  pushSprite(x, y, 0, 0, _width, _height);
+}
+
+bool TFT_eSprite::pushSprite(int32_t x, int32_t y, int32_t sourceX, int32_t sourceY, int32_t w, int32_t h)
+{
+  if (_pixels == NULL || sourceX < 0 || sourceY < 0 || sourceX + w > _width || sourceY + h > _height)
+  {
+    return false;
+  }
+  int32_t left = x;
+  int32_t top = y;
+  if (!_display->clip(x, y, w, h))
+  {
+    return false;
+  }
+  sourceX += x - left;
+  sourceY += y - top;
+
+  _display->beginDraw();
+  _display->countWindow(w * h);
+  for (int32_t row = 0; row < h; row++)
+  {
+    uint16_t *line = _display->_frame + (y + row) * _display->_width + x;
+    for (int32_t column = 0; column < w; column++)
+    {
+      line[column] = colorAt(sourceX + column, sourceY + row);
+    }
+  }
+  _display->endDraw();
+  return true;
+}
@@ -0,0 +1,223 @@
+// TFT_eSPI stand-in for the native build
+// Draws into an RGB565 framebuffer in memory instead of the panel, and keeps
+// count of what would have gone over SPI: transactions, address windows and
+// pixels. Only the calls the sketch makes are here. Text is drawn with the
+// GFX free fonts, the built in GLCD font only moves the cursor. The FreeSans
+// fonts are stand-ins in Fonts/, made from the NotoSans smooth fonts in data/.
+//
+// Like the panel, pushImage() and pushPixels() take colours in the byte order
+// sent over SPI unless setSwapBytes(true), while fillRect() and friends take
+// them as they are. writePng() saves the framebuffer as seen on the screen.
+
+#pragma once
+
+#include <Arduino.h>
+#include <FS.h>
+
+#ifndef TFT_WIDTH
+#define TFT_WIDTH 240
+#endif
+#ifndef TFT_HEIGHT
+#define TFT_HEIGHT 320
+#endif
+
+#define TFT_BLACK 0x0000
+#define TFT_NAVY 0x000F
+#define TFT_DARKGREEN 0x03E0
+#define TFT_DARKCYAN 0x03EF
+#define TFT_MAROON 0x7800
+#define TFT_PURPLE 0x780F
+#define TFT_OLIVE 0x7BE0
+#define TFT_LIGHTGREY 0xD69A
+#define TFT_DARKGREY 0x7BEF
+#define TFT_BLUE 0x001F
+#define TFT_GREEN 0x07E0
+#define TFT_CYAN 0x07FF
+#define TFT_RED 0xF800
+#define TFT_MAGENTA 0xF81F
+#define TFT_YELLOW 0xFFE0
+#define TFT_WHITE 0xFFFF
+#define TFT_ORANGE 0xFDA0
+#define TFT_GREENYELLOW 0xB7E0
+#define TFT_PINK 0xFE19
+#define TFT_BROWN 0x9A60
+#define TFT_GOLD 0xFEA0
+#define TFT_SILVER 0xC618
+#define TFT_SKYBLUE 0x867D
+#define TFT_VIOLET 0x915C
+
+#define TL_DATUM 0
+
+#ifdef LOAD_GFXFF
+#include "Fonts/gfxfont.h"
+#include "Fonts/FreeSans9pt7b.h"
+#include "Fonts/FreeSansBold9pt7b.h"
+#include "Fonts/FreeSansBold12pt7b.h"
+#include "Fonts/FreeSansBold18pt7b.h"
+#endif
+
+class TFT_eSPI : public Print
+{
+public:
+  TFT_eSPI(int16_t width = TFT_WIDTH, int16_t height = TFT_HEIGHT);
+  virtual ~TFT_eSPI();
+
+  void init(uint8_t tabColor = 0);
+  void begin(uint8_t tabColor = 0) { init(tabColor); }
+  void setRotation(uint8_t rotation);
+  uint8_t getRotation() { return _rotation; }
+  int16_t width() { return _width; }
+  int16_t height() { return _height; }
+
+  // Transactions nest the way TFT_eSPI's do: startWrite() holds the bus
+  // until endWrite(), a draw outside one is a transaction of its own
+  void startWrite();
+  void endWrite();
+
+  virtual void drawPixel(int32_t x, int32_t y, uint32_t color);
+  virtual void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+  void fillScreen(uint32_t color) { fillRect(0, 0, _width, _height, color); }
+  void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) { fillRect(x, y, w, 1, color); }
+  void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) { fillRect(x, y, 1, h, color); }
+  void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+  uint16_t readPixel(int32_t x, int32_t y);
+
+  void setAddrWindow(int32_t x, int32_t y, int32_t w, int32_t h);
+  void pushColor(uint16_t color) { pushBlock(color, 1); }
+  void pushColor(uint16_t color, uint32_t length) { pushBlock(color, length); }
+  void pushBlock(uint16_t color, uint32_t length);
+  void pushPixels(const void *data, uint32_t length);
+  void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data);
+  void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data);
+  void setSwapBytes(bool swap) { _swapBytes = swap; }
+  bool getSwapBytes() { return _swapBytes; }
+
+  // DMA finishes as soon as it starts
+  bool initDMA(bool ctrlCS = false) { return true; }
+  void deInitDMA() {}
+  void pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data, uint16_t *buffer = NULL)
+  {
+    pushImage(x, y, w, h, data);
+  }
+  bool dmaBusy() { return false; }
+  void dmaWait() {}
+
+  uint16_t color565(uint8_t red, uint8_t green, uint8_t blue)
+  {
+    return ((red & 0xF8) << 8) | ((green & 0xFC) << 3) | (blue >> 3);
+  }
+  uint16_t alphaBlend(uint8_t alpha, uint16_t foreground, uint16_t background);
+
+  void setTextColor(uint16_t color) { textcolor = textbgcolor = color; }
+  void setTextColor(uint16_t color, uint16_t background, bool fillBackground = false)
+  {
+    textcolor = color;
+    textbgcolor = background;
+  }
+  void setTextWrap(bool wrapX, bool wrapY = false)
+  {
+    _wrapX = wrapX;
+    _wrapY = wrapY;
+  }
+  void setCursor(int16_t x, int16_t y)
+  {
+    _cursorX = x;
+    _cursorY = y;
+  }
+  int16_t getCursorX() { return _cursorX; }
+  int16_t getCursorY() { return _cursorY; }
+  void setTextSize(uint8_t size) { _textSize = size > 0 ? size : 1; }
+  void setTextDatum(uint8_t datum) {}
+  void setTextFont(uint8_t font) { _gfxFont = NULL; }
+  void setFreeFont(const GFXfont *font) { _gfxFont = font; }
+  int16_t textWidth(const char *text);
+  int16_t textWidth(const String &text) { return textWidth(text.c_str()); }
+  int16_t fontHeight();
+
+  size_t write(uint8_t c);
+  using Print::write;
+
+  uint32_t textcolor = TFT_WHITE;
+  uint32_t textbgcolor = TFT_BLACK;
+
+  // Host side: what was sent so far, and the screen as a PNG
+  void printNativeStats();
+  void resetNativeStats();
+  bool writePng(const char *path);
+
+protected:
+  // Bus bookkeeping around every draw
+  void beginDraw();
+  void endDraw();
+  void countWindow(long pixels);
+  bool clip(int32_t &x, int32_t &y, int32_t &w, int32_t &h);
+  void drawGlyph(int32_t x, int32_t y, uint8_t c);
+
+  int16_t _width;
+  int16_t _height;
+  uint16_t *_frame = NULL;
+
+  const GFXfont *_gfxFont = NULL;
+  int16_t _cursorX = 0;
+  int16_t _cursorY = 0;
+  uint8_t _textSize = 1;
+  bool _wrapX = true;
+  bool _wrapY = false;
+
+private:
+  void writeWindow(uint16_t color);
+  friend class TFT_eSprite;
+
+  uint8_t _rotation = 0;
+  bool _swapBytes = false;
+  bool _inTransaction = false;
+  bool _locked = false;
+
+  // The address window pushed pixels go to
+  int32_t _windowX = 0;
+  int32_t _windowY = 0;
+  int32_t _windowW = 0;
+  int32_t _windowH = 0;
+  long _windowPosition = 0;
+
+  unsigned long _transactions = 0;
+  unsigned long _windows = 0;
+  unsigned long long _pixels = 0;
+};
+
+// A sprite draws into its own buffer, at 16, 8 (RGB332) or 4 bits (palette
+// indexes) a pixel, and pushSprite() sends it to the display as one window
+class TFT_eSprite : public TFT_eSPI
+{
+public:
+  TFT_eSprite(TFT_eSPI *display) : TFT_eSPI(0, 0), _display(display) {}
+  ~TFT_eSprite() { deleteSprite(); }
+
+  void setColorDepth(int8_t bits) { _bits = bits == 4 || bits == 8 ? bits : 16; }
+  int8_t getColorDepth() { return _bits; }
+  void *createSprite(int16_t width, int16_t height, uint8_t frames = 1);
+  void deleteSprite();
+  bool created() { return _pixels != NULL; }
+  void *getPointer() { return _pixels; }
+
+  void createPalette(const uint16_t *palette = NULL, uint8_t colors = 16);
+  void setPaletteColor(uint8_t index, uint16_t color) { _palette[index & 0x0F] = color; }
+  uint16_t getPaletteColor(uint8_t index) { return _palette[index & 0x0F]; }
+
+  void drawPixel(int32_t x, int32_t y, uint32_t color);
+  void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+  void fillSprite(uint32_t color) { fillRect(0, 0, _width, _height, color); }
+  uint16_t readPixel(int32_t x, int32_t y);
+
+  void pushSprite(int32_t x, int32_t y);
+  bool pushSprite(int32_t x, int32_t y, int32_t sourceX, int32_t sourceY, int32_t w, int32_t h);
+
+private:
+  uint16_t store(uint32_t color);
+  uint16_t colorAt(int32_t x, int32_t y);
+
+  TFT_eSPI *_display;
+  int8_t _bits = 16;
+  uint16_t *_pixels = NULL; // One entry a pixel whatever the depth
+  uint16_t _palette[16];
+};
@@ -0,0 +1,37 @@
+// WebServer for the native build: never gets a request
+// Only the refresh token flow uses it, which a host run skips by having a
+// refresh token in its config file.
+
+#pragma once
+
+#include <Arduino.h>
+
+typedef enum
+{
+  HTTP_ANY,
+  HTTP_GET,
+  HTTP_HEAD,
+  HTTP_POST,
+  HTTP_PUT,
+  HTTP_PATCH,
+  HTTP_DELETE,
+  HTTP_OPTIONS
+} HTTPMethod;
+
+class WebServer
+{
+public:
+  WebServer(int port = 80) {}
+  void on(const char *uri, void (*handler)()) {}
+  void onNotFound(void (*handler)()) {}
+  void begin() {}
+  void handleClient() { delay(10); }
+  void send(int code, const char *contentType, const String &content) {}
+  int args() { return 0; }
+  String arg(int i) { return String(); }
+  String arg(const String &name) { return String(); }
+  String argName(int i) { return String(); }
+  bool hasArg(const String &name) { return false; }
+  String uri() { return String(); }
+  HTTPMethod method() { return HTTP_GET; }
+};
@@ -0,0 +1,40 @@
+// WiFi for the native build
+// Always connected. Every host name resolves to the loopback address, where
+// the stand-in server answers for api.spotify.com, accounts.spotify.com and
+// i.scdn.co.
+
+#pragma once
+
+#include <Arduino.h>
+
+#define WL_IDLE_STATUS 0
+#define WL_CONNECTED 3
+#define WL_DISCONNECTED 6
+
+typedef enum
+{
+  WIFI_OFF,
+  WIFI_STA,
+  WIFI_AP,
+  WIFI_AP_STA
+} wifi_mode_t;
+
+class WiFiClass
+{
+public:
+  int status() { return WL_CONNECTED; }
+  bool isConnected() { return true; }
+  bool mode(wifi_mode_t mode) { return true; }
+  bool disconnect(bool wifiOff = false) { return true; }
+  IPAddress localIP() { return IPAddress(127, 0, 0, 1); }
+  IPAddress softAPIP() { return IPAddress(127, 0, 0, 1); }
+  String SSID() { return String("native"); }
+  int8_t RSSI() { return -50; }
+  int hostByName(const char *host, IPAddress &result)
+  {
+    result = IPAddress(127, 0, 0, 1);
+    return 1;
+  }
+};
+
+extern WiFiClass WiFi;
@@ -0,0 +1,136 @@
+// WiFiClient for the native build: a blocking host TCP socket
+
+#pragma once
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <lwip/sockets.h>
+
+class WiFiClient : public Client
+{
+public:
+  ~WiFiClient() { stop(); }
+
+  int connect(IPAddress ip, uint16_t port) { return connect(ip, port, 5000); }
+
+  int connect(IPAddress ip, uint16_t port, int32_t timeout)
+  {
+    stop();
+    _fd = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (_fd < 0)
+    {
+      return 0;
+    }
+    struct timeval tv = {timeout / 1000, (timeout % 1000) * 1000};
+    setsockopt(_fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    setsockopt(_fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = (uint32_t)ip;
+    addr.sin_port = htons(port);
+    if (::connect(_fd, (struct sockaddr *)&addr, sizeof(addr)) < 0)
+    {
+      stop();
+      return 0;
+    }
+    return 1;
+  }
+
+  int connect(const char *host, uint16_t port)
+  {
+    IPAddress ip;
+    return WiFi.hostByName(host, ip) ? connect(ip, port) : 0;
+  }
+
+  size_t write(uint8_t c) { return write(&c, 1); }
+
+  size_t write(const uint8_t *buffer, size_t size)
+  {
+    size_t written = 0;
+    while (_fd >= 0 && written < size)
+    {
+      ssize_t sent = send(_fd, buffer + written, size - written, MSG_NOSIGNAL);
+      if (sent <= 0)
+      {
+        stop();
+        break;
+      }
+      written += sent;
+    }
+    return written;
+  }
+
+  int available()
+  {
+    int pending = 0;
+    if (_fd < 0 || ioctl(_fd, FIONREAD, &pending) < 0)
+    {
+      return 0;
+    }
+    return pending;
+  }
+
+  int read()
+  {
+    uint8_t c;
+    return read(&c, 1) == 1 ? c : -1;
+  }
+
+  int read(uint8_t *buffer, size_t size)
+  {
+    if (available() == 0)
+    {
+      return -1;
+    }
+    ssize_t received = recv(_fd, buffer, size, 0);
+    return received > 0 ? received : -1;
+  }
+
+  int peek()
+  {
+    uint8_t c;
+    return available() > 0 && recv(_fd, &c, 1, MSG_PEEK) == 1 ? c : -1;
+  }
+
+  void stop()
+  {
+    if (_fd >= 0)
+    {
+      close(_fd);
+      _fd = -1;
+    }
+  }
+
+  uint8_t connected()
+  {
+    if (_fd < 0)
+    {
+      return 0;
+    }
+    uint8_t c;
+    ssize_t peeked = recv(_fd, &c, 1, MSG_PEEK | MSG_DONTWAIT);
+    if (peeked == 0 || (peeked < 0 && errno != EAGAIN && errno != EWOULDBLOCK))
+    {
+      stop();
+      return 0;
+    }
+    return 1;
+  }
+
+  operator bool() { return connected(); }
+
+  void setNoDelay(bool noDelay)
+  {
+    int flag = noDelay;
+    setsockopt(_fd, IPPROTO_TCP, TCP_NODELAY, &flag, sizeof(flag));
+  }
+
+  int fd() const { return _fd; }
+
+  using Print::write;
+
+private:
+  int _fd = -1;
+};
@@ -0,0 +1,16 @@
+// WiFiClientSecure for the native build: a plain socket, certificates are
+// taken and ignored since the stand-in server doesn't speak TLS
+
+#pragma once
+
+#include "WiFiClient.h"
+
+class WiFiClientSecure : public WiFiClient
+{
+public:
+  void setCACert(const char *rootCA) {}
+  void setCertificate(const char *clientCA) {}
+  void setPrivateKey(const char *privateKey) {}
+  void setInsecure() {}
+  void setHandshakeTimeout(unsigned long handshakeTimeout) {}
+};
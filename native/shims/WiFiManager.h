@@ -0,0 +1,48 @@
+// WiFiManager for the native build: already connected, no portal
+
+#pragma once
+
+#include <Arduino.h>
+#include <WiFi.h>
+
+class WiFiManagerParameter
+{
+public:
+  WiFiManagerParameter(const char *id, const char *label, const char *defaultValue, int length)
+      : _value(defaultValue != NULL ? defaultValue : "")
+  {
+  }
+  const char *getValue() { return _value.c_str(); }
+
+private:
+  String _value;
+};
+
+class WiFiManager
+{
+public:
+  void setSaveConfigCallback(void (*callback)()) {}
+  void setAPCallback(void (*callback)(WiFiManager *)) { _apCallback = callback; }
+  void setConnectTimeout(unsigned long seconds) {}
+  void setConfigPortalTimeout(unsigned long seconds) {}
+  void setDebugOutput(bool debug) {}
+  void addParameter(WiFiManagerParameter *parameter) {}
+  bool autoConnect(const char *apName, const char *apPassword = NULL) { return true; }
+
+  // Draws the portal screen, then carries on as if the portal had connected
+  bool startConfigPortal(const char *apName, const char *apPassword = NULL)
+  {
+    _apName = apName;
+    if (_apCallback != NULL)
+    {
+      _apCallback(this);
+    }
+    return true;
+  }
+
+  String getConfigPortalSSID() { return _apName; }
+
+private:
+  void (*_apCallback)(WiFiManager *) = NULL;
+  String _apName;
+};
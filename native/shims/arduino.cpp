@@ -0,0 +1,304 @@
+// Arduino core functions for the native build (see Arduino.h)
+
+#include <Arduino.h>
+#include <ESPmDNS.h>
+#include <SPI.h>
+#include <driver/ledc.h>
+#include "nativeHost.h"
+
+#include <malloc.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+
+#define NATIVE_PIN_COUNT 40
+#define NATIVE_HEAP_SIZE (320 * 1024) // About what an ESP32 sketch starts with
+
+HardwareSerial Serial;
+EspClass ESP;
+SPIClass SPI;
+MDNSResponder MDNS;
+
+static const auto startTime = std::chrono::steady_clock::now();
+
+unsigned long millis()
+{
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+unsigned long micros()
+{
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+void delay(unsigned long ms)
+{
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void delayMicroseconds(unsigned int us)
+{
+  std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+void yield()
+{
+  std::this_thread::yield();
+}
+
+long random(long max)
+{
+  return max > 0 ? rand() % max : 0;
+}
+
+long random(long min, long max)
+{
+  return min < max ? min + random(max - min) : min;
+}
+
+long map(long x, long inMin, long inMax, long outMin, long outMax)
+{
+  return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+// Pins: a level each, all high until written, like inputs with a pullup
+// (so GPIO 0 reads "not pressed" and the touch IRQ "not touched")
+struct NativePin
+{
+  int level = HIGH;
+  void (*isr)() = NULL;
+  int mode = 0;
+};
+
+static NativePin pins[NATIVE_PIN_COUNT];
+static std::recursive_mutex interruptLock; // Held while an ISR runs, and by noInterrupts()
+
+void pinMode(uint8_t pin, uint8_t mode) {}
+
+int digitalRead(uint8_t pin)
+{
+  return pin < NATIVE_PIN_COUNT ? pins[pin].level : HIGH;
+}
+
+void digitalWrite(uint8_t pin, uint8_t level)
+{
+  if (pin < NATIVE_PIN_COUNT)
+  {
+    pins[pin].level = level;
+  }
+}
+
+void attachInterrupt(uint8_t pin, void (*isr)(), int mode)
+{
+  if (pin < NATIVE_PIN_COUNT)
+  {
+    std::lock_guard<std::recursive_mutex> lock(interruptLock);
+    pins[pin].isr = isr;
+    pins[pin].mode = mode;
+  }
+}
+
+void detachInterrupt(uint8_t pin)
+{
+  attachInterrupt(pin, NULL, 0);
+}
+
+void noInterrupts()
+{
+  interruptLock.lock();
+}
+
+void interrupts()
+{
+  interruptLock.unlock();
+}
+
+void nativeSetPin(uint8_t pin, int level)
+{
+  if (pin >= NATIVE_PIN_COUNT)
+  {
+    return;
+  }
+  std::lock_guard<std::recursive_mutex> lock(interruptLock);
+  NativePin &p = pins[pin];
+  int previous = p.level;
+  p.level = level;
+  bool edge = (p.mode == CHANGE && previous != level) || (p.mode == RISING && previous == LOW && level == HIGH) ||
+              (p.mode == FALLING && previous == HIGH && level == LOW);
+  if (edge && p.isr != NULL)
+  {
+    p.isr();
+  }
+}
+
+// One thread runs timed work in order, standing in for timers and interrupts
+static std::mutex timerLock;
+static std::condition_variable timerWake;
+static std::multimap<unsigned long, std::function<void()>> timerQueue;
+static bool timerRunning = false;
+
+static void timerThread()
+{
+  std::unique_lock<std::mutex> lock(timerLock);
+  while (true)
+  {
+    if (timerQueue.empty())
+    {
+      timerWake.wait(lock);
+      continue;
+    }
+    unsigned long due = timerQueue.begin()->first;
+    unsigned long now = millis();
+    if (due > now)
+    {
+      timerWake.wait_for(lock, std::chrono::milliseconds(due - now));
+      continue;
+    }
+    std::function<void()> work = timerQueue.begin()->second;
+    timerQueue.erase(timerQueue.begin());
+    lock.unlock();
+    work();
+    lock.lock();
+  }
+}
+
+void nativeAfter(unsigned long ms, std::function<void()> work)
+{
+  std::lock_guard<std::mutex> lock(timerLock);
+  if (!timerRunning)
+  {
+    std::thread(timerThread).detach();
+    timerRunning = true;
+  }
+  timerQueue.emplace(millis() + ms, work);
+  timerWake.notify_one();
+}
+
+// Backlight: the duty is kept, a fade jumps to its end when its time is up
+static uint32_t ledcDuty[16];
+static ledc_cb_t fadeCallback = NULL;
+static void *fadeCallbackArg = NULL;
+static uint32_t fadeTarget = 0;
+static int fadeMs = 0;
+static std::atomic<unsigned long> fadeCount(0); // A new fade replaces the one running, like the hardware
+
+double ledcSetup(uint8_t channel, double frequency, uint8_t resolution)
+{
+  return frequency;
+}
+
+void ledcAttachPin(uint8_t pin, uint8_t channel) {}
+
+void ledcWrite(uint8_t channel, uint32_t duty)
+{
+  ledcDuty[channel & 15] = duty;
+}
+
+uint32_t ledcRead(uint8_t channel)
+{
+  return ledcDuty[channel & 15];
+}
+
+esp_err_t ledc_fade_func_install(int flags)
+{
+  return ESP_OK;
+}
+
+esp_err_t ledc_cb_register(ledc_mode_t mode, ledc_channel_t channel, ledc_cbs_t *callbacks, void *userArg)
+{
+  fadeCallback = callbacks->fade_cb;
+  fadeCallbackArg = userArg;
+  return ESP_OK;
+}
+
+esp_err_t ledc_set_fade_with_time(ledc_mode_t mode, ledc_channel_t channel, uint32_t targetDuty, int maxFadeTimeMs)
+{
+  fadeTarget = targetDuty;
+  fadeMs = maxFadeTimeMs;
+  return ESP_OK;
+}
+
+esp_err_t ledc_fade_start(ledc_mode_t mode, ledc_channel_t channel, ledc_fade_mode_t fadeMode)
+{
+  uint32_t target = fadeTarget;
+  unsigned long fade = ++fadeCount;
+  auto finish = [channel, target, mode, fade]()
+  {
+    if (fade != fadeCount)
+    {
+      return;
+    }
+    ledcWrite(channel, target);
+    if (fadeCallback != NULL)
+    {
+      ledc_cb_param_t param = {LEDC_FADE_END_EVT, (uint32_t)mode, (uint32_t)channel, target};
+      fadeCallback(&param, fadeCallbackArg);
+    }
+  };
+  if (fadeMode == LEDC_FADE_WAIT_DONE)
+  {
+    delay(fadeMs);
+    finish();
+  }
+  else
+  {
+    nativeAfter(fadeMs, finish);
+  }
+  return ESP_OK;
+}
+
+static std::mutex serialLock;
+
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size)
+{
+  std::lock_guard<std::mutex> lock(serialLock);
+  return fwrite(buffer, 1, size, stdout);
+}
+
+void HardwareSerial::flush()
+{
+  std::lock_guard<std::mutex> lock(serialLock);
+  fflush(stdout);
+}
+
+// Heap in use by the sketch, counted from the first time it is asked for
+static size_t heapInUse()
+{
+  struct mallinfo2 info = mallinfo2();
+  static size_t baseline = info.uordblks + info.hblkhd;
+  size_t used = info.uordblks + info.hblkhd;
+  return used > baseline ? used - baseline : 0;
+}
+
+uint32_t EspClass::getFreeHeap()
+{
+  size_t used = heapInUse();
+  return used < NATIVE_HEAP_SIZE ? NATIVE_HEAP_SIZE - used : 0;
+}
+
+uint32_t EspClass::getMinFreeHeap()
+{
+  return getFreeHeap();
+}
+
+uint32_t EspClass::getMaxAllocHeap()
+{
+  return getFreeHeap();
+}
+
+uint32_t EspClass::getHeapSize()
+{
+  return NATIVE_HEAP_SIZE;
+}
+
+void EspClass::restart()
+{
+  Serial.println("ESP.restart() called, exiting");
+  Serial.flush();
+  _exit(0);
+}
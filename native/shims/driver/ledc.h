@@ -0,0 +1,60 @@
+// ESP-IDF LEDC fade API for the native build
+// A fade sets the duty at its end and calls the fade end callback from the
+// timer thread, the way the hardware interrupt would.
+
+#pragma once
+
+#include <Arduino.h>
+
+typedef int esp_err_t;
+#define ESP_OK 0
+#define ESP_FAIL -1
+
+typedef enum
+{
+  LEDC_HIGH_SPEED_MODE,
+  LEDC_LOW_SPEED_MODE
+} ledc_mode_t;
+
+typedef enum
+{
+  LEDC_CHANNEL_0,
+  LEDC_CHANNEL_1,
+  LEDC_CHANNEL_2,
+  LEDC_CHANNEL_3,
+  LEDC_CHANNEL_4,
+  LEDC_CHANNEL_5,
+  LEDC_CHANNEL_6,
+  LEDC_CHANNEL_7
+} ledc_channel_t;
+
+typedef enum
+{
+  LEDC_FADE_NO_WAIT,
+  LEDC_FADE_WAIT_DONE
+} ledc_fade_mode_t;
+
+typedef enum
+{
+  LEDC_FADE_END_EVT
+} ledc_cb_event_t;
+
+typedef struct
+{
+  ledc_cb_event_t event;
+  uint32_t speed_mode;
+  uint32_t channel;
+  uint32_t duty;
+} ledc_cb_param_t;
+
+typedef bool (*ledc_cb_t)(const ledc_cb_param_t *param, void *user_arg);
+
+typedef struct
+{
+  ledc_cb_t fade_cb;
+} ledc_cbs_t;
+
+esp_err_t ledc_fade_func_install(int intr_alloc_flags);
+esp_err_t ledc_cb_register(ledc_mode_t speed_mode, ledc_channel_t channel, ledc_cbs_t *cbs, void *user_arg);
+esp_err_t ledc_set_fade_with_time(ledc_mode_t speed_mode, ledc_channel_t channel, uint32_t target_duty, int max_fade_time_ms);
+esp_err_t ledc_fade_start(ledc_mode_t speed_mode, ledc_channel_t channel, ledc_fade_mode_t fade_mode);
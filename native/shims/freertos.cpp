@@ -0,0 +1,270 @@
+// FreeRTOS on threads for the native build (see freertos/FreeRTOS.h)
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct NativeTask
+{
+  std::string name;
+  std::mutex lock;
+  std::condition_variable notified;
+  uint32_t notifyCount = 0;
+};
+
+struct NativeQueue
+{
+  std::mutex lock;
+  std::condition_variable changed;
+  std::deque<std::vector<uint8_t>> items;
+  size_t length;
+  size_t itemSize;
+};
+
+// The task each thread runs as, the loop task is made the first time it asks
+static thread_local NativeTask *currentTask = NULL;
+
+struct NativeTaskStart
+{
+  NativeTask *task;
+  TaskFunction_t code;
+  void *parameters;
+};
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t code, const char *name, uint32_t stackDepth, void *parameters,
+                                   UBaseType_t priority, TaskHandle_t *createdTask, BaseType_t coreId)
+{
+  NativeTask *task = new NativeTask();
+  task->name = name;
+  NativeTaskStart start = {task, code, parameters};
+  std::thread([start]()
+              {
+                currentTask = start.task;
+                start.code(start.parameters);
+              })
+      .detach();
+  if (createdTask != NULL)
+  {
+    *createdTask = task;
+  }
+  return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t code, const char *name, uint32_t stackDepth, void *parameters,
+                       UBaseType_t priority, TaskHandle_t *createdTask)
+{
+  return xTaskCreatePinnedToCore(code, name, stackDepth, parameters, priority, createdTask, tskNO_AFFINITY);
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle()
+{
+  if (currentTask == NULL)
+  {
+    currentTask = new NativeTask();
+    currentTask->name = "loopTask";
+  }
+  return currentTask;
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+  delay(ticks);
+}
+
+void vTaskDelete(TaskHandle_t task)
+{
+  // Only a task deleting itself is supported, its thread just stops here
+  while (true)
+  {
+    delay(1000);
+  }
+}
+
+TickType_t xTaskGetTickCount()
+{
+  return millis();
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task)
+{
+  return 0; // Host threads have megabytes of stack, nothing to measure
+}
+
+void xTaskNotifyGive(TaskHandle_t task)
+{
+  std::lock_guard<std::mutex> lock(task->lock);
+  task->notifyCount++;
+  task->notified.notify_one();
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *higherPriorityTaskWoken)
+{
+  xTaskNotifyGive(task);
+  if (higherPriorityTaskWoken != NULL)
+  {
+    *higherPriorityTaskWoken = pdFALSE;
+  }
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearCountOnExit, TickType_t ticksToWait)
+{
+  NativeTask *task = xTaskGetCurrentTaskHandle();
+  std::unique_lock<std::mutex> lock(task->lock);
+  if (ticksToWait == portMAX_DELAY)
+  {
+    task->notified.wait(lock, [task]() { return task->notifyCount > 0; });
+  }
+  else
+  {
+    task->notified.wait_for(lock, std::chrono::milliseconds(ticksToWait), [task]() { return task->notifyCount > 0; });
+  }
+  uint32_t count = task->notifyCount;
+  if (count > 0)
+  {
+    task->notifyCount = clearCountOnExit ? 0 : count - 1;
+  }
+  return count;
+}
+
+// Waits on the queue's condition until ready() or the ticks run out
+template <typename Ready>
+static bool waitFor(NativeQueue *queue, std::unique_lock<std::mutex> &lock, TickType_t ticksToWait, Ready ready)
+{
+  if (ticksToWait == portMAX_DELAY)
+  {
+    queue->changed.wait(lock, ready);
+    return true;
+  }
+  return queue->changed.wait_for(lock, std::chrono::milliseconds(ticksToWait), ready);
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize)
+{
+  NativeQueue *queue = new NativeQueue();
+  queue->length = length;
+  queue->itemSize = itemSize;
+  return queue;
+}
+
+void vQueueDelete(QueueHandle_t queue)
+{
+  delete queue;
+}
+
+static BaseType_t send(QueueHandle_t queue, const void *item, TickType_t ticksToWait, bool front)
+{
+  std::unique_lock<std::mutex> lock(queue->lock);
+  if (!waitFor(queue, lock, ticksToWait, [queue]() { return queue->items.size() < queue->length; }))
+  {
+    return errQUEUE_FULL;
+  }
+  const uint8_t *bytes = (const uint8_t *)item;
+  std::vector<uint8_t> copy(bytes, bytes + queue->itemSize);
+  if (front)
+  {
+    queue->items.push_front(copy);
+  }
+  else
+  {
+    queue->items.push_back(copy);
+  }
+  queue->changed.notify_all();
+  return pdPASS;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticksToWait)
+{
+  return send(queue, item, ticksToWait, false);
+}
+
+BaseType_t xQueueSendToBack(QueueHandle_t queue, const void *item, TickType_t ticksToWait)
+{
+  return send(queue, item, ticksToWait, false);
+}
+
+BaseType_t xQueueSendToFront(QueueHandle_t queue, const void *item, TickType_t ticksToWait)
+{
+  return send(queue, item, ticksToWait, true);
+}
+
+BaseType_t xQueueOverwrite(QueueHandle_t queue, const void *item)
+{
+  {
+    std::lock_guard<std::mutex> lock(queue->lock);
+    queue->items.clear();
+  }
+  return send(queue, item, 0, false);
+}
+
+static BaseType_t receive(QueueHandle_t queue, void *buffer, TickType_t ticksToWait, bool remove)
+{
+  std::unique_lock<std::mutex> lock(queue->lock);
+  if (!waitFor(queue, lock, ticksToWait, [queue]() { return !queue->items.empty(); }))
+  {
+    return pdFALSE;
+  }
+  if (queue->itemSize > 0)
+  {
+    memcpy(buffer, queue->items.front().data(), queue->itemSize);
+  }
+  if (remove)
+  {
+    queue->items.pop_front();
+    queue->changed.notify_all();
+  }
+  return pdTRUE;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void *buffer, TickType_t ticksToWait)
+{
+  return receive(queue, buffer, ticksToWait, true);
+}
+
+BaseType_t xQueuePeek(QueueHandle_t queue, void *buffer, TickType_t ticksToWait)
+{
+  return receive(queue, buffer, ticksToWait, false);
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue)
+{
+  std::lock_guard<std::mutex> lock(queue->lock);
+  return queue->items.size();
+}
+
+BaseType_t xQueueReset(QueueHandle_t queue)
+{
+  std::lock_guard<std::mutex> lock(queue->lock);
+  queue->items.clear();
+  queue->changed.notify_all();
+  return pdPASS;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex()
+{
+  QueueHandle_t queue = xQueueCreate(1, 0);
+  xQueueSend(queue, NULL, 0);
+  return queue;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticksToWait)
+{
+  return xQueueReceive(semaphore, NULL, ticksToWait);
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore)
+{
+  return xQueueSend(semaphore, NULL, 0);
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t semaphore)
+{
+  vQueueDelete(semaphore);
+}
@@ -0,0 +1,277 @@
+// Directory backed file system for the native build (see FS.h)
+
+#include <FS.h>
+#include <SPIFFS.h>
+#include "nativeHost.h"
+
+#include <dirent.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#define NATIVE_SPIFFS_SIZE 1441792 // The SPIFFS partition in the default esp32dev layout
+
+SPIFFSFS SPIFFS;
+
+static std::string spiffsRoot = "spiffs";
+
+void nativeSpiffsBegin(const char *root)
+{
+  spiffsRoot = root;
+}
+
+static std::string hostPath(const char *path)
+{
+  return spiffsRoot + (path[0] == '/' ? "" : "/") + path;
+}
+
+// Makes the folders above path, for names like /art/1a2b
+static void makeParents(const std::string &path)
+{
+  for (size_t slash = path.find('/', 1); slash != std::string::npos; slash = path.find('/', slash + 1))
+  {
+    ::mkdir(path.substr(0, slash).c_str(), 0755);
+  }
+}
+
+namespace fs
+{
+
+struct FileImpl
+{
+  std::string path; // As the sketch named it
+  FILE *file = NULL;
+  DIR *dir = NULL;
+
+  ~FileImpl()
+  {
+    if (file != NULL)
+    {
+      fclose(file);
+    }
+    if (dir != NULL)
+    {
+      closedir(dir);
+    }
+  }
+};
+
+size_t File::write(const uint8_t *buffer, size_t size)
+{
+  return _impl && _impl->file != NULL ? fwrite(buffer, 1, size, _impl->file) : 0;
+}
+
+int File::available()
+{
+  return _impl && _impl->file != NULL ? size() - position() : 0;
+}
+
+int File::read()
+{
+  return _impl && _impl->file != NULL ? fgetc(_impl->file) : -1;
+}
+
+size_t File::read(uint8_t *buffer, size_t size)
+{
+  return _impl && _impl->file != NULL ? fread(buffer, 1, size, _impl->file) : 0;
+}
+
+int File::peek()
+{
+  if (!_impl || _impl->file == NULL)
+  {
+    return -1;
+  }
+  int c = fgetc(_impl->file);
+  if (c != EOF)
+  {
+    ungetc(c, _impl->file);
+  }
+  return c;
+}
+
+void File::flush()
+{
+  if (_impl && _impl->file != NULL)
+  {
+    fflush(_impl->file);
+  }
+}
+
+bool File::seek(uint32_t position, SeekMode mode)
+{
+  int whence = mode == SeekCur ? SEEK_CUR : (mode == SeekEnd ? SEEK_END : SEEK_SET);
+  return _impl && _impl->file != NULL && fseek(_impl->file, position, whence) == 0;
+}
+
+size_t File::position() const
+{
+  return _impl && _impl->file != NULL ? ftell(_impl->file) : 0;
+}
+
+size_t File::size() const
+{
+  struct stat info;
+  if (!_impl || _impl->file == NULL)
+  {
+    return 0;
+  }
+  fflush(_impl->file);
+  return fstat(fileno(_impl->file), &info) == 0 ? info.st_size : 0;
+}
+
+void File::close()
+{
+  _impl.reset();
+}
+
+File::operator bool() const
+{
+  return _impl && (_impl->file != NULL || _impl->dir != NULL);
+}
+
+const char *File::path() const
+{
+  return _impl ? _impl->path.c_str() : NULL;
+}
+
+const char *File::name() const
+{
+  if (!_impl)
+  {
+    return NULL;
+  }
+  size_t slash = _impl->path.rfind('/');
+  return _impl->path.c_str() + (slash == std::string::npos ? 0 : slash + 1);
+}
+
+bool File::isDirectory()
+{
+  return _impl && _impl->dir != NULL;
+}
+
+File File::openNextFile(const char *mode)
+{
+  if (!isDirectory())
+  {
+    return File();
+  }
+  struct dirent *entry;
+  while ((entry = readdir(_impl->dir)) != NULL)
+  {
+    if (strcmp(entry->d_name, ".") != 0 && strcmp(entry->d_name, "..") != 0)
+    {
+      std::string child = _impl->path + (_impl->path.back() == '/' ? "" : "/") + entry->d_name;
+      return SPIFFS.open(child.c_str(), mode);
+    }
+  }
+  return File();
+}
+
+void File::rewindDirectory()
+{
+  if (isDirectory())
+  {
+    rewinddir(_impl->dir);
+  }
+}
+
+File FS::open(const char *path, const char *mode, bool create)
+{
+  std::string host = hostPath(path);
+  auto impl = std::make_shared<FileImpl>();
+  impl->path = path;
+
+  struct stat info;
+  if (stat(host.c_str(), &info) == 0 && S_ISDIR(info.st_mode))
+  {
+    impl->dir = opendir(host.c_str());
+    return impl->dir != NULL ? File(impl) : File();
+  }
+
+  std::string hostMode = mode;
+  if (hostMode[0] != 'r')
+  {
+    makeParents(host);
+  }
+  hostMode += "b";
+  impl->file = fopen(host.c_str(), hostMode.c_str());
+  return impl->file != NULL ? File(impl) : File();
+}
+
+bool FS::exists(const char *path)
+{
+  struct stat info;
+  return stat(hostPath(path).c_str(), &info) == 0;
+}
+
+bool FS::remove(const char *path)
+{
+  return ::remove(hostPath(path).c_str()) == 0;
+}
+
+bool FS::rename(const char *pathFrom, const char *pathTo)
+{
+  std::string to = hostPath(pathTo);
+  makeParents(to);
+  return ::rename(hostPath(pathFrom).c_str(), to.c_str()) == 0;
+}
+
+bool FS::mkdir(const char *path)
+{
+  return ::mkdir(hostPath(path).c_str(), 0755) == 0 || errno == EEXIST;
+}
+
+bool FS::rmdir(const char *path)
+{
+  return ::rmdir(hostPath(path).c_str()) == 0;
+}
+
+} // namespace fs
+
+bool SPIFFSFS::begin(bool formatOnFail, const char *basePath, uint8_t maxOpenFiles, const char *partitionLabel)
+{
+  makeParents(spiffsRoot + "/");
+  struct stat info;
+  return stat(spiffsRoot.c_str(), &info) == 0 && S_ISDIR(info.st_mode);
+}
+
+bool SPIFFSFS::format()
+{
+  return false; // Not going to empty a folder on the host
+}
+
+size_t SPIFFSFS::totalBytes()
+{
+  return NATIVE_SPIFFS_SIZE;
+}
+
+static size_t folderBytes(const std::string &path)
+{
+  size_t total = 0;
+  DIR *dir = opendir(path.c_str());
+  if (dir == NULL)
+  {
+    return 0;
+  }
+  struct dirent *entry;
+  while ((entry = readdir(dir)) != NULL)
+  {
+    if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0)
+    {
+      continue;
+    }
+    std::string child = path + "/" + entry->d_name;
+    struct stat info;
+    if (stat(child.c_str(), &info) == 0)
+    {
+      total += S_ISDIR(info.st_mode) ? folderBytes(child) : info.st_size;
+    }
+  }
+  closedir(dir);
+  return total;
+}
+
+size_t SPIFFSFS::usedBytes()
+{
+  return folderBytes(spiffsRoot);
+}
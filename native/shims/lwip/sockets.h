@@ -0,0 +1,15 @@
+// lwIP sockets for the native build: the host's BSD sockets
+// Every host name resolves to 127.0.0.1 (see WiFi.h), and a connect() to
+// port 443 there goes to the stand-in server's port instead (see wifi.cpp).
+
+#pragma once
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/ioctl.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <unistd.h>
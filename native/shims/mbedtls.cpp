@@ -0,0 +1,241 @@
+// mbedTLS passthrough for the native build (see mbedtls/ssl.h)
+
+#include <lwip/sockets.h>
+
+#include <cstdlib>
+#include <cstring>
+
+#include "mbedtls/ctr_drbg.h"
+#include "mbedtls/entropy.h"
+#include "mbedtls/net_sockets.h"
+#include "mbedtls/ssl.h"
+#include "mbedtls/x509_crt.h"
+
+void mbedtls_x509_crt_init(mbedtls_x509_crt *crt)
+{
+  crt->parsed = 0;
+}
+
+void mbedtls_x509_crt_free(mbedtls_x509_crt *crt)
+{
+  crt->parsed = 0;
+}
+
+int mbedtls_x509_crt_parse(mbedtls_x509_crt *chain, const unsigned char *buf, size_t buflen)
+{
+  chain->parsed = 1;
+  return 0;
+}
+
+void mbedtls_entropy_init(mbedtls_entropy_context *ctx)
+{
+  ctx->ready = 1;
+}
+
+int mbedtls_entropy_func(void *data, unsigned char *output, size_t len)
+{
+  for (size_t i = 0; i < len; i++)
+  {
+    output[i] = rand();
+  }
+  return 0;
+}
+
+void mbedtls_ctr_drbg_init(mbedtls_ctr_drbg_context *ctx)
+{
+  ctx->seeded = 0;
+}
+
+int mbedtls_ctr_drbg_seed(mbedtls_ctr_drbg_context *ctx, int (*f_entropy)(void *, unsigned char *, size_t),
+                          void *p_entropy, const unsigned char *custom, size_t len)
+{
+  ctx->seeded = 1;
+  return 0;
+}
+
+int mbedtls_ctr_drbg_random(void *p_rng, unsigned char *output, size_t output_len)
+{
+  return mbedtls_entropy_func(NULL, output, output_len);
+}
+
+int mbedtls_net_send(void *ctx, const unsigned char *buf, size_t len)
+{
+  int fd = ((mbedtls_net_context *)ctx)->fd;
+  ssize_t sent = send(fd, buf, len, MSG_NOSIGNAL);
+  if (sent >= 0)
+  {
+    return sent;
+  }
+  if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+  {
+    return MBEDTLS_ERR_SSL_WANT_WRITE;
+  }
+  return errno == EPIPE || errno == ECONNRESET ? MBEDTLS_ERR_NET_CONN_RESET : MBEDTLS_ERR_NET_SEND_FAILED;
+}
+
+int mbedtls_net_recv(void *ctx, unsigned char *buf, size_t len)
+{
+  int fd = ((mbedtls_net_context *)ctx)->fd;
+  ssize_t received = recv(fd, buf, len, 0);
+  if (received >= 0)
+  {
+    return received;
+  }
+  if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+  {
+    return MBEDTLS_ERR_SSL_WANT_READ;
+  }
+  return errno == ECONNRESET ? MBEDTLS_ERR_NET_CONN_RESET : MBEDTLS_ERR_NET_RECV_FAILED;
+}
+
+static int bioFd(const mbedtls_ssl_context *ssl)
+{
+  return ssl->bio != NULL ? ((mbedtls_net_context *)ssl->bio)->fd : -1;
+}
+
+void mbedtls_ssl_init(mbedtls_ssl_context *ssl)
+{
+  memset(ssl, 0, sizeof(*ssl));
+}
+
+void mbedtls_ssl_free(mbedtls_ssl_context *ssl)
+{
+  memset(ssl, 0, sizeof(*ssl));
+}
+
+int mbedtls_ssl_setup(mbedtls_ssl_context *ssl, const mbedtls_ssl_config *conf)
+{
+  return 0;
+}
+
+int mbedtls_ssl_set_hostname(mbedtls_ssl_context *ssl, const char *hostname)
+{
+  return 0;
+}
+
+void mbedtls_ssl_set_bio(mbedtls_ssl_context *ssl, void *p_bio, mbedtls_ssl_send_t *f_send, mbedtls_ssl_recv_t *f_recv,
+                         mbedtls_ssl_recv_timeout_t *f_recv_timeout)
+{
+  ssl->bio = p_bio;
+  ssl->send = f_send;
+  ssl->recv = f_recv;
+}
+
+int mbedtls_ssl_handshake(mbedtls_ssl_context *ssl)
+{
+  // A new session every time, the offered one is never taken up
+  static uint32_t handshakes = 0;
+  handshakes++;
+  ssl->session.valid = true;
+  ssl->session.id_len = sizeof(handshakes);
+  memcpy(ssl->session.id, &handshakes, sizeof(handshakes));
+  memset(ssl->session.master, 0, sizeof(ssl->session.master));
+  memcpy(ssl->session.master, &handshakes, sizeof(handshakes));
+  return 0;
+}
+
+int mbedtls_ssl_read(mbedtls_ssl_context *ssl, unsigned char *buf, size_t len)
+{
+  if (len == 0)
+  {
+    // Only checks the connection: has the server closed it?
+    unsigned char next;
+    ssize_t peeked = recv(bioFd(ssl), &next, 1, MSG_PEEK);
+    if (peeked > 0)
+    {
+      return 0;
+    }
+    if (peeked == 0)
+    {
+      return MBEDTLS_ERR_SSL_PEER_CLOSE_NOTIFY;
+    }
+    return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR ? MBEDTLS_ERR_SSL_WANT_READ
+                                                                       : MBEDTLS_ERR_NET_RECV_FAILED;
+  }
+  return ssl->recv(ssl->bio, buf, len);
+}
+
+int mbedtls_ssl_write(mbedtls_ssl_context *ssl, const unsigned char *buf, size_t len)
+{
+  return ssl->send(ssl->bio, buf, len);
+}
+
+size_t mbedtls_ssl_get_bytes_avail(const mbedtls_ssl_context *ssl)
+{
+  int pending = 0;
+  if (bioFd(ssl) < 0 || ioctl(bioFd(ssl), FIONREAD, &pending) < 0)
+  {
+    return 0;
+  }
+  return pending;
+}
+
+int mbedtls_ssl_close_notify(mbedtls_ssl_context *ssl)
+{
+  return 0;
+}
+
+void mbedtls_ssl_config_init(mbedtls_ssl_config *conf)
+{
+  conf->authmode = MBEDTLS_SSL_VERIFY_REQUIRED;
+}
+
+void mbedtls_ssl_config_free(mbedtls_ssl_config *conf) {}
+
+int mbedtls_ssl_config_defaults(mbedtls_ssl_config *conf, int endpoint, int transport, int preset)
+{
+  return 0;
+}
+
+void mbedtls_ssl_conf_authmode(mbedtls_ssl_config *conf, int authmode)
+{
+  conf->authmode = authmode;
+}
+
+void mbedtls_ssl_conf_ca_chain(mbedtls_ssl_config *conf, mbedtls_x509_crt *ca_chain, void *ca_crl) {}
+
+void mbedtls_ssl_conf_rng(mbedtls_ssl_config *conf, int (*f_rng)(void *, unsigned char *, size_t), void *p_rng) {}
+
+void mbedtls_ssl_conf_session_tickets(mbedtls_ssl_config *conf, int use_tickets) {}
+
+void mbedtls_ssl_session_init(mbedtls_ssl_session *session)
+{
+  memset(session, 0, sizeof(*session));
+}
+
+void mbedtls_ssl_session_free(mbedtls_ssl_session *session)
+{
+  memset(session, 0, sizeof(*session));
+}
+
+int mbedtls_ssl_set_session(mbedtls_ssl_context *ssl, const mbedtls_ssl_session *session)
+{
+  return 0;
+}
+
+int mbedtls_ssl_get_session(const mbedtls_ssl_context *ssl, mbedtls_ssl_session *session)
+{
+  *session = ssl->session;
+  return 0;
+}
+
+int mbedtls_ssl_session_save(const mbedtls_ssl_session *session, unsigned char *buf, size_t buf_len, size_t *olen)
+{
+  if (buf_len < sizeof(*session))
+  {
+    return MBEDTLS_ERR_SSL_BUFFER_TOO_SMALL;
+  }
+  memcpy(buf, session, sizeof(*session));
+  *olen = sizeof(*session);
+  return 0;
+}
+
+int mbedtls_ssl_session_load(mbedtls_ssl_session *session, const unsigned char *buf, size_t len)
+{
+  if (len != sizeof(*session))
+  {
+    return MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
+  }
+  memcpy(session, buf, len);
+  return 0;
+}
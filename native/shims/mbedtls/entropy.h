@@ -0,0 +1,11 @@
+#pragma once
+
+#include <cstddef>
+
+struct mbedtls_entropy_context
+{
+  int ready;
+};
+
+void mbedtls_entropy_init(mbedtls_entropy_context *ctx);
+int mbedtls_entropy_func(void *data, unsigned char *output, size_t len);
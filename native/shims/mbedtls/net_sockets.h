@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstddef>
+
+#define MBEDTLS_ERR_NET_RECV_FAILED -0x004C
+#define MBEDTLS_ERR_NET_SEND_FAILED -0x004E
+#define MBEDTLS_ERR_NET_CONN_RESET -0x0050
+
+struct mbedtls_net_context
+{
+  int fd;
+};
+
+// Non-blocking socket I/O, WANT_READ/WANT_WRITE when it would block
+int mbedtls_net_send(void *ctx, const unsigned char *buf, size_t len);
+int mbedtls_net_recv(void *ctx, unsigned char *buf, size_t len);
@@ -0,0 +1,6 @@
+// mbedTLS version for the native build, the one the ESP32 Arduino core 2.x ships
+
+#pragma once
+
+#define MBEDTLS_VERSION_NUMBER 0x021C0000
+#define MBEDTLS_VERSION_STRING "2.28.0"
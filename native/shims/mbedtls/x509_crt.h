@@ -0,0 +1,13 @@
+#pragma once
+
+#include <cstddef>
+
+// Certificates are parsed for nothing, the stand-in server isn't TLS
+struct mbedtls_x509_crt
+{
+  int parsed;
+};
+
+void mbedtls_x509_crt_init(mbedtls_x509_crt *crt);
+void mbedtls_x509_crt_free(mbedtls_x509_crt *crt);
+int mbedtls_x509_crt_parse(mbedtls_x509_crt *chain, const unsigned char *buf, size_t buflen);
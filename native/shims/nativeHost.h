@@ -0,0 +1,18 @@
+// What the native runner (native/main.cpp) can do to the stand-in hardware
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+// Sets an input pin's level, running its interrupt if the edge matches
+void nativeSetPin(uint8_t pin, int level);
+
+// Runs work on the timer thread, ms from now, like a hardware interrupt would
+void nativeAfter(unsigned long ms, std::function<void()> work);
+
+// Directory SPIFFS is kept in
+void nativeSpiffsBegin(const char *root);
+
+// Where every host name resolves to, and the port that stands in for 443
+void nativeServerBegin(uint16_t port);
@@ -0,0 +1,34 @@
+// WiFi and sockets for the native build (see WiFi.h and lwip/sockets.h)
+
+#include <WiFi.h>
+#include <lwip/sockets.h>
+#include "nativeHost.h"
+
+#include <sys/syscall.h>
+
+WiFiClass WiFi;
+
+static uint16_t serverPort = 0;
+
+void nativeServerBegin(uint16_t port)
+{
+  serverPort = port;
+}
+
+// Replaces the C library's connect() for the whole program: the sketch
+// connects to port 443 of whatever the host resolved to, which is sent to
+// the stand-in server's port so nothing needs to listen on a privileged port
+extern "C" int connect(int fd, const struct sockaddr *address, socklen_t length)
+{
+  struct sockaddr_in redirected;
+  if (serverPort != 0 && address->sa_family == AF_INET && length >= sizeof(redirected))
+  {
+    memcpy(&redirected, address, sizeof(redirected));
+    if (redirected.sin_addr.s_addr == htonl(INADDR_LOOPBACK) && redirected.sin_port == htons(443))
+    {
+      redirected.sin_port = htons(serverPort);
+      return syscall(SYS_connect, fd, &redirected, sizeof(redirected));
+    }
+  }
+  return syscall(SYS_connect, fd, address, length);
+}
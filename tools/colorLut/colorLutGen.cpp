@@ -0,0 +1,167 @@
+// Builds SpotifyDiyThing/colorLut.h from SpotifyDiyThing/colorPipeline.h
+//
+// The ESP32 can't spare 128KB of RAM for the table, so it is generated here
+// and ends up in flash. Run from this folder after changing colorPipeline.h:
+//
+//   g++ -O2 -ffp-contract=off -o colorLutGen colorLutGen.cpp
+//   ./colorLutGen > ../../SpotifyDiyThing/colorLut.h
+//
+// Run it again with --bench to check the table is bit-exact against
+// colorPipelinePixel() for all 65536 inputs and to time both paths.
+// (-ffp-contract=off stops the compiler fusing the float maths, so the
+// results are the same as the plain C++.)
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+#include "../../SpotifyDiyThing/colorPipeline.h"
+
+#if __has_include("../../SpotifyDiyThing/colorLut.h")
+#include "../../SpotifyDiyThing/colorLut.h"
+#define HAVE_COLOR_LUT 1
+#endif
+
+static void buildTable(const ColorPipelineConfig &config, std::vector<uint16_t> &table)
+{
+  table.resize(65536);
+  for (uint32_t pixel = 0; pixel < 65536; pixel++)
+  {
+    table[pixel] = colorPipelinePixel(pixel, config);
+  }
+}
+
+static void printConfig(const ColorPipelineConfig &config)
+{
+  // 9 significant digits always read back as the same float
+  printf("static const ColorPipelineConfig colorLutConfig = {%.9g, %.9g, %.9g};\n",
+         config.saturation, config.gamma, config.brightness);
+}
+
+static void printTable(const std::vector<uint16_t> &table)
+{
+  printf("const uint16_t colorLut[65536] = {\n");
+  for (uint32_t i = 0; i < 65536; i += 16)
+  {
+    printf(" ");
+    for (uint32_t j = i; j < i + 16; j++)
+    {
+      printf(" 0x%04x,", table[j]);
+    }
+    printf("\n");
+  }
+  printf("};\n");
+}
+
+static int generate()
+{
+  std::vector<uint16_t> cyd, cyd2usb;
+  buildTable(COLOR_PIPELINE_CYD, cyd);
+  buildTable(COLOR_PIPELINE_CYD2USB, cyd2usb);
+
+  printf("// Generated by tools/colorLut/colorLutGen.cpp from colorPipeline.h, do not edit\n");
+  printf("// RGB565 (big-endian, as JPEGDEC hands it over) in, RGB565 out.\n");
+  printf("// The config it was built with is kept so a stale table can be spotted.\n\n");
+  printf("#ifndef COLORLUT_H\n#define COLORLUT_H\n\n");
+
+  printf("#ifdef CYD2USB\n");
+  printConfig(COLOR_PIPELINE_CYD2USB);
+  printf("#else\n");
+  printConfig(COLOR_PIPELINE_CYD);
+  printf("#endif\n\n");
+
+  if (cyd == cyd2usb)
+  {
+    printf("// Both panels use the same stages\n");
+    printTable(cyd);
+  }
+  else
+  {
+    printf("#ifdef CYD2USB\n");
+    printTable(cyd2usb);
+    printf("#else\n");
+    printTable(cyd);
+    printf("#endif\n");
+  }
+
+  printf("\n#endif\n");
+  return 0;
+}
+
+#ifdef HAVE_COLOR_LUT
+static int bench()
+{
+  // Bit-exact check of the table that is in the tree
+  int mismatches = 0;
+  for (uint32_t pixel = 0; pixel < 65536; pixel++)
+  {
+    if (colorLut[pixel] != colorPipelinePixel(pixel, colorPipeline))
+    {
+      if (mismatches++ < 10)
+      {
+        fprintf(stderr, "Mismatch at 0x%04x: table 0x%04x, function 0x%04x\n",
+                pixel, colorLut[pixel], colorPipelinePixel(pixel, colorPipeline));
+      }
+    }
+  }
+  printf("Table check: %d mismatches out of 65536\n", mismatches);
+
+  // One album is 150x150 pixels, decoded MCU by MCU
+  const int albumPixels = 150 * 150;
+  const int albums = 200;
+  std::vector<uint16_t> source(albumPixels), pixels(albumPixels);
+  srand(1);
+  for (int i = 0; i < albumPixels; i++)
+  {
+    source[i] = rand() & 0xFFFF;
+  }
+
+  uint32_t checksum = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int album = 0; album < albums; album++)
+  {
+    memcpy(pixels.data(), source.data(), albumPixels * sizeof(uint16_t));
+    for (int i = 0; i < albumPixels; i++)
+    {
+      pixels[i] = boostSaturation(pixels[i], saturationBoost);
+    }
+    checksum += pixels[album];
+  }
+  double functionMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+  start = std::chrono::steady_clock::now();
+  for (int album = 0; album < albums; album++)
+  {
+    memcpy(pixels.data(), source.data(), albumPixels * sizeof(uint16_t));
+    for (int i = 0; i < albumPixels; i++)
+    {
+      pixels[i] = colorLut[pixels[i]];
+    }
+    checksum += pixels[album];
+  }
+  double tableMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+  printf("boostSaturation: %.3f ms per album\n", functionMs / albums);
+  printf("colorLut:        %.3f ms per album\n", tableMs / albums);
+  printf("Speedup:         %.1fx (checksum %u)\n", functionMs / tableMs, checksum);
+  return mismatches == 0 ? 0 : 1;
+}
+#endif
+
+int main(int argc, char **argv)
+{
+  if (argc > 1 && strcmp(argv[1], "--bench") == 0)
+  {
+#ifdef HAVE_COLOR_LUT
+    return bench();
+#else
+    fprintf(stderr, "Generate colorLut.h first\n");
+    return 1;
+#endif
+  }
+  return generate();
+}
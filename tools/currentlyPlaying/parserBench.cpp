@@ -0,0 +1,153 @@
+// Runs SpotifyDiyThing/currentlyPlayingParser.h over the payloads in
+// payloads/ and times it.
+//
+//   g++ -O2 -o parserBench parserBench.cpp
+//   ./parserBench payloads/*.json
+//
+// Each payload is parsed in one go and then again in random pieces of 1 to 64
+// bytes, like a body coming off the connection, and the two results have to
+// match. Heap allocations made while parsing are counted, with the peak
+// bytes held at once (there should be none).
+//
+// This only covers the streaming parser. The ArduinoJson filter path it
+// replaced needs ArduinoJson, which isn't set up for host builds here, so
+// there is no side by side comparison on the same payloads. On the device,
+// set CURRENTLY_PLAYING_STREAMING to false in spotifyApi.h to get its time
+// and heap peak in the serial log.
+
+#include <malloc.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+#define SPOTIFY_MAX_NUM_ARTISTS 5
+#define SPOTIFY_NUM_ALBUM_IMAGES 3
+
+#include "../../SpotifyDiyThing/currentlyPlayingParser.h"
+
+static long allocations = 0;
+static size_t heapInUse = 0;
+static size_t heapPeak = 0;
+void *operator new(size_t size)
+{
+  allocations++;
+  void *p = malloc(size);
+  if (p == NULL)
+  {
+    throw std::bad_alloc();
+  }
+  heapInUse += malloc_usable_size(p);
+  if (heapInUse > heapPeak)
+  {
+    heapPeak = heapInUse;
+  }
+  return p;
+}
+void operator delete(void *p) noexcept
+{
+  if (p != NULL)
+  {
+    heapInUse -= malloc_usable_size(p);
+  }
+  free(p);
+}
+void operator delete(void *p, size_t) noexcept { operator delete(p); }
+
+static bool readFile(const char *path, std::string &out)
+{
+  FILE *f = fopen(path, "rb");
+  if (f == NULL)
+  {
+    return false;
+  }
+  char buffer[4096];
+  size_t n;
+  while ((n = fread(buffer, 1, sizeof(buffer), f)) > 0)
+  {
+    out.append(buffer, n);
+  }
+  fclose(f);
+  return true;
+}
+
+static void print(PlayingPayload &payload)
+{
+  printf("  %s \"%s\" %s\n", payload.episode ? "episode" : "track", payload.trackName,
+         payload.trackUri[0] != '\0' ? payload.trackUri : "(none)");
+  for (int i = 0; i < payload.numArtists; i++)
+  {
+    printf("  artist \"%s\" %s\n", payload.artists[i].name, payload.artists[i].uri);
+  }
+  printf("  album \"%s\" %s\n", payload.albumName, payload.albumUri);
+  for (int i = 0; i < payload.numImages; i++)
+  {
+    printf("  image %dx%d %s\n", payload.images[i].width, payload.images[i].height, payload.images[i].url);
+  }
+  printf("  context %s, %s, %ld/%ld ms at %lld\n", payload.contextUri[0] != '\0' ? payload.contextUri : "(none)",
+         payload.isPlaying ? "playing" : "paused", payload.progressMs, payload.durationMs, payload.timestamp);
+}
+
+int main(int argc, char **argv)
+{
+  printf("PlayingPayload %zu bytes, parser %zu bytes\n\n", sizeof(PlayingPayload), sizeof(CurrentlyPlayingParser));
+  srand(1);
+
+  int failures = 0;
+  for (int f = 1; f < argc; f++)
+  {
+    std::string json;
+    if (!readFile(argv[f], json))
+    {
+      printf("%s: can't read\n", argv[f]);
+      failures++;
+      continue;
+    }
+
+    CurrentlyPlayingParser parser;
+    PlayingPayload whole;
+    long before = allocations;
+    heapPeak = heapInUse;
+    size_t heapBefore = heapInUse;
+    parser.begin(whole);
+    bool ok = parser.feed(json.data(), json.size()) && parser.done();
+    long allocated = allocations - before;
+    size_t peak = heapPeak - heapBefore;
+
+    PlayingPayload pieces;
+    parser.begin(pieces);
+    for (size_t i = 0; i < json.size() && ok;)
+    {
+      size_t length = 1 + rand() % 64;
+      if (length > json.size() - i)
+      {
+        length = json.size() - i;
+      }
+      ok = parser.feed(json.data() + i, length);
+      i += length;
+    }
+    ok = ok && parser.done();
+    bool same = memcmp(&whole, &pieces, sizeof(whole)) == 0;
+
+    const int runs = 5000;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < runs; i++)
+    {
+      parser.begin(whole);
+      parser.feed(json.data(), json.size());
+    }
+    auto end = std::chrono::steady_clock::now();
+    double us = std::chrono::duration<double, std::micro>(end - start).count() / runs;
+
+    printf("%s: %zu bytes, %s, pieces %s, %ld allocations (peak %zu bytes), %.2f us (%.0f MB/s)\n", argv[f],
+           json.size(), ok ? "parsed" : "FAILED", same ? "match" : "DIFFER", allocated, peak, us, json.size() / us);
+    print(whole);
+    if (!ok || !same || allocated != 0)
+    {
+      failures++;
+    }
+  }
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,171 @@
+// Builds the stand-in GFX fonts in native/shims/Fonts from the smooth fonts in data/
+//
+// The native build doesn't pull in TFT_eSPI, so it has no FreeSans. These
+// headers give the shim something readable to draw with instead: printable
+// ASCII from a .vlw font, anti-aliasing cut to 1 bit at half coverage. The line
+// height is taken from the command line so fontHeight() gives the same layout
+// as the FreeSans font the header stands in for. Run from this folder:
+//
+//   g++ -O2 -o vlwToGfx vlwToGfx.cpp
+//   ./vlwToGfx ../../data/NotoSans-16.vlw FreeSans9pt7b 22 > ../../native/shims/Fonts/FreeSans9pt7b.h
+//   ./vlwToGfx ../../data/NotoSans-16.vlw FreeSansBold9pt7b 22 > ../../native/shims/Fonts/FreeSansBold9pt7b.h
+//   ./vlwToGfx ../../data/NotoSans-20.vlw FreeSansBold12pt7b 29 > ../../native/shims/Fonts/FreeSansBold12pt7b.h
+//   ./vlwToGfx ../../data/NotoSans-28.vlw FreeSansBold18pt7b 42 > ../../native/shims/Fonts/FreeSansBold18pt7b.h
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#define FIRST_CHAR 0x20
+#define LAST_CHAR 0x7E
+#define COVERAGE_THRESHOLD 128 // Alpha at or above this is drawn
+
+struct VlwGlyph
+{
+  uint32_t unicode;
+  int32_t height, width, xAdvance, dY, dX;
+  size_t bitmap; // Offset of the alpha values in the file
+};
+
+// .vlw numbers are big endian 32 bit
+static int32_t readInt32(const std::vector<uint8_t> &file, size_t offset)
+{
+  return (int32_t)((uint32_t)file[offset] << 24 | (uint32_t)file[offset + 1] << 16 |
+                   (uint32_t)file[offset + 2] << 8 | file[offset + 3]);
+}
+
+int main(int argc, char **argv)
+{
+  if (argc != 4)
+  {
+    fprintf(stderr, "usage: %s font.vlw name yAdvance\n", argv[0]);
+    return 1;
+  }
+  const char *name = argv[2];
+  int yAdvance = atoi(argv[3]);
+
+  FILE *in = fopen(argv[1], "rb");
+  if (in == NULL)
+  {
+    fprintf(stderr, "can't open %s\n", argv[1]);
+    return 1;
+  }
+  std::vector<uint8_t> file;
+  uint8_t chunk[4096];
+  size_t got;
+  while ((got = fread(chunk, 1, sizeof(chunk), in)) > 0)
+  {
+    file.insert(file.end(), chunk, chunk + got);
+  }
+  fclose(in);
+
+  // 24 byte header, then 28 bytes per glyph, then the bitmaps in glyph order
+  int32_t count = readInt32(file, 0);
+  std::vector<VlwGlyph> glyphs(count);
+  size_t bitmap = 24 + (size_t)count * 28;
+  for (int32_t i = 0; i < count; i++)
+  {
+    size_t offset = 24 + (size_t)i * 28;
+    VlwGlyph &glyph = glyphs[i];
+    glyph.unicode = (uint32_t)readInt32(file, offset);
+    glyph.height = readInt32(file, offset + 4);
+    glyph.width = readInt32(file, offset + 8);
+    glyph.xAdvance = readInt32(file, offset + 12);
+    glyph.dY = readInt32(file, offset + 16);
+    glyph.dX = (int8_t)readInt32(file, offset + 20);
+    glyph.bitmap = bitmap;
+    bitmap += (size_t)glyph.width * glyph.height;
+  }
+  if (bitmap > file.size())
+  {
+    fprintf(stderr, "%s is cut short\n", argv[1]);
+    return 1;
+  }
+
+  const VlwGlyph *space = NULL;
+  for (const VlwGlyph &glyph : glyphs)
+  {
+    if (glyph.unicode == ' ')
+    {
+      space = &glyph;
+    }
+  }
+
+  std::vector<uint8_t> bits;
+  std::vector<int32_t> offsets, widths, heights, advances, xOffsets, yOffsets;
+  for (uint32_t c = FIRST_CHAR; c <= LAST_CHAR; c++)
+  {
+    const VlwGlyph *found = NULL;
+    for (const VlwGlyph &glyph : glyphs)
+    {
+      if (glyph.unicode == c)
+      {
+        found = &glyph;
+      }
+    }
+    offsets.push_back((int32_t)bits.size());
+    if (found == NULL)
+    {
+      // Missing characters advance like a space
+      widths.push_back(0);
+      heights.push_back(0);
+      advances.push_back(space != NULL ? space->xAdvance : 0);
+      xOffsets.push_back(0);
+      yOffsets.push_back(0);
+      continue;
+    }
+
+    // Packed a bit at a time across rows, as the GFX fonts are
+    uint8_t byte = 0;
+    int used = 0;
+    for (int32_t i = 0; i < found->width * found->height; i++)
+    {
+      byte <<= 1;
+      byte |= file[found->bitmap + i] >= COVERAGE_THRESHOLD;
+      if (++used == 8)
+      {
+        bits.push_back(byte);
+        byte = 0;
+        used = 0;
+      }
+    }
+    if (used > 0)
+    {
+      bits.push_back(byte << (8 - used));
+    }
+    widths.push_back(found->width);
+    heights.push_back(found->height);
+    advances.push_back(found->xAdvance);
+    xOffsets.push_back(found->dX);
+    yOffsets.push_back(-found->dY);
+  }
+
+  const char *source = strrchr(argv[1], '/');
+  printf("// Generated by tools/gfxFonts/vlwToGfx.cpp from data/%s, do not edit\n",
+         source != NULL ? source + 1 : argv[1]);
+  printf("// Stand-in for TFT_eSPI's %s in the native build, same line height\n\n", name);
+  printf("#pragma once\n\n");
+  printf("const uint8_t %sBitmaps[] PROGMEM = {\n", name);
+  for (size_t i = 0; i < bits.size(); i += 16)
+  {
+    printf(" ");
+    for (size_t j = i; j < i + 16 && j < bits.size(); j++)
+    {
+      printf(" 0x%02X,", bits[j]);
+    }
+    printf("\n");
+  }
+  printf("};\n\n");
+  printf("const GFXglyph %sGlyphs[] PROGMEM = {\n", name);
+  for (size_t i = 0; i < offsets.size(); i++)
+  {
+    printf("  {%5d, %3d, %3d, %3d, %4d, %4d}, // 0x%02X\n", offsets[i], widths[i], heights[i], advances[i],
+           xOffsets[i], yOffsets[i], (unsigned)(FIRST_CHAR + i));
+  }
+  printf("};\n\n");
+  printf("const GFXfont %s PROGMEM = {(uint8_t *)%sBitmaps, (GFXglyph *)%sGlyphs, 0x%02X, 0x%02X, %d};\n", name,
+         name, name, FIRST_CHAR, LAST_CHAR, yAdvance);
+  return 0;
+}
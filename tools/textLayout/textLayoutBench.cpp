@@ -0,0 +1,221 @@
+// Times SpotifyDiyThing/textLayout.h against the String based wrapping it
+// replaced (truncateToTwoLines, countTextLines and printTextWithBounds), on
+// long titles and multi-artist credits, with the real FreeSans tables.
+//
+// The fonts come from the TFT_eSPI library, point -I at its GFXFF folder:
+//
+//   g++ -O2 -I <TFT_eSPI>/Fonts/GFXFF -o textLayoutBench textLayoutBench.cpp
+//   ./textLayoutBench
+//
+// Both versions' lines are printed so the output can be compared by eye.
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#define PROGMEM
+#include "gfxfont.h"
+#include "FreeSans9pt7b.h"
+#include "FreeSansBold12pt7b.h"
+
+#include "../../SpotifyDiyThing/textLayout.h"
+
+// Same text area as CheapYellowDisplay::printCurrentlyPlayingToScreen
+static const int TEXT_WIDTH = 320 - (20 + 150 + 10) - 10;
+
+static const char *samples[] = {
+    "Symphony No. 9 in D Minor, Op. 125 \"Choral\": IV. Presto - Allegro assai - Allegro assai vivace (Alla marcia)",
+    "Kendrick Lamar, SZA, Rihanna, Travis Scott, Future, Metro Boomin, The Weeknd & Drake",
+    "Supercalifragilisticexpialidociousandthensomemorelettersthatneverstop",
+    "Pneumonoultramicroscopicsilicovolcanoconiosis (Extended Club Mix featuring Everyone)",
+    "Tchaikovsky: The Nutcracker, Op. 71, TH 14 / Act 2: No. 14a, Pas de deux. Andante maestoso",
+    "Short title",
+    "Wolfgang Amadeus Mozart, Berliner Philharmoniker, Herbert von Karajan & Anne-Sophie Mutter",
+};
+
+// TFT_eSPI's textWidth() for a GFX font: the advances of every glyph it has
+static int textWidthCalls = 0;
+static int textWidth(const GFXfont *font, const std::string &text)
+{
+  textWidthCalls++;
+  GfxGlyphMetrics metrics(font);
+  int width = 0;
+  for (size_t i = 0; i < text.size();)
+  {
+    int length;
+    width += metrics.advance(utf8Decode(text.c_str() + i, length));
+    i += length;
+  }
+  return width;
+}
+
+// The old helpers, with std::string standing in for String
+
+static int countTextLines(const GFXfont *font, const std::string &text, int maxWidth)
+{
+  if (textWidth(font, text) <= maxWidth)
+  {
+    return 1;
+  }
+  int lines = 1;
+  int currentLineWidth = 0;
+  size_t wordStart = 0;
+  int spaceWidth = textWidth(font, " ");
+  for (size_t i = 0; i <= text.size(); i++)
+  {
+    if (i == text.size() || text[i] == ' ')
+    {
+      if (i > wordStart)
+      {
+        int wordWidth = textWidth(font, text.substr(wordStart, i - wordStart));
+        int totalWidth = currentLineWidth > 0 ? currentLineWidth + spaceWidth + wordWidth : wordWidth;
+        if (totalWidth > maxWidth && currentLineWidth > 0)
+        {
+          lines++;
+          currentLineWidth = wordWidth;
+        }
+        else
+        {
+          currentLineWidth = totalWidth;
+        }
+      }
+      wordStart = i + 1;
+    }
+  }
+  return lines;
+}
+
+static std::string truncateToTwoLines(const GFXfont *font, const std::string &text, int maxWidth)
+{
+  std::string ellipsis = "...";
+  if (textWidth(font, text) <= maxWidth)
+  {
+    return text;
+  }
+  int safeMaxWidth = maxWidth * 0.90;
+  int left = 0;
+  int right = text.size();
+  std::string bestResult = ellipsis;
+  while (left <= right)
+  {
+    int mid = (left + right) / 2;
+    std::string testStr = text.substr(0, mid) + ellipsis;
+    if (countTextLines(font, testStr, safeMaxWidth) <= 2)
+    {
+      bestResult = testStr;
+      left = mid + 1;
+    }
+    else
+    {
+      right = mid - 1;
+    }
+  }
+  int truncatePos = bestResult.size() - ellipsis.size();
+  if (truncatePos > 0)
+  {
+    size_t lastSpace = text.rfind(' ', truncatePos);
+    if (lastSpace != std::string::npos && (int)lastSpace > truncatePos * 0.7)
+    {
+      bestResult = text.substr(0, lastSpace) + ellipsis;
+    }
+  }
+  return bestResult;
+}
+
+static void wrapLines(const GFXfont *font, const std::string &text, int maxWidth, std::vector<std::string> &out)
+{
+  out.clear();
+  std::string currentLine;
+  size_t wordStart = 0;
+  for (size_t i = 0; i <= text.size(); i++)
+  {
+    if (i == text.size() || text[i] == ' ')
+    {
+      if (i > wordStart)
+      {
+        std::string word = text.substr(wordStart, i - wordStart);
+        std::string testLine = currentLine.empty() ? word : currentLine + " " + word;
+        if (textWidth(font, testLine) > maxWidth && !currentLine.empty())
+        {
+          out.push_back(currentLine);
+          currentLine = word;
+        }
+        else
+        {
+          currentLine = testLine;
+        }
+      }
+      wordStart = i + 1;
+    }
+  }
+  if (!currentLine.empty())
+  {
+    out.push_back(currentLine);
+  }
+}
+
+// What printCurrentlyPlayingToScreen did per block: truncate, count, print
+static void oldLayout(const GFXfont *font, const char *text, std::vector<std::string> &lines)
+{
+  std::string truncated = truncateToTwoLines(font, text, TEXT_WIDTH);
+  countTextLines(font, truncated, TEXT_WIDTH);
+  wrapLines(font, truncated, TEXT_WIDTH, lines);
+  if (lines.size() > 2)
+  {
+    lines.resize(2);
+  }
+}
+
+template <typename F>
+static double timeUs(F work, int runs)
+{
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < runs; i++)
+  {
+    work();
+  }
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(end - start).count() / runs;
+}
+
+int main()
+{
+  const int runs = 2000;
+  const GFXfont *fonts[] = {&FreeSansBold12pt7b, &FreeSans9pt7b};
+  const char *fontNames[] = {"title", "detail"};
+
+  for (int f = 0; f < 2; f++)
+  {
+    GfxGlyphMetrics metrics(fonts[f]);
+    for (const char *sample : samples)
+    {
+      std::vector<std::string> oldLines;
+      textWidthCalls = 0;
+      oldLayout(fonts[f], sample, oldLines);
+      int calls = textWidthCalls;
+
+      TextBlock block;
+      textBlockSet(block, sample);
+      layoutText(block, metrics, TEXT_WIDTH, 2);
+
+      double oldUs = timeUs([&] { oldLayout(fonts[f], sample, oldLines); }, runs);
+      double newUs = timeUs([&] { textBlockSet(block, sample); layoutText(block, metrics, TEXT_WIDTH, 2); }, runs);
+
+      printf("%s font, %.40s...\n", fontNames[f], sample);
+      printf("  old: %7.2f us, %4d textWidth calls\n", oldUs, calls);
+      for (const std::string &line : oldLines)
+      {
+        printf("       |%s|\n", line.c_str());
+      }
+      printf("  new: %7.2f us\n", newUs);
+      for (int i = 0; i < block.lineCount; i++)
+      {
+        TextLine &line = block.lines[i];
+        printf("       |%.*s%s| %dpx\n", line.length, block.text + line.start,
+               line.ellipsis ? TEXT_LAYOUT_ELLIPSIS : "", line.width);
+      }
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,129 @@
+// Checks the table in SpotifyDiyThing/transliterate.h is sorted and times
+// transliterate() against the chain of String::replace calls it replaced.
+//
+//   g++ -O2 -o transliterateBench transliterateBench.cpp
+//   ./transliterateBench
+//
+// The old chain is timed twice: with its own 36 replacements, and with one
+// replacement per table entry, which is what it would have cost to reach
+// the same coverage that way.
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "../../SpotifyDiyThing/transliterate.h"
+
+static const char *samples[] = {
+    "Łódź – Zażółć gęślą jaźń (Część II)",
+    "Dvořák: Symfonie č. 9 e moll „Z Nového světa“",
+    "Çılgın Dondurma – Şarkı",
+    "Чайковский – Щелкунчик, Вальс цветов",
+    "Μάνος Χατζιδάκις – Τα Παιδιά του Πειραιά",
+    "Sigur Rós – Hoppípolla",
+    "Trần Mạnh Tuấn – Đêm đông",
+    "Plain ASCII title with nothing to replace at all",
+};
+
+// String::replace on every occurrence, like Arduino's String
+static void replaceAll(std::string &text, const std::string &find, const std::string &replace)
+{
+  size_t pos = 0;
+  while ((pos = text.find(find, pos)) != std::string::npos)
+  {
+    text.replace(pos, find.size(), replace);
+    pos += replace.size();
+  }
+}
+
+static std::string encode(uint32_t codepoint)
+{
+  std::string out;
+  if (codepoint < 0x80)
+  {
+    out += (char)codepoint;
+  }
+  else if (codepoint < 0x800)
+  {
+    out += (char)(0xC0 | (codepoint >> 6));
+    out += (char)(0x80 | (codepoint & 0x3F));
+  }
+  else
+  {
+    out += (char)(0xE0 | (codepoint >> 12));
+    out += (char)(0x80 | ((codepoint >> 6) & 0x3F));
+    out += (char)(0x80 | (codepoint & 0x3F));
+  }
+  return out;
+}
+
+struct Replacement
+{
+  std::string find;
+  std::string replace;
+};
+
+template <typename F>
+static double timeUs(F work, int runs)
+{
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < runs; i++)
+  {
+    work();
+  }
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(end - start).count() / runs;
+}
+
+int main()
+{
+  for (int i = 1; i < TRANSLITERATION_COUNT; i++)
+  {
+    if (transliterations[i].codepoint <= transliterations[i - 1].codepoint)
+    {
+      printf("Table is not sorted at U+%04X\n", transliterations[i].codepoint);
+      return 1;
+    }
+  }
+  printf("%d table entries, %zu bytes\n\n", TRANSLITERATION_COUNT, sizeof(transliterations));
+
+  // The replacements the old replaceUnsupportedChars made
+  const uint32_t oldCodepoints[] = {
+      0x142, 0x141, 0x105, 0x104, 0x107, 0x106, 0x119, 0x118, 0x144, 0x143, 0xF3, 0xD3, 0x15B,
+      0x15A, 0x17A, 0x179, 0x17C, 0x17B, 0x159, 0x158, 0x10D, 0x10C, 0x161, 0x160, 0x17E, 0x17D,
+      0x16F, 0x16E, 0x11B, 0x11A, 0x11F, 0x11E, 0x15F, 0x15E, 0x130, 0x131};
+  std::vector<Replacement> oldChain;
+  for (uint32_t codepoint : oldCodepoints)
+  {
+    oldChain.push_back({encode(codepoint), findTransliteration(codepoint)->ascii});
+  }
+  std::vector<Replacement> fullChain;
+  for (int i = 0; i < TRANSLITERATION_COUNT; i++)
+  {
+    fullChain.push_back({encode(transliterations[i].codepoint), transliterations[i].ascii});
+  }
+
+  const int runs = 2000;
+  for (const char *sample : samples)
+  {
+    char out[256];
+    std::string result;
+    auto chain = [&](const std::vector<Replacement> &replacements) {
+      result = sample;
+      for (const Replacement &r : replacements)
+      {
+        replaceAll(result, r.find, r.replace);
+      }
+    };
+
+    double oldUs = timeUs([&] { chain(oldChain); }, runs);
+    double fullUs = timeUs([&] { chain(fullChain); }, runs / 10);
+    double tableUs = timeUs([&] { transliterate(sample, out, sizeof(out)); }, runs);
+
+    printf("%s\n  -> %s\n", sample, out);
+    printf("  replace chain: %6.2f us (%zu entries), %7.2f us (%d entries), table: %5.2f us\n",
+           oldUs, oldChain.size(), fullUs, TRANSLITERATION_COUNT, tableUs);
+  }
+  return 0;
+}